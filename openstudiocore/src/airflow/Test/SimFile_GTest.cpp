@@ -0,0 +1,160 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2017, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+#include "AirflowFixture.hpp"
+
+#include "../contam/SimFile.hpp"
+
+#include "../../utilities/time/Date.hpp"
+
+#include <resources.hxx>
+
+#include <fstream>
+
+// Results for two paths and two nodes at three times, written in the row order of the simread output
+static double pathValue(int nr, unsigned time, double offset)
+{
+  return 10.0*nr + time + offset;
+}
+
+static double nodeValue(int nr, unsigned time, double offset)
+{
+  return 100.0*nr + 2.0*time + offset;
+}
+
+// The interval series built the same way as before the results were stored column-major
+static openstudio::TimeSeries referenceSeries(const std::vector<openstudio::DateTime> &fileDateTimes,
+  const std::vector<double> &values, const std::string &units)
+{
+  std::vector<openstudio::DateTime> dateTimes(fileDateTimes.begin()+1,fileDateTimes.end());
+  openstudio::Vector averages(dateTimes.size());
+  for(unsigned i=1;i<fileDateTimes.size();i++) {
+    averages[i-1] = 0.5*(values[i-1]+values[i]);
+  }
+  return openstudio::TimeSeries(dateTimes,averages,units);
+}
+
+static void expectSameSeries(const openstudio::TimeSeries &expected, const openstudio::TimeSeries &actual)
+{
+  EXPECT_EQ(expected.units(), actual.units());
+  ASSERT_EQ(expected.values().size(), actual.values().size());
+  std::vector<openstudio::DateTime> expectedDateTimes = expected.dateTimes();
+  std::vector<openstudio::DateTime> actualDateTimes = actual.dateTimes();
+  ASSERT_EQ(expectedDateTimes.size(), actualDateTimes.size());
+  for(unsigned i=0;i<expected.values().size();i++) {
+    EXPECT_EQ(expectedDateTimes[i], actualDateTimes[i]);
+    EXPECT_DOUBLE_EQ(expected.values()[i], actual.values()[i]);
+  }
+}
+
+TEST_F(AirflowFixture, SimFile_ColumnMajorResults) {
+  std::vector<int> paths = {1, 3};
+  std::vector<int> nodes = {2, 5};
+  std::vector<std::string> times = {"00:00:00", "01:00:00", "02:00:00"};
+
+  openstudio::path simPath = resourcesPath() / openstudio::toPath("contam/SimFileFixture.sim");
+  {
+    std::ofstream lfr(openstudio::toString(resourcesPath() / openstudio::toPath("contam/SimFileFixture.lfr")));
+    lfr << "day\ttime\tP#\tdP\tF0\tF1\n";
+    std::ofstream nfr(openstudio::toString(resourcesPath() / openstudio::toPath("contam/SimFileFixture.nfr")));
+    nfr << "day\ttime\tZ#\tT\tP\tD\n";
+    for(unsigned t=0;t<times.size();t++) {
+      for(int nr : paths) {
+        lfr << "1/1\t" << times[t] << "\t" << nr << "\t" << pathValue(nr,t,0.0) << "\t"
+            << pathValue(nr,t,0.25) << "\t" << -pathValue(nr,t,0.5) << "\n";
+      }
+      for(int nr : nodes) {
+        nfr << "1/1\t" << times[t] << "\t" << nr << "\t" << nodeValue(nr,t,0.0) << "\t"
+            << nodeValue(nr,t,0.25) << "\t" << nodeValue(nr,t,0.5) << "\n";
+      }
+    }
+  }
+
+  openstudio::contam::SimFile simFile(simPath);
+
+  std::vector<openstudio::DateTime> fileDateTimes = simFile.fileDateTimes();
+  ASSERT_EQ(3u, fileDateTimes.size());
+  EXPECT_EQ(openstudio::DateTime(openstudio::Date(openstudio::MonthOfYear(openstudio::MonthOfYear::Jan),1),openstudio::Time(0,1)), fileDateTimes[1]);
+  ASSERT_EQ(2u, simFile.dateTimes().size());
+  EXPECT_EQ(fileDateTimes[1], simFile.dateTimes()[0]);
+
+  // The nested accessors unpack one vector per path or node, in file order
+  std::vector<std::vector<double> > dP = simFile.dP();
+  std::vector<std::vector<double> > F1 = simFile.F1();
+  ASSERT_EQ(paths.size(), dP.size());
+  ASSERT_EQ(paths.size(), F1.size());
+  for(unsigned i=0;i<paths.size();i++) {
+    ASSERT_EQ(times.size(), dP[i].size());
+    for(unsigned t=0;t<times.size();t++) {
+      EXPECT_DOUBLE_EQ(pathValue(paths[i],t,0.0), dP[i][t]);
+      EXPECT_DOUBLE_EQ(-pathValue(paths[i],t,0.5), F1[i][t]);
+    }
+  }
+  std::vector<std::vector<double> > T = simFile.T();
+  std::vector<std::vector<double> > D = simFile.D();
+  ASSERT_EQ(nodes.size(), T.size());
+  ASSERT_EQ(nodes.size(), D.size());
+  for(unsigned i=0;i<nodes.size();i++) {
+    ASSERT_EQ(times.size(), T[i].size());
+    for(unsigned t=0;t<times.size();t++) {
+      EXPECT_DOUBLE_EQ(nodeValue(nodes[i],t,0.0), T[i][t]);
+      EXPECT_DOUBLE_EQ(nodeValue(nodes[i],t,0.5), D[i][t]);
+    }
+  }
+
+  // The series match the ones built from the previous nested layout
+  std::vector<std::vector<double> > F0 = simFile.F0();
+  for(unsigned i=0;i<paths.size();i++) {
+    boost::optional<openstudio::TimeSeries> series = simFile.pathDeltaP(paths[i]);
+    ASSERT_TRUE(series);
+    expectSameSeries(referenceSeries(fileDateTimes,dP[i],"Pa"), *series);
+    series = simFile.pathFlow1(paths[i]);
+    ASSERT_TRUE(series);
+    expectSameSeries(referenceSeries(fileDateTimes,F1[i],"kg/s"), *series);
+    std::vector<double> flow(times.size());
+    for(unsigned t=0;t<times.size();t++) {
+      flow[t] = F0[i][t] + F1[i][t];
+    }
+    series = simFile.pathFlow(paths[i]);
+    ASSERT_TRUE(series);
+    expectSameSeries(referenceSeries(fileDateTimes,flow,"kg/s"), *series);
+  }
+  std::vector<std::vector<double> > P = simFile.P();
+  for(unsigned i=0;i<nodes.size();i++) {
+    boost::optional<openstudio::TimeSeries> series = simFile.nodeTemperature(nodes[i]);
+    ASSERT_TRUE(series);
+    expectSameSeries(referenceSeries(fileDateTimes,T[i],"K"), *series);
+    series = simFile.nodePressure(nodes[i]);
+    ASSERT_TRUE(series);
+    expectSameSeries(referenceSeries(fileDateTimes,P[i],"Pa"), *series);
+  }
+
+  EXPECT_FALSE(simFile.pathDeltaP(2));
+  EXPECT_FALSE(simFile.nodeTemperature(1));
+}
@@ -28,11 +28,117 @@
 
 #include "SimFile.hpp"
 
-#include <QStringList>
+#include <cstdlib>
 
 namespace openstudio {
 namespace contam {
 
+typedef std::pair<const char*, const char*> Field;
+
+// Split a tab-delimited line into fields that point into the line, nothing is copied
+static void splitFields(const std::string &line, std::vector<Field> &fields)
+{
+  fields.clear();
+  const char *begin = line.c_str();
+  const char *end = begin + line.size();
+  // Tolerate files with DOS line endings
+  while(end > begin && (end[-1] == '\r' || end[-1] == '\n'))
+  {
+    --end;
+  }
+  const char *ptr = begin;
+  for(const char *current = begin; current < end; ++current)
+  {
+    if(*current == '\t')
+    {
+      fields.push_back(Field(ptr,current));
+      ptr = current+1;
+    }
+  }
+  fields.push_back(Field(ptr,end));
+}
+
+static std::string toString(const Field &field)
+{
+  return std::string(field.first,field.second);
+}
+
+// Skip trailing whitespace to match the behavior of QString::toDouble/toInt
+static bool atFieldEnd(const char *ptr, const Field &field)
+{
+  while(ptr < field.second && (*ptr == ' ' || *ptr == '\r'))
+  {
+    ++ptr;
+  }
+  return ptr == field.second;
+}
+
+static bool parseInt(const Field &field, int *value)
+{
+  if(field.first == field.second)
+  {
+    return false;
+  }
+  char *end;
+  long result = std::strtol(field.first,&end,10);
+  if(end == field.first || !atFieldEnd(end,field))
+  {
+    return false;
+  }
+  *value = (int)result;
+  return true;
+}
+
+static bool parseDouble(const Field &field, double *value)
+{
+  if(field.first == field.second)
+  {
+    return false;
+  }
+  char *end;
+  double result = std::strtod(field.first,&end);
+  if(end == field.first || !atFieldEnd(end,field))
+  {
+    return false;
+  }
+  *value = result;
+  return true;
+}
+
+// Convert the row-ordered results (all columns for time 1, all columns for time 2, ...) into column-major
+// order. Every column must have a value for every time.
+static bool computeColumnOffsets(const std::vector<unsigned> &columns, unsigned ncolumns, unsigned ntimes,
+                                 std::vector<size_t> &offsets)
+{
+  if(columns.size() != (size_t)ncolumns*ntimes)
+  {
+    return false;
+  }
+  std::vector<unsigned> count(ncolumns,0);
+  offsets.resize(columns.size());
+  for(size_t i=0;i<columns.size();i++)
+  {
+    unsigned column = columns[i];
+    if(count[column] >= ntimes)
+    {
+      return false;
+    }
+    offsets[i] = (size_t)column*ntimes + count[column];
+    count[column]++;
+  }
+  return true;
+}
+
+static void toColumnMajor(const std::vector<size_t> &offsets, std::vector<double> &values)
+{
+  std::vector<double> packed(values.size());
+  for(size_t i=0;i<values.size();i++)
+  {
+    packed[offsets[i]] = values[i];
+  }
+  values.swap(packed);
+}
+
 SimFile::SimFile(openstudio::path path)
 {
   m_hasLfr = false;
@@ -41,154 +147,176 @@ SimFile::SimFile(openstudio::path path)
   // For now, we need to cheat and assume that the .lfr etc. actually exist
   // This means that simread has to have been run for this to work
   openstudio::path lfrPath = path.replace_extension(openstudio::toPath("lfr").string());
-  m_hasLfr = readLfr(openstudio::toQString(lfrPath));
+  m_hasLfr = readLfr(lfrPath);
   openstudio::path nfrPath = path.replace_extension(openstudio::toPath("nfr").string());
-  m_hasNfr = readNfr(openstudio::toQString(nfrPath));
+  m_hasNfr = readNfr(nfrPath);
 }
 
-bool SimFile::computeDateTimes(QVector<QString> day, QVector<QString> time)
+bool SimFile::computeDateTimes(const std::vector<std::string> &day, const std::vector<std::string> &time)
 {
-  bool ok;
-  QStringList split;
-  int n = qMin(day.size(),time.size());
-  for(int i=0;i<n;i++)
+  size_t n = std::min(day.size(),time.size());
+  for(size_t i=0;i<n;i++)
   {
-    split = day[i].split('/');
-    if(split.size() != 2)
+    std::string::size_type pos = day[i].find('/');
+    if(pos == std::string::npos || day[i].find('/',pos+1) != std::string::npos)
     {
       return false;
     }
-    unsigned month=split[0].toInt(&ok);
-    if(!ok || month > 12)
+    int month;
+    if(!parseInt(Field(day[i].c_str(),day[i].c_str()+pos),&month) || month < 0 || month > 12)
     {
       return false;
     }
-    unsigned dayOfMonth=split[1].toInt(&ok);
-    if(!ok)
+    int dayOfMonth;
+    if(!parseInt(Field(day[i].c_str()+pos+1,day[i].c_str()+day[i].size()),&dayOfMonth))
     {
       return false;
     }
-    m_dateTimes.push_back(DateTime(Date(monthOfYear(month),dayOfMonth),Time(time[i].toStdString())));
+    m_dateTimes.push_back(DateTime(Date(monthOfYear(month),dayOfMonth),Time(time[i])));
+  }
+  // Compute the interval axis once, every series that is returned uses it
+  m_secondsFromStart.clear();
+  long seconds = 0;
+  for(size_t i=1;i<m_dateTimes.size();i++)
+  {
+    long step = (m_dateTimes[i] - m_dateTimes[i-1]).totalSeconds();
+    if(step < 0)
+    {
+      // The results wrap around the end of the year
+      step += Time(365,0).totalSeconds();
+    }
+    seconds += step;
+    m_secondsFromStart.push_back(seconds);
   }
   return true;
 }
 
+std::vector<std::vector<double> > SimFile::unpack(const std::vector<double> &buffer, unsigned ncolumns) const
+{
+  std::vector<std::vector<double> > result;
+  if(ncolumns == 0)
+  {
+    return result;
+  }
+  size_t ntimes = buffer.size()/ncolumns;
+  result.reserve(ncolumns);
+  for(unsigned i=0;i<ncolumns;i++)
+  {
+    result.push_back(std::vector<double>(buffer.begin()+i*ntimes,buffer.begin()+(i+1)*ntimes));
+  }
+  return result;
+}
+
 void SimFile::clearLfr()
 {
+  m_pathNr.clear();
+  m_pathIndex.clear();
   m_dP.clear();
   m_F0.clear();
   m_F1.clear();
 }
 
-bool SimFile::readLfr(QString fileName)
+bool SimFile::readLfr(const openstudio::path &path)
 {
   clearLfr();
-  QVector<QString> day;
-  QVector<QString> time;
-  openstudio::filesystem::ifstream file(openstudio::toPath(fileName));
+  std::vector<std::string> day;
+  std::vector<std::string> time;
+  openstudio::filesystem::ifstream file(path);
   if(!file.is_open())
   {
-    LOG(Error,"Failed to open LFR file '" << fileName.toStdString() << "'");
+    LOG(Error,"Failed to open LFR file '" << openstudio::toString(path) << "'");
     return false;
   }
-  QMap<int,int> nrMap;
   // Read the header
-  std::string headerstr;
-  std::getline(file, headerstr);
-  QString header = openstudio::toQString(headerstr);
-  if(header.isNull() || header.isEmpty())
+  std::vector<Field> row;
+  std::string line;
+  std::getline(file, line);
+  if(line.empty())
   {
-    LOG(Error,"No data in LFR file '" << fileName.toStdString() << "'");
+    LOG(Error,"No data in LFR file '" << openstudio::toString(path) << "'");
     return false;
   }
-  QStringList row = header.split('\t');
-  int ncols = 6;
+  splitFields(line,row);
+  unsigned ncols = 6;
   if(row.size() != ncols)
   {
     LOG(Error,"LFR file has " << row.size() << " columns, not the expected " << ncols);
     return false;
   }
-  // Read the data
-  while(file.good())
+  // Read the data in file order, it will be rearranged into columns below
+  std::vector<unsigned> columns;
+  while(std::getline(file, line))
   {
-    std::string linestr;
-    std::getline(file, linestr);
-    QString line = openstudio::toQString(linestr);
-    QStringList row = line.split('\t');
+    splitFields(line,row);
+    if(row.size() == 1 && row[0].first == row[0].second)
+    {
+      continue;
+    }
     if(row.size() != ncols)
     {
       clearLfr();
       LOG(Error,"LFR data line has " << row.size() << " columns, not the expected " << ncols);
       return false;
     }
-    if(time.size())
+    if(time.empty() || time.back().compare(0,std::string::npos,row[1].first,row[1].second-row[1].first) != 0)
     {
-      if(time[time.size()-1] != row[1])
-      {
-        day << row[0];
-        time << row[1];
-      }
+      day.push_back(toString(row[0]));
+      time.push_back(toString(row[1]));
     }
-    else
-    {
-      day << row[0];
-      time << row[1];
-    }
-    bool convOk;
-    int nr = row[2].toInt(&convOk);
-    if(!convOk)
+    int nr;
+    if(!parseInt(row[2],&nr))
     {
       clearLfr();
-      LOG(Error,"Invalid link number '" << row[2].toStdString() << "'");
+      LOG(Error,"Invalid link number '" << toString(row[2]) << "'");
       return false;
     }
-    if(!nrMap.contains(nr))
+    std::map<int,unsigned>::iterator iter = m_pathIndex.find(nr);
+    if(iter == m_pathIndex.end())
     {
-      int sz = nrMap.size();
-      nrMap[nr] = sz;
-      m_dP.resize(sz+1);
-      m_F0.resize(sz+1);
-      m_F1.resize(sz+1);
+      iter = m_pathIndex.insert(std::make_pair(nr,(unsigned)m_pathNr.size())).first;
+      m_pathNr.push_back(nr);
     }
-    double dP = row[3].toDouble(&convOk);
-    if(!convOk)
+    double dP, F0, F1;
+    if(!parseDouble(row[3],&dP))
     {
       clearLfr();
-      LOG(Error,"Invalid pressure difference '" << row[3].toStdString() << "'");
+      LOG(Error,"Invalid pressure difference '" << toString(row[3]) << "'");
       return false;
     }
-    double F0 = row[4].toDouble(&convOk);
-    if(!convOk)
+    if(!parseDouble(row[4],&F0))
     {
       clearLfr();
-      LOG(Error,"Invalid flow 0 '" << row[4].toStdString() << "'");
+      LOG(Error,"Invalid flow 0 '" << toString(row[4]) << "'");
       return false;
     }
-    double F1 = row[5].toDouble(&convOk);
-    if(!convOk)
+    if(!parseDouble(row[5],&F1))
     {
       clearLfr();
-      LOG(Error,"Invalid flow 1 '" << row[5].toStdString() << "'");
+      LOG(Error,"Invalid flow 1 '" << toString(row[5]) << "'");
       return false;
     }
-    m_dP[nrMap[nr]].push_back(dP);
-    m_F0[nrMap[nr]].push_back(F0);
-    m_F1[nrMap[nr]].push_back(F1);
-
+    columns.push_back(iter->second);
+    m_dP.push_back(dP);
+    m_F0.push_back(F0);
+    m_F1.push_back(F1);
   }
-  // Unwind the zone number map;
-  QList<int> keys = nrMap.keys();
-  m_pathNr.resize(keys.size());
-  for(int i=0;i<keys.size();i++)
+  file.close();
+  std::vector<size_t> offsets;
+  if(!computeColumnOffsets(columns,m_pathNr.size(),time.size(),offsets))
   {
-    m_pathNr[nrMap[keys[i]]] = keys[i];
+    clearLfr();
+    LOG(Error,"LFR file does not contain results for every path at every time");
+    return false;
   }
-  file.close();
+  toColumnMajor(offsets,m_dP);
+  toColumnMajor(offsets,m_F0);
+  toColumnMajor(offsets,m_F1);
   // Compute the required date/time objects - this needs to be moved elsewhere if the NCR and NFR are also read
   if(!computeDateTimes(day,time))
   {
     clearLfr();
     m_dateTimes.clear();
+    m_secondsFromStart.clear();
     LOG(Error,"Failed to compute date and time objects from LFR input");
     return false;
   }
@@ -197,99 +325,88 @@ bool SimFile::readLfr(QString fileName)
 
 void SimFile::clearNfr()
 {
+  m_nodeNr.clear();
+  m_nodeIndex.clear();
   m_T.clear();
   m_P.clear();
   m_D.clear();
 }
 
-bool SimFile::readNfr(QString fileName)
+bool SimFile::readNfr(const openstudio::path &path)
 {
   clearNfr();
-  QVector<QString> day;
-  QVector<QString> time;
-  openstudio::filesystem::ifstream file(openstudio::toPath(fileName));
-  if(file.is_open())
+  std::vector<std::string> day;
+  std::vector<std::string> time;
+  openstudio::filesystem::ifstream file(path);
+  if(!file.is_open())
   {
-    LOG(Error,"Failed to open NFR file '" << fileName.toStdString() << "'");
+    LOG(Error,"Failed to open NFR file '" << openstudio::toString(path) << "'");
     return false;
   }
 
-  QMap<int,int> nrMap;
   // Read the header
-  std::string headerstr;
-  std::getline(file, headerstr);
-  QString header = openstudio::toQString(headerstr);
-  if(header.isNull() || header.isEmpty())
+  std::vector<Field> row;
+  std::string line;
+  std::getline(file, line);
+  if(line.empty())
   {
-    LOG(Error,"No data in LFR file '" << fileName.toStdString() << "'");
+    LOG(Error,"No data in NFR file '" << openstudio::toString(path) << "'");
     return false;
   }
-  QStringList row = header.split('\t');
-  int ncols = 6;
+  splitFields(line,row);
+  unsigned ncols = 6;
   if(row.size() != ncols && row.size() != ncols+2)
   {
     LOG(Error,"NFR file has " << row.size() << " columns, not the expected " << ncols);
     return false;
   }
-  // Read the data
-  while(file.good())
+  // Read the data in file order, it will be rearranged into columns below
+  std::vector<unsigned> columns;
+  while(std::getline(file, line))
   {
-    std::string linestr;
-    std::getline(file, linestr);
-    QString line = openstudio::toQString(linestr);
-
-    QStringList row = line.split('\t');
+    splitFields(line,row);
+    if(row.size() == 1 && row[0].first == row[0].second)
+    {
+      continue;
+    }
     if(row.size() != ncols && row.size() != ncols+2)
     {
       clearNfr();
       LOG(Error,"NFR data line has " << row.size() << " columns, not the expected " << ncols);
       return false;
     }
-    if(time.size())
+    if(time.empty() || time.back().compare(0,std::string::npos,row[1].first,row[1].second-row[1].first) != 0)
     {
-      if(time[time.size()-1] != row[1])
-      {
-        day << row[0];
-        time << row[1];
-      }
+      day.push_back(toString(row[0]));
+      time.push_back(toString(row[1]));
     }
-    else
-    {
-      day << row[0];
-      time << row[1];
-    }
-    bool convOk;
-    int nr = row[2].toInt(&convOk);
-    if(!convOk)
+    int nr;
+    if(!parseInt(row[2],&nr))
     {
       clearNfr();
-      LOG(Error,"Invalid node number '" << row[2].toStdString() << "'");
+      LOG(Error,"Invalid node number '" << toString(row[2]) << "'");
       return false;
     }
-    if(!nrMap.contains(nr))
+    std::map<int,unsigned>::iterator iter = m_nodeIndex.find(nr);
+    if(iter == m_nodeIndex.end())
     {
-      int sz = nrMap.size();
-      nrMap[nr] = sz;
-      m_T.resize(sz+1);
-      m_P.resize(sz+1);
-      m_D.resize(sz+1);
+      iter = m_nodeIndex.insert(std::make_pair(nr,(unsigned)m_nodeNr.size())).first;
+      m_nodeNr.push_back(nr);
     }
-    double T = row[3].toDouble(&convOk);
-    if(!convOk)
+    double T, P, D;
+    if(!parseDouble(row[3],&T))
     {
       clearNfr();
-      LOG(Error,"Invalid temperature '" << row[3].toStdString() << "'");
+      LOG(Error,"Invalid temperature '" << toString(row[3]) << "'");
       return false;
     }
-    double P = row[4].toDouble(&convOk);
-    if(!convOk)
+    if(!parseDouble(row[4],&P))
     {
       clearNfr();
-      LOG(Error,"Invalid pressure '" << row[4].toStdString() << "'");
+      LOG(Error,"Invalid pressure '" << toString(row[4]) << "'");
       return false;
     }
-    double D = row[5].toDouble(&convOk);
-    if(!convOk)
+    if(!parseDouble(row[5],&D))
     {
       if(nr==0)
       {
@@ -298,138 +415,148 @@ bool SimFile::readNfr(QString fileName)
       else
       {
         clearNfr();
-        LOG(Error,"Invalid density '" << row[5].toStdString() << "'");
+        LOG(Error,"Invalid density '" << toString(row[5]) << "'");
         return false;
       }
     }
-    m_T[nrMap[nr]].push_back(T);
-    m_P[nrMap[nr]].push_back(P);
-    m_D[nrMap[nr]].push_back(D);
-
+    columns.push_back(iter->second);
+    m_T.push_back(T);
+    m_P.push_back(P);
+    m_D.push_back(D);
   }
-  // Unwind the zone number map;
-  QList<int> keys = nrMap.keys();
-  m_nodeNr.resize(keys.size());
-  for(int i=0;i<keys.size();i++)
+  file.close();
+  std::vector<size_t> offsets;
+  if(!computeColumnOffsets(columns,m_nodeNr.size(),time.size(),offsets))
   {
-    m_nodeNr[nrMap[keys[i]]] = keys[i];
+    clearNfr();
+    LOG(Error,"NFR file does not contain results for every node at every time");
+    return false;
   }
-  file.close();
-  // Something should probably be done here to make sure that the times here match up with what we
+  toColumnMajor(offsets,m_T);
+  toColumnMajor(offsets,m_P);
+  toColumnMajor(offsets,m_D);
+  // Something more should probably be done here to make sure that the times here match up with what we
   // already have. For now, if nothing is known about the dates, then try to compute it
   if(m_dateTimes.size() == 0)
   {
     if(!computeDateTimes(day,time))
     {
-      clearLfr();
+      clearNfr();
       m_dateTimes.clear();
+      m_secondsFromStart.clear();
       LOG(Error,"Failed to compute date and time objects from NFR input");
       return false;
     }
   }
+  else if(m_dateTimes.size() != time.size())
+  {
+    clearNfr();
+    LOG(Error,"NFR file has " << time.size() << " times, not the expected " << m_dateTimes.size());
+    return false;
+  }
   return true;
 }
 
-static openstudio::TimeSeries convertData(std::vector<openstudio::DateTime> inputDateTimes,
-                                          std::vector<double> inputValues, std::string units)
+openstudio::TimeSeries SimFile::convertData(const double *column, const std::string &units) const
 {
   // Use a per-interval trapezoidal approximation to convert the CONTAM point data into E+ interval data
-  std::vector<openstudio::DateTime> dateTimes;
-  std::vector<double> values;
-  if(inputDateTimes.size()==1) // Account for steady simulation results
+  if(m_dateTimes.size()==1) // Account for steady simulation results
   {
-    return openstudio::TimeSeries(inputDateTimes,createVector(inputValues),units);
+    return openstudio::TimeSeries(m_dateTimes,openstudio::Vector(1,column[0]),units);
   }
-  for(unsigned i=1;i<inputDateTimes.size();i++)
+  openstudio::Vector values(m_secondsFromStart.size());
+  for(unsigned i=1;i<m_dateTimes.size();i++)
   {
-    dateTimes.push_back(inputDateTimes[i]);
-    values.push_back(0.5*(inputValues[i-1]+inputValues[i]));
+    values[i-1] = 0.5*(column[i-1]+column[i]);
   }
-  return openstudio::TimeSeries(dateTimes,createVector(values),units);
+  return openstudio::TimeSeries(m_dateTimes[1],m_secondsFromStart,values,units);
 }
 
+openstudio::TimeSeries SimFile::convertData(const double *column0, const double *column1,
+                                            const std::string &units) const
+{
+  if(m_dateTimes.size()==1) // Account for steady simulation results
+  {
+    return openstudio::TimeSeries(m_dateTimes,openstudio::Vector(1,column0[0]+column1[0]),units);
+  }
+  openstudio::Vector values(m_secondsFromStart.size());
+  for(unsigned i=1;i<m_dateTimes.size();i++)
+  {
+    values[i-1] = 0.5*((column0[i-1]+column1[i-1])+(column0[i]+column1[i]));
+  }
+  return openstudio::TimeSeries(m_dateTimes[1],m_secondsFromStart,values,units);
+}
 
 boost::optional<openstudio::TimeSeries> SimFile::pathDeltaP(int nr) const
 {
-  int index = m_pathNr.indexOf(nr);
-  if(index == -1)
+  std::map<int,unsigned>::const_iterator iter = m_pathIndex.find(nr);
+  if(iter == m_pathIndex.end())
   {
     return boost::optional<openstudio::TimeSeries>();
   }
-  openstudio::TimeSeries series = convertData(m_dateTimes,m_dP[index],"Pa");
-  return boost::optional<openstudio::TimeSeries>(series);
+  return boost::optional<openstudio::TimeSeries>(convertData(&m_dP[iter->second*m_dateTimes.size()],"Pa"));
 }
 
 boost::optional<openstudio::TimeSeries> SimFile::pathFlow0(int nr) const
 {
-  int index = m_pathNr.indexOf(nr);
-  if(index == -1)
+  std::map<int,unsigned>::const_iterator iter = m_pathIndex.find(nr);
+  if(iter == m_pathIndex.end())
   {
     return boost::optional<openstudio::TimeSeries>();
   }
-  openstudio::TimeSeries series = convertData(m_dateTimes,m_F0[index],"kg/s");
-  return boost::optional<openstudio::TimeSeries>(series);
+  return boost::optional<openstudio::TimeSeries>(convertData(&m_F0[iter->second*m_dateTimes.size()],"kg/s"));
 }
 
 boost::optional<openstudio::TimeSeries> SimFile::pathFlow1(int nr) const
 {
-  int index = m_pathNr.indexOf(nr);
-  if(index == -1)
+  std::map<int,unsigned>::const_iterator iter = m_pathIndex.find(nr);
+  if(iter == m_pathIndex.end())
   {
     return boost::optional<openstudio::TimeSeries>();
   }
-  openstudio::TimeSeries series = convertData(m_dateTimes,m_F1[index],"kg/s");
-  return boost::optional<openstudio::TimeSeries>(series);
+  return boost::optional<openstudio::TimeSeries>(convertData(&m_F1[iter->second*m_dateTimes.size()],"kg/s"));
 }
 
 boost::optional<openstudio::TimeSeries> SimFile::pathFlow(int nr) const
 {
-  int index = m_pathNr.indexOf(nr);
-  if(index == -1)
+  std::map<int,unsigned>::const_iterator iter = m_pathIndex.find(nr);
+  if(iter == m_pathIndex.end())
   {
     return boost::optional<openstudio::TimeSeries>();
   }
-  std::vector<double> flow(m_dateTimes.size());
-  for(unsigned i=0;i<m_dateTimes.size();i++)
-  {
-    flow[i] = m_F0[index][i] + m_F1[index][i];
-  }
+  size_t offset = iter->second*m_dateTimes.size();
   // Need to confirm that the total flow is F0+F1, since it also could be F0-F1
-  openstudio::TimeSeries series = convertData(m_dateTimes,flow,"kg/s");
-  return boost::optional<openstudio::TimeSeries>(series);
+  return boost::optional<openstudio::TimeSeries>(convertData(&m_F0[offset],&m_F1[offset],"kg/s"));
 }
 
 boost::optional<openstudio::TimeSeries> SimFile::nodeTemperature(int nr) const
 {
-  int index = m_nodeNr.indexOf(nr);
-  if(index == -1)
+  std::map<int,unsigned>::const_iterator iter = m_nodeIndex.find(nr);
+  if(iter == m_nodeIndex.end())
   {
     return boost::optional<openstudio::TimeSeries>();
   }
-  openstudio::TimeSeries series = convertData(m_dateTimes,m_T[index],"K");
-  return boost::optional<openstudio::TimeSeries>(series);
+  return boost::optional<openstudio::TimeSeries>(convertData(&m_T[iter->second*m_dateTimes.size()],"K"));
 }
 
 boost::optional<openstudio::TimeSeries> SimFile::nodePressure(int nr) const
 {
-  int index = m_nodeNr.indexOf(nr);
-  if(index == -1)
+  std::map<int,unsigned>::const_iterator iter = m_nodeIndex.find(nr);
+  if(iter == m_nodeIndex.end())
   {
     return boost::optional<openstudio::TimeSeries>();
   }
-  openstudio::TimeSeries series = convertData(m_dateTimes,m_P[index],"Pa");
-  return boost::optional<openstudio::TimeSeries>(series);
+  return boost::optional<openstudio::TimeSeries>(convertData(&m_P[iter->second*m_dateTimes.size()],"Pa"));
 }
 
 boost::optional<openstudio::TimeSeries> SimFile::nodeDensity(int nr) const
 {
-  int index = m_nodeNr.indexOf(nr);
-  if(index == -1)
+  std::map<int,unsigned>::const_iterator iter = m_nodeIndex.find(nr);
+  if(iter == m_nodeIndex.end())
   {
     return boost::optional<openstudio::TimeSeries>();
   }
-  openstudio::TimeSeries series = convertData(m_dateTimes,m_D[index],"kg/m^3");
-  return boost::optional<openstudio::TimeSeries>(series);
+  return boost::optional<openstudio::TimeSeries>(convertData(&m_D[iter->second*m_dateTimes.size()],"kg/m^3"));
 }
 
 std::vector<openstudio::DateTime> SimFile::dateTimes() const
@@ -34,7 +34,9 @@
 #include "../utilities/data/TimeSeries.hpp"
 #include "../utilities/core/Path.hpp"
 
-#include <QVector>
+#include <map>
+#include <string>
+#include <vector>
 
 #include "../AirflowAPI.hpp"
 
@@ -45,30 +47,31 @@ class AIRFLOW_API SimFile {
 public:
   explicit SimFile(openstudio::path path);
 
-  // These are provided for advanced use
+  // These are provided for advanced use. Each call unpacks the results into a new nested vector,
+  // the results are stored internally as one contiguous column-major block per quantity.
   std::vector<std::vector<double> > dP() const
   {
-    return m_dP;
+    return unpack(m_dP, m_pathNr.size());
   }
   std::vector<std::vector<double> > F0() const
   {
-    return m_F0;
+    return unpack(m_F0, m_pathNr.size());
   }
   std::vector<std::vector<double> > F1() const
   {
-    return m_F1;
+    return unpack(m_F1, m_pathNr.size());
   }
   std::vector<std::vector<double> > T() const
   {
-    return m_T;
+    return unpack(m_T, m_nodeNr.size());
   }
   std::vector<std::vector<double> > P() const
   {
-    return m_P;
+    return unpack(m_P, m_nodeNr.size());
   }
   std::vector<std::vector<double> > D() const
   {
-    return m_D;
+    return unpack(m_D, m_nodeNr.size());
   }
 
 
@@ -94,20 +97,28 @@ public:
 
 private:
   void clearLfr();
-  bool readLfr(QString fileName);
+  bool readLfr(const openstudio::path &path);
   void clearNfr();
-  bool readNfr(QString fileName);
-  bool computeDateTimes(QVector<QString> day, QVector<QString> time);
-
-  QVector<int> m_pathNr;  // the CONTAM path index
-  std::vector<std::vector<double> > m_dP;
-  std::vector<std::vector<double> > m_F0;
-  std::vector<std::vector<double> > m_F1;
-  QVector<int> m_nodeNr;  // the CONTAM node index
-  std::vector<std::vector<double> > m_T;
-  std::vector<std::vector<double> > m_P;
-  std::vector<std::vector<double> > m_D;
+  bool readNfr(const openstudio::path &path);
+  bool computeDateTimes(const std::vector<std::string> &day, const std::vector<std::string> &time);
+  std::vector<std::vector<double> > unpack(const std::vector<double> &buffer, unsigned ncolumns) const;
+  // Build an interval series from the point data of one column, all series share the same time axis
+  openstudio::TimeSeries convertData(const double *column, const std::string &units) const;
+  openstudio::TimeSeries convertData(const double *column0, const double *column1, const std::string &units) const;
+
+  std::vector<int> m_pathNr;  // the CONTAM path index
+  std::map<int,unsigned> m_pathIndex; // CONTAM path index to column
+  std::vector<double> m_dP; // column-major, one column of m_dateTimes.size() values per path
+  std::vector<double> m_F0;
+  std::vector<double> m_F1;
+  std::vector<int> m_nodeNr;  // the CONTAM node index
+  std::map<int,unsigned> m_nodeIndex; // CONTAM node index to column
+  std::vector<double> m_T; // column-major, one column of m_dateTimes.size() values per node
+  std::vector<double> m_P;
+  std::vector<double> m_D;
   std::vector<openstudio::DateTime> m_dateTimes;
+  // The interval time axis shared by all of the output series
+  std::vector<long> m_secondsFromStart;
 
   bool m_hasLfr;
   bool m_hasNfr;
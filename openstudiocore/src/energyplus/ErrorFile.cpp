@@ -28,19 +28,209 @@
 
 #include "ErrorFile.hpp"
 
-#include <boost/regex.hpp>
 #include <boost/algorithm/string.hpp>
 
+#include <cctype>
+#include <cstring>
+
 namespace openstudio {
 namespace energyplus {
 
+  namespace {
+
+    bool isSpace(char c)
+    {
+      return std::isspace(static_cast<unsigned char>(c)) != 0;
+    }
+
+    size_t skipSpace(const std::string& line, size_t pos)
+    {
+      while ((pos < line.size()) && isSpace(line[pos])) {
+        ++pos;
+      }
+      return pos;
+    }
+
+    size_t skipStars(const std::string& line, size_t pos)
+    {
+      while ((pos < line.size()) && (line[pos] == '*')) {
+        ++pos;
+      }
+      return pos;
+    }
+
+    bool startsWith(const std::string& line, size_t pos, const char* text)
+    {
+      size_t n = std::strlen(text);
+      return (line.size() >= pos + n) && (line.compare(pos, n, text) == 0);
+    }
+
+    // Matches the line against "^\s*\**\s+\*\*\s*" + body + "\s*\*\*(.*)$", if body is null it matches
+    // any ([^\s\*]+) which is returned in type. rest is set to the text after the second "**". The
+    // leading whitespace, stars, whitespace prefix can place the first "**" either after the stars
+    // or right after the leading whitespace, the positions are tried in the order a regex would.
+    bool matchMessageLine(const std::string& line, const char* body, std::string& type, std::string& rest)
+    {
+      size_t spaceEnd = skipSpace(line, 0);
+      size_t starsEnd = skipStars(line, spaceEnd);
+      size_t prefixEnd = skipSpace(line, starsEnd);
+
+      size_t candidates[2];
+      unsigned numCandidates = 0;
+      if (prefixEnd > starsEnd) {
+        candidates[numCandidates++] = prefixEnd;
+      }
+      if (spaceEnd > 0) {
+        candidates[numCandidates++] = spaceEnd;
+      }
+
+      for (unsigned i = 0; i < numCandidates; ++i) {
+        size_t pos = candidates[i];
+        if (!startsWith(line, pos, "**")) {
+          continue;
+        }
+        pos = skipSpace(line, pos + 2);
+
+        size_t bodyBegin = pos;
+        if (body) {
+          if (!startsWith(line, pos, body)) {
+            continue;
+          }
+          pos += std::strlen(body);
+        } else {
+          while ((pos < line.size()) && !isSpace(line[pos]) && (line[pos] != '*')) {
+            ++pos;
+          }
+          if (pos == bodyBegin) {
+            continue;
+          }
+        }
+        size_t bodyEnd = pos;
+
+        pos = skipSpace(line, pos);
+        if (!startsWith(line, pos, "**")) {
+          continue;
+        }
+
+        type = line.substr(bodyBegin, bodyEnd - bodyBegin);
+        rest = line.substr(pos + 2);
+        return true;
+      }
+
+      return false;
+    }
+
+    // Matches the line against "^\s*\*+ " + text
+    bool matchStarsLine(const std::string& line, const char* text, size_t& end)
+    {
+      size_t spaceEnd = skipSpace(line, 0);
+      size_t starsEnd = skipStars(line, spaceEnd);
+      if ((starsEnd == spaceEnd) || !startsWith(line, starsEnd, " ")) {
+        return false;
+      }
+      if (!startsWith(line, starsEnd + 1, text)) {
+        return false;
+      }
+      end = starsEnd + 1 + std::strlen(text);
+      return true;
+    }
+
+    // completed successfully
+    bool isCompletedSuccessfully(const std::string& line)
+    {
+      size_t end;
+      if (matchStarsLine(line, "EnergyPlus Completed Successfully", end)) {
+        return true;
+      }
+
+      // ground temp completed successfully, "^\s*\*+ GroundTempCalc\S* Completed Successfully.*"
+      if (matchStarsLine(line, "GroundTempCalc", end)) {
+        while ((end < line.size()) && !isSpace(line[end])) {
+          ++end;
+        }
+        return startsWith(line, end, " Completed Successfully");
+      }
+
+      return false;
+    }
+
+    // completed unsuccessfully
+    bool isTerminated(const std::string& line)
+    {
+      size_t end;
+      return matchStarsLine(line, "EnergyPlus Terminated", end);
+    }
+
+  }
+
+  ErrorMessageGroup::ErrorMessageGroup(const ErrorLevel& t_level, const std::string& t_messageTemplate, const std::string& t_firstMessage)
+    : level(t_level), messageTemplate(t_messageTemplate), firstMessage(t_firstMessage), count(0)
+  {}
+
   /// constructor
   ErrorFile::ErrorFile(const openstudio::path& errPath)
-    : m_completed(false), m_completedSuccessfully(false)
+    : m_path(errPath), m_tail(false), m_offset(0), m_inMessage(false), m_currentLevel(-1),
+      m_completed(false), m_completedSuccessfully(false)
+  {
+    update();
+  }
+
+  ErrorFile::ErrorFile(const openstudio::path& errPath, bool tail)
+    : m_path(errPath), m_tail(tail), m_offset(0), m_inMessage(false), m_currentLevel(-1),
+      m_completed(false), m_completedSuccessfully(false)
   {
-    openstudio::filesystem::ifstream ifs(errPath);
-    parse(ifs);
-    ifs.close();
+    update();
+  }
+
+  bool ErrorFile::update()
+  {
+    if (m_completed) {
+      return false;
+    }
+
+    openstudio::filesystem::ifstream is(m_path, std::ios_base::in | std::ios_base::binary);
+    if (!is.is_open()) {
+      return false;
+    }
+    is.seekg(m_offset);
+    if (!is) {
+      return false;
+    }
+
+    bool result = false;
+    std::vector<char> buffer(1 << 16);
+    while (!m_completed) {
+      is.read(buffer.data(), buffer.size());
+      std::streamsize n = is.gcount();
+      if (n <= 0) {
+        break;
+      }
+      m_offset += n;
+
+      const char* begin = buffer.data();
+      const char* end = begin + n;
+      while ((begin != end) && !m_completed) {
+        const char* newline = static_cast<const char*>(std::memchr(begin, '\n', end - begin));
+        if (!newline) {
+          m_partialLine.append(begin, end);
+          break;
+        }
+        m_partialLine.append(begin, newline);
+        parseLine(m_partialLine);
+        m_partialLine.clear();
+        result = true;
+        begin = newline + 1;
+      }
+    }
+
+    // the file is complete, parse the last line even if it is not terminated
+    if (!m_tail && !m_completed && !m_partialLine.empty()) {
+      parseLine(m_partialLine);
+      m_partialLine.clear();
+      result = true;
+    }
+
+    return result;
   }
 
   /// get warnings
@@ -74,94 +264,142 @@ namespace energyplus {
     return m_completedSuccessfully;
   }
 
-  void ErrorFile::parse(openstudio::filesystem::ifstream& is)
+  std::vector<ErrorMessageGroup> ErrorFile::messageGroups() const
   {
-    std::string line;
-
-
-    // matches[1], warning/error type
-    // matches[2], rest of line
-    boost::regex warningOrError("^\\s*\\**\\s+\\*\\*\\s*([^\\s\\*]+)\\s*\\*\\*(.*)$");
-
-    // matches[1], rest of line
-    boost::regex warningOrErrorContinue("^\\s*\\**\\s+\\*\\*\\s*~~~\\s*\\*\\*(.*)$");
-
-    // completed successfully
-    boost::regex completedSuccessful("^\\s*\\*+ EnergyPlus Completed Successfully.*");
-
-    // ground temp completed successfully
-    boost::regex groundTempCompletedSuccessful("^\\s*\\*+ GroundTempCalc\\S* Completed Successfully.*");
-
-    // completed unsuccessfully
-    boost::regex completedUnsuccessful("^\\s*\\*+ EnergyPlus Terminated.*");
-
-    // repeat count
-
-
-    // read the file line by line using regexes
-    while(std::getline(is, line)){
-
-      boost::smatch matches;
-
-//      LOG(Debug, "Parsing ErrorFile Line: " << line);
-
-
-      // parse the file
-      if (boost::regex_search(line, matches, warningOrError)){
-        std::string warningOrErrorType = std::string(matches[1].first, matches[1].second); boost::trim(warningOrErrorType);
-        std::string warningOrErrorString = std::string(matches[2].first, matches[2].second); boost::trim(warningOrErrorString);
+    return m_messageGroups;
+  }
 
-        // read the rest of the multi line warning or error
-        while(true){
-          std::streampos pos = is.tellg();
-          if (!std::getline(is, line)){
-            break;
+  std::string ErrorFile::messageTemplate(const std::string& message)
+  {
+    std::string result;
+    size_t end = message.find('\n');
+    if (end == std::string::npos) {
+      end = message.size();
+    }
+    result.reserve(end);
+
+    size_t i = 0;
+    while (i < end) {
+      char c = message[i];
+      if (c == '"') {
+        // quoted object name
+        size_t close = message.find('"', i + 1);
+        if ((close != std::string::npos) && (close < end)) {
+          result += "\"*\"";
+          i = close + 1;
+          continue;
+        }
+      } else if (((i == 0) || !std::isalnum(static_cast<unsigned char>(message[i - 1]))) &&
+                 (std::isdigit(static_cast<unsigned char>(c)) ||
+                  (((c == '-') || (c == '+')) && (i + 1 < end) && std::isdigit(static_cast<unsigned char>(message[i + 1]))))) {
+        // signed integer, decimal or exponential number, digits within words such as Doe2 are kept
+        if (!std::isdigit(static_cast<unsigned char>(c))) {
+          ++i;
+        }
+        while ((i < end) && std::isdigit(static_cast<unsigned char>(message[i]))) {
+          ++i;
+        }
+        if ((i + 1 < end) && (message[i] == '.') && std::isdigit(static_cast<unsigned char>(message[i + 1]))) {
+          ++i;
+          while ((i < end) && std::isdigit(static_cast<unsigned char>(message[i]))) {
+            ++i;
           }
-          if (boost::regex_search(line, matches, warningOrErrorContinue)){
-            std::string temp = std::string(matches[1].first, matches[1].second); boost::trim_right(temp);
-            warningOrErrorString += "\n" + temp;
-          }else{
-            // unget the line
-            is.seekg(pos);
-            break;
+        }
+        if ((i + 1 < end) && ((message[i] == 'E') || (message[i] == 'e'))) {
+          size_t j = i + 1;
+          if ((message[j] == '+') || (message[j] == '-')) {
+            ++j;
+          }
+          if ((j < end) && std::isdigit(static_cast<unsigned char>(message[j]))) {
+            i = j;
+            while ((i < end) && std::isdigit(static_cast<unsigned char>(message[i]))) {
+              ++i;
+            }
           }
         }
+        result += '#';
+        continue;
+      }
+      result += c;
+      ++i;
+    }
 
-        LOG(Trace, "Error parsed: " << warningOrErrorString);
+    return result;
+  }
 
+  void ErrorFile::parseLine(const std::string& line)
+  {
+    std::string type;
+    std::string text;
+
+    // read the rest of the multi line warning or error
+    if (m_inMessage && matchMessageLine(line, "~~~", type, text)) {
+      boost::trim_right(text);
+      if (m_currentLevel >= 0) {
+        std::string& message = messages(m_currentLevel).back();
+        message += "\n" + text;
+        if (m_currentGroup) {
+          m_messageGroups[*m_currentGroup].firstMessage = message;
+        }
+      }
+      return;
+    }
 
-        // correctly sort warnings and errors
-        try{
-          ErrorLevel level(warningOrErrorType);
+    m_inMessage = false;
+    m_currentLevel = -1;
+    m_currentGroup.reset();
+
+    if (matchMessageLine(line, nullptr, type, text)) {
+      boost::trim(type);
+      boost::trim(text);
+      addMessage(type, text);
+    } else if (isCompletedSuccessfully(line)) {
+      m_completed = true;
+      m_completedSuccessfully = true;
+    } else if (isTerminated(line)) {
+      m_completed = true;
+      m_completedSuccessfully = false;
+    }
+  }
 
-          switch(level.value()){
-            case ErrorLevel::Warning:
-              m_warnings.push_back(warningOrErrorString);
-              break;
-            case ErrorLevel::Severe:
-              m_severeErrors.push_back(warningOrErrorString);
-              break;
-            case ErrorLevel::Fatal:
-              m_fatalErrors.push_back(warningOrErrorString);
-              break;
-          }
+  void ErrorFile::addMessage(const std::string& type, const std::string& message)
+  {
+    m_inMessage = true;
 
-        }catch(...){
-          LOG(Error, "Unknown warning or error level '" << warningOrErrorType << "'");
-        }
+    LOG(Trace, "Error parsed: " << message);
 
-      }else if (boost::regex_match(line, completedSuccessful) 
-                || boost::regex_match(line, groundTempCompletedSuccessful)) {
-        m_completed = true;
-        m_completedSuccessfully = true;
-        break;
-      }else if (boost::regex_match(line, completedUnsuccessful)){
-        m_completed = true;
-        m_completedSuccessfully = false;
-        break;
-      }
+    // correctly sort warnings and errors
+    boost::optional<ErrorLevel> level;
+    try{
+      level = ErrorLevel(type);
+    }catch(...){
+      LOG(Error, "Unknown warning or error level '" << type << "'");
+      return;
     }
 
+    m_currentLevel = level->value();
+    messages(m_currentLevel).push_back(message);
+
+    std::pair<int, std::string> key(m_currentLevel, messageTemplate(message));
+    auto it = m_messageGroupIndices.find(key);
+    if (it == m_messageGroupIndices.end()) {
+      it = m_messageGroupIndices.insert(std::make_pair(key, m_messageGroups.size())).first;
+      m_messageGroups.push_back(ErrorMessageGroup(*level, key.second, message));
+      m_currentGroup = it->second;
+    }
+    ++m_messageGroups[it->second].count;
+  }
+
+  std::vector<std::string>& ErrorFile::messages(int level)
+  {
+    switch(level){
+      case ErrorLevel::Warning:
+        return m_warnings;
+      case ErrorLevel::Severe:
+        return m_severeErrors;
+      default:
+        return m_fatalErrors;
+    }
   }
 
 } // energyplus
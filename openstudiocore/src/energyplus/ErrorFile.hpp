@@ -35,7 +35,9 @@
 #include "../utilities/core/Enum.hpp"
 #include "../utilities/core/Logger.hpp"
 
+#include <boost/optional.hpp>
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -49,12 +51,40 @@ namespace energyplus {
       ((Severe)) 
       ((Fatal)) );
 
+  /** Warnings or errors of one ErrorLevel whose first lines only differ in numbers or quoted
+   *  names, e.g. the same warning repeated for several objects or timesteps. */
+  struct ENERGYPLUS_API ErrorMessageGroup
+  {
+    ErrorMessageGroup(const ErrorLevel& t_level, const std::string& t_messageTemplate, const std::string& t_firstMessage);
+
+    ErrorLevel level;
+
+    /// first line of the message with numbers replaced by # and quoted names replaced by "*"
+    std::string messageTemplate;
+
+    /// full text of the first message in the group
+    std::string firstMessage;
+
+    /// number of messages in the group
+    unsigned count;
+  };
+
   class ENERGYPLUS_API ErrorFile {
    public:
 
-    /// constructor
+    /// constructor, parses the complete file
     ErrorFile(const openstudio::path& errPath);
 
+    /** Constructor for an error file that may still be written to, e.g. by a running simulation.
+     *  If tail is true only complete lines are parsed, call update() to parse lines appended
+     *  later. If tail is false this is the same as ErrorFile(errPath). */
+    ErrorFile(const openstudio::path& errPath, bool tail);
+
+    /** Parses lines appended to the file since the last parse, only reading the new bytes.
+     *  Returns true if any new lines were parsed. Multi line messages split across calls are
+     *  completed in place. Parsing stops once EnergyPlus reports that it completed. */
+    bool update();
+
     /// get warnings
     std::vector<std::string> warnings() const;
 
@@ -70,11 +100,33 @@ namespace energyplus {
     /// completed successfully
     bool completedSuccessfully() const;
 
+    /// warnings and errors grouped by message template, in order of first occurrence
+    std::vector<ErrorMessageGroup> messageGroups() const;
+
+    /// get the message template used to group a warning or error
+    static std::string messageTemplate(const std::string& message);
+
    private:
 
     REGISTER_LOGGER("energyplus.ErrorFile");
 
-    void parse(openstudio::filesystem::ifstream& is);
+    void parseLine(const std::string& line);
+
+    void addMessage(const std::string& type, const std::string& message);
+
+    std::vector<std::string>& messages(int level);
+
+    openstudio::path m_path;
+    bool m_tail;
+    std::streamoff m_offset;
+    std::string m_partialLine;
+
+    // set while continuation lines belong to the last message, which is the last entry in the
+    // vector for m_currentLevel, or which is skipped if its level is unknown (m_currentLevel < 0)
+    bool m_inMessage;
+    int m_currentLevel;
+    // index into m_messageGroups if the last message is the first one of its group
+    boost::optional<size_t> m_currentGroup;
 
     std::vector<std::string> m_warnings;
     std::vector<std::string> m_severeErrors;
@@ -82,6 +134,9 @@ namespace energyplus {
     bool m_completed;
     bool m_completedSuccessfully;
 
+    std::vector<ErrorMessageGroup> m_messageGroups;
+    std::map<std::pair<int, std::string>, size_t> m_messageGroupIndices;
+
   };
 
 } // energyplus
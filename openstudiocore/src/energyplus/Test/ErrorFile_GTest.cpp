@@ -38,6 +38,8 @@
 #include <sstream>
 
 using openstudio::energyplus::ErrorFile;
+using openstudio::energyplus::ErrorLevel;
+using openstudio::energyplus::ErrorMessageGroup;
 
 TEST_F(EnergyPlusFixture,ErrorFile_NoErrorsNoWarnings)
 {
@@ -113,4 +115,79 @@ TEST_F(EnergyPlusFixture,ErrorFile_WarningsAndCrash)
   EXPECT_FALSE(errorFile.completedSuccessfully());
 }
 
+TEST_F(EnergyPlusFixture,ErrorFile_MessageGroups)
+{
+  openstudio::path path = resourcesPath() / openstudio::toPath("energyplus/ErrorFiles/RepeatingWarnings.err");
+
+  ErrorFile errorFile(path);
+  ASSERT_EQ(static_cast<unsigned>(52), errorFile.warnings().size());
+  EXPECT_EQ(static_cast<unsigned>(0), errorFile.severeErrors().size());
+  EXPECT_EQ(static_cast<unsigned>(0), errorFile.fatalErrors().size());
+  EXPECT_TRUE(errorFile.completed());
+  EXPECT_TRUE(errorFile.completedSuccessfully());
+
+  std::vector<ErrorMessageGroup> groups = errorFile.messageGroups();
+  ASSERT_EQ(static_cast<unsigned>(11), groups.size());
+
+  unsigned count = 0;
+  for (const ErrorMessageGroup& group : groups) {
+    EXPECT_EQ(ErrorLevel::Warning, group.level.value());
+    count += group.count;
+  }
+  EXPECT_EQ(static_cast<unsigned>(52), count);
 
+  EXPECT_EQ("GetSurfaces: Surfaces with interface to Ground found but no \"*\" were input.", groups[1].messageTemplate);
+  EXPECT_EQ(static_cast<unsigned>(1), groups[1].count);
+  EXPECT_EQ("GetSurfaces: Surfaces with interface to Ground found but no \"Ground Temperatures\" were input.\n Found first in surface=SURFACE 21\n Defaults, constant throughout the year of (18.0) will be used.",
+            groups[1].firstMessage);
+
+  EXPECT_EQ(static_cast<unsigned>(12), groups[5].count);
+  EXPECT_EQ(static_cast<unsigned>(13), groups[7].count);
+  EXPECT_EQ("SimHVAC: Maximum iterations (#) exceeded for all HVAC loops, at RUN PERIOD #, #/# #:# - #:#", groups[7].messageTemplate);
+}
+
+TEST_F(EnergyPlusFixture,ErrorFile_MessageTemplate)
+{
+  EXPECT_EQ("CalcDoe2DXCoil: Coil \"*\" - below # C. Outdoor = #",
+            ErrorFile::messageTemplate("CalcDoe2DXCoil: Coil \"COIL 3\" - below 0 C. Outdoor = -3.80\n continued 12"));
+  EXPECT_EQ("x=#, y=#, at #/# #:# - #:#", ErrorFile::messageTemplate("x=1.5E-002, y=+7, at 01/21 21:10 - 21:12"));
+}
+
+TEST_F(EnergyPlusFixture,ErrorFile_Tail)
+{
+  openstudio::path source = resourcesPath() / openstudio::toPath("energyplus/ErrorFiles/WarningsAndSevere.err");
+  openstudio::path path = openstudio::toPath("./ErrorFile_Tail.err");
+
+  std::string contents;
+  {
+    openstudio::filesystem::ifstream ifs(source, std::ios_base::in | std::ios_base::binary);
+    std::stringstream ss;
+    ss << ifs.rdbuf();
+    contents = ss.str();
+  }
+  ASSERT_FALSE(contents.empty());
+
+  openstudio::filesystem::ofstream ofs(path, std::ios_base::out | std::ios_base::trunc | std::ios_base::binary);
+
+  ErrorFile errorFile(path, true);
+  EXPECT_TRUE(errorFile.warnings().empty());
+  EXPECT_FALSE(errorFile.completed());
+  EXPECT_FALSE(errorFile.update());
+
+  // append the file in chunks that split lines and multi line messages
+  for (size_t pos = 0; pos < contents.size(); pos += 97) {
+    ofs << contents.substr(pos, 97);
+    ofs.flush();
+    errorFile.update();
+  }
+  ofs.close();
+  errorFile.update();
+
+  ErrorFile expected(source);
+  EXPECT_EQ(expected.warnings(), errorFile.warnings());
+  EXPECT_EQ(expected.severeErrors(), errorFile.severeErrors());
+  EXPECT_EQ(expected.fatalErrors(), errorFile.fatalErrors());
+  EXPECT_EQ(expected.completed(), errorFile.completed());
+  EXPECT_EQ(expected.completedSuccessfully(), errorFile.completedSuccessfully());
+  EXPECT_EQ(expected.messageGroups().size(), errorFile.messageGroups().size());
+}
@@ -55,7 +55,7 @@
 namespace openstudio {
 namespace gbxml {
  
-  boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateConstruction(const QDomElement& element, const QDomNodeList& layerElements, const QDomDocument& doc, openstudio::model::Model& model)
+  boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateConstruction(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model)
   {
     // Krishnan, this constructor should only be used for unique objects like Building and Site
     //openstudio::model::Construction construction = model.getUniqueModelObject<openstudio::model::Construction>();
@@ -76,20 +76,17 @@ namespace gbxml {
     QString layerId = layerIdList.at(0).toElement().attribute("layerIdRef");
 
     std::vector<openstudio::model::Material> materials;
-    for (int i = 0; i < layerElements.count(); i++){
-      QDomElement layerElement = layerElements.at(i).toElement();
-      if (layerId == layerElement.attribute("id")){
-        QDomNodeList materialIdElements = layerElement.elementsByTagName("MaterialId");
-        for (int j = 0; j < materialIdElements.count(); j++){
-          QString materialId = materialIdElements.at(j).toElement().attribute("materialIdRef");
-          auto materialIt = m_idToObjectMap.find(materialId);
-          if (materialIt != m_idToObjectMap.end()){
-            boost::optional<openstudio::model::Material> material = materialIt->second.optionalCast<openstudio::model::Material>();
-            OS_ASSERT(material); // Krishnan, what type of error handling do you want?
-            materials.push_back(*material);
-          }
+    auto layerIt = m_idToElementMap.find(layerId);
+    if ((layerIt != m_idToElementMap.end()) && (layerIt->second.tagName() == "Layer")){
+      QDomNodeList materialIdElements = layerIt->second.elementsByTagName("MaterialId");
+      for (int j = 0; j < materialIdElements.count(); j++){
+        QString materialId = materialIdElements.at(j).toElement().attribute("materialIdRef");
+        auto materialIt = m_idToObjectMap.find(materialId);
+        if (materialIt != m_idToObjectMap.end()){
+          boost::optional<openstudio::model::Material> material = materialIt->second.optionalCast<openstudio::model::Material>();
+          OS_ASSERT(material); // Krishnan, what type of error handling do you want?
+          materials.push_back(*material);
         }
-        break;
       }
     }
 
@@ -122,54 +122,47 @@ namespace gbxml {
       QString dayType = dayElements.at(i).toElement().attribute("dayType");
       QString dayScheduleIdRef = dayElements.at(i).toElement().attribute("dayScheduleIdRef");
 
-      // this can be made more efficient using QXPath in QXmlPatterns later
-      QDomNodeList dayScheduleElements = doc.documentElement().elementsByTagName("DaySchedule");
-      for (int i = 0; i < dayScheduleElements.count(); i++){
-        QDomElement dayScheduleElement = dayScheduleElements.at(i).toElement();
-        QString thisId = dayScheduleElement.attribute("id");
-        if (thisId == dayScheduleIdRef){
-
-          boost::optional<openstudio::model::ModelObject> modelObject = translateScheduleDay(dayScheduleElement, doc, model);          
-          if (modelObject){
+      auto dayScheduleIt = m_idToElementMap.find(dayScheduleIdRef);
+      if ((dayScheduleIt != m_idToElementMap.end()) && (dayScheduleIt->second.tagName() == "DaySchedule")){
+        QDomElement dayScheduleElement = dayScheduleIt->second;
+        boost::optional<openstudio::model::ModelObject> modelObject = translateScheduleDay(dayScheduleElement, doc, model);          
+        if (modelObject){
+          
+          boost::optional<openstudio::model::ScheduleDay> scheduleDay = modelObject->cast<openstudio::model::ScheduleDay>();
+          if (scheduleDay){
             
-            boost::optional<openstudio::model::ScheduleDay> scheduleDay = modelObject->cast<openstudio::model::ScheduleDay>();
-            if (scheduleDay){
-              
-              if (dayType == "Weekday"){
-                result.setWeekdaySchedule(*scheduleDay);
-              }else if (dayType == "Weekend"){
-                result.setWeekendSchedule(*scheduleDay);
-              }else if (dayType == "Holiday"){
-                result.setHolidaySchedule(*scheduleDay);
-              }else if (dayType == "WeekendOrHoliday"){
-                result.setWeekendSchedule(*scheduleDay);
-                result.setHolidaySchedule(*scheduleDay);
-              }else if (dayType == "HeatingDesignDay"){
-                result.setWinterDesignDaySchedule(*scheduleDay);
-              }else if (dayType == "CoolingDesignDay"){
-                result.setSummerDesignDaySchedule(*scheduleDay);
-              }else if (dayType == "Sun"){
-                result.setSundaySchedule(*scheduleDay);
-              }else if (dayType == "Mon"){
-                result.setMondaySchedule(*scheduleDay);
-              }else if (dayType == "Tue"){
-                result.setTuesdaySchedule(*scheduleDay);
-              }else if (dayType == "Wed"){
-                result.setWednesdaySchedule(*scheduleDay);
-              }else if (dayType == "Thu"){
-                result.setThursdaySchedule(*scheduleDay);
-              }else if (dayType == "Fri"){
-                result.setFridaySchedule(*scheduleDay);
-              }else if (dayType == "Sat"){
-                result.setSaturdaySchedule(*scheduleDay);
-              }else{
-                // dayType can be "All"
-                result.setAllSchedules(*scheduleDay);
-              }
+            if (dayType == "Weekday"){
+              result.setWeekdaySchedule(*scheduleDay);
+            }else if (dayType == "Weekend"){
+              result.setWeekendSchedule(*scheduleDay);
+            }else if (dayType == "Holiday"){
+              result.setHolidaySchedule(*scheduleDay);
+            }else if (dayType == "WeekendOrHoliday"){
+              result.setWeekendSchedule(*scheduleDay);
+              result.setHolidaySchedule(*scheduleDay);
+            }else if (dayType == "HeatingDesignDay"){
+              result.setWinterDesignDaySchedule(*scheduleDay);
+            }else if (dayType == "CoolingDesignDay"){
+              result.setSummerDesignDaySchedule(*scheduleDay);
+            }else if (dayType == "Sun"){
+              result.setSundaySchedule(*scheduleDay);
+            }else if (dayType == "Mon"){
+              result.setMondaySchedule(*scheduleDay);
+            }else if (dayType == "Tue"){
+              result.setTuesdaySchedule(*scheduleDay);
+            }else if (dayType == "Wed"){
+              result.setWednesdaySchedule(*scheduleDay);
+            }else if (dayType == "Thu"){
+              result.setThursdaySchedule(*scheduleDay);
+            }else if (dayType == "Fri"){
+              result.setFridaySchedule(*scheduleDay);
+            }else if (dayType == "Sat"){
+              result.setSaturdaySchedule(*scheduleDay);
+            }else{
+              // dayType can be "All"
+              result.setAllSchedules(*scheduleDay);
             }
           }
-
-          break;
         }
       }
     }
@@ -217,23 +210,16 @@ namespace gbxml {
       
       QString weekScheduleId = element.elementsByTagName("WeekScheduleId").at(0).toElement().attribute("weekScheduleIdRef");
 
-      // this can be made more efficient using QXPath in QXmlPatterns later
-      QDomNodeList scheduleWeekElements = doc.documentElement().elementsByTagName("WeekSchedule");
-      for (int i = 0; i < scheduleWeekElements.count(); i++){
-        QDomElement scheduleWeekElement = scheduleWeekElements.at(i).toElement();
-        QString thisId = scheduleWeekElement.attribute("id");
-        if (thisId == weekScheduleId){
-
-          boost::optional<openstudio::model::ModelObject> modelObject = translateScheduleWeek(scheduleWeekElement, doc, model);          
-          if (modelObject){
-            
-            boost::optional<openstudio::model::ScheduleWeek> scheduleWeek = modelObject->cast<openstudio::model::ScheduleWeek>();
-            if (scheduleWeek){
-              result.addScheduleWeek(endDate, *scheduleWeek);
-            }
+      auto scheduleWeekIt = m_idToElementMap.find(weekScheduleId);
+      if ((scheduleWeekIt != m_idToElementMap.end()) && (scheduleWeekIt->second.tagName() == "WeekSchedule")){
+        QDomElement scheduleWeekElement = scheduleWeekIt->second;
+        boost::optional<openstudio::model::ModelObject> modelObject = translateScheduleWeek(scheduleWeekElement, doc, model);          
+        if (modelObject){
+          
+          boost::optional<openstudio::model::ScheduleWeek> scheduleWeek = modelObject->cast<openstudio::model::ScheduleWeek>();
+          if (scheduleWeek){
+            result.addScheduleWeek(endDate, *scheduleWeek);
           }
-
-          break;
         }
       }
     }
@@ -69,7 +69,10 @@
 
 #include <QDomDocument>
 #include <QDomElement>
+#include <QFile>
+#include <QSet>
 #include <QThread>
+#include <QXmlStreamReader>
 
 namespace openstudio {
 namespace gbxml {
@@ -117,6 +120,33 @@ namespace gbxml {
       }
     }
 
+    clearMaps();
+
+    return result;
+  }
+
+  boost::optional<openstudio::model::Model> ReverseTranslator::loadModelStreaming(const openstudio::path& path, ProgressBar* progressBar)
+  {
+    m_progressBar = progressBar;
+
+    m_logSink.setThreadId(QThread::currentThread());
+
+    m_logSink.resetStringStream();
+
+    boost::optional<openstudio::model::Model> result;
+
+    if (openstudio::filesystem::exists(path)){
+
+      QFile file(toQString(path));
+      if (file.open(QFile::ReadOnly)) {
+        QXmlStreamReader reader(&file);
+
+        result = this->convert(reader, path);
+      }
+    }
+
+    clearMaps();
+
     return result;
   }
 
@@ -157,16 +187,329 @@ namespace gbxml {
     return value.replace(',', '-').replace(';', '-').toStdString();
   }
 
+  void ReverseTranslator::clearMaps()
+  {
+    m_idToObjectMap.clear();
+    m_idToElementMap.clear();
+    m_airWallConstructionHandle.reset();
+  }
+
+  void ReverseTranslator::buildElementIndex(const QDomElement& element)
+  {
+    // these elements are referenced by id from other elements, index them once rather than searching for each reference
+    for (const QString& tagName : {QString("Layer"), QString("DaySchedule"), QString("WeekSchedule")}){
+      QDomNodeList elements = element.elementsByTagName(tagName);
+      for (int i = 0; i < elements.count(); i++){
+        QDomElement indexedElement = elements.at(i).toElement();
+        m_idToElementMap.insert(std::make_pair(indexedElement.attribute("id"), indexedElement));
+      }
+    }
+  }
+
+  model::Construction ReverseTranslator::airWallConstruction(openstudio::model::Model& model)
+  {
+    if (m_airWallConstructionHandle){
+      boost::optional<model::Construction> airWall = model.getModelObject<model::Construction>(*m_airWallConstructionHandle);
+      if (airWall){
+        return *airWall;
+      }
+    }
+
+    boost::optional<model::Construction> airWall;
+
+    for (const auto& construction : model.getConcreteModelObjects<model::Construction>()){
+      if ((construction.numLayers() == 1) && (construction.isModelPartition())) {
+        model::MaterialVector layers = construction.layers();
+        OS_ASSERT(layers.size() == 1u);
+        if (layers[0].optionalCast<model::AirWallMaterial>()){
+          airWall = construction;
+          break;
+        }
+      }
+    }
+    if (!airWall){
+      airWall = model::Construction(model);
+      model::AirWallMaterial airWallMaterial(model);
+      airWall->setLayer(airWallMaterial);
+    }
+
+    m_airWallConstructionHandle = airWall->handle();
+
+    return *airWall;
+  }
+
+  // Read the current start element of reader, including all of its children, into doc.
+  // The reader is left at the matching end element.
+  static QDomElement readElement(QXmlStreamReader& reader, QDomDocument& doc)
+  {
+    QDomElement element = doc.createElement(reader.qualifiedName().toString());
+    for (const QXmlStreamAttribute& attribute : reader.attributes()){
+      element.setAttribute(attribute.qualifiedName().toString(), attribute.value().toString());
+    }
+
+    while (!reader.atEnd()){
+      QXmlStreamReader::TokenType tokenType = reader.readNext();
+      if (tokenType == QXmlStreamReader::StartElement){
+        element.appendChild(readElement(reader, doc));
+      }else if (tokenType == QXmlStreamReader::Characters && !reader.isWhitespace()){
+        element.appendChild(doc.createTextNode(reader.text().toString()));
+      }else if (tokenType == QXmlStreamReader::EndElement){
+        break;
+      }
+    }
+
+    return element;
+  }
+
+  // Advance reader to the next start element that is a child of the current element, returns false at the end of the current element
+  static bool readNextChildElement(QXmlStreamReader& reader)
+  {
+    while (!reader.atEnd()){
+      QXmlStreamReader::TokenType tokenType = reader.readNext();
+      if (tokenType == QXmlStreamReader::StartElement){
+        return true;
+      }else if (tokenType == QXmlStreamReader::EndElement){
+        return false;
+      }
+    }
+    return false;
+  }
+
   boost::optional<model::Model> ReverseTranslator::convert(const QDomDocument& doc)
   {
     return translateGBXML(doc.documentElement(), doc);
   }
 
+  boost::optional<model::Model> ReverseTranslator::convert(QXmlStreamReader& reader, const openstudio::path& path)
+  {
+    // first pass, keep the elements that must be translated before the geometry and count the geometry for progress
+    QSet<QString> resourceTagNames;
+    resourceTagNames << "Construction" << "Layer" << "Material" << "WindowType" << "Schedule" << "WeekSchedule" << "DaySchedule" << "Zone";
+
+    QDomDocument resourceDoc;
+    QDomElement gbXMLElement;
+    int numStories = 0;
+    int numSpaces = 0;
+    int numSurfaces = 0;
+    int numCampuses = 0;
+
+    if (!readNextChildElement(reader)){
+      LOG(Error, "Could not read gbXML root element from '" << toString(path) << "'");
+      return boost::none;
+    }
+
+    gbXMLElement = resourceDoc.createElement(reader.qualifiedName().toString());
+    for (const QXmlStreamAttribute& attribute : reader.attributes()){
+      gbXMLElement.setAttribute(attribute.qualifiedName().toString(), attribute.value().toString());
+    }
+    resourceDoc.appendChild(gbXMLElement);
+
+    while (readNextChildElement(reader)){
+      QString tagName = reader.qualifiedName().toString();
+      if (resourceTagNames.contains(tagName)){
+        gbXMLElement.appendChild(readElement(reader, resourceDoc));
+      }else if (tagName == "Campus"){
+        ++numCampuses;
+        int depth = 1;
+        while (depth > 0 && !reader.atEnd()){
+          QXmlStreamReader::TokenType tokenType = reader.readNext();
+          if (tokenType == QXmlStreamReader::StartElement){
+            ++depth;
+            QStringRef name = reader.qualifiedName();
+            if (name == "BuildingStorey"){
+              ++numStories;
+            }else if (name == "Space"){
+              ++numSpaces;
+            }else if (name == "Surface"){
+              ++numSurfaces;
+            }
+          }else if (tokenType == QXmlStreamReader::EndElement){
+            --depth;
+          }
+        }
+      }else{
+        reader.skipCurrentElement();
+      }
+    }
+
+    if (reader.hasError()){
+      LOG(Error, "Error reading gbXML file '" << toString(path) << "' at line " << reader.lineNumber() << ": " << toString(reader.errorString()));
+      return boost::none;
+    }
+
+    if (numCampuses != 1){
+      LOG(Error, "gbXML file '" << toString(path) << "' has " << numCampuses << " Campus elements, expected 1");
+      return boost::none;
+    }
+
+    openstudio::model::Model model;
+    model.setFastNaming(true);
+
+    translateUnits(gbXMLElement);
+    translateResources(gbXMLElement, resourceDoc, model);
+
+    // second pass, translate the geometry one element at a time
+    QIODevice* device = reader.device();
+    device->reset();
+    reader.setDevice(device);
+
+    openstudio::model::Facility facility = model.getUniqueModelObject<openstudio::model::Facility>();
+
+    // move to the Campus element
+    bool foundCampus = false;
+    if (readNextChildElement(reader)){
+      while (readNextChildElement(reader)){
+        if (reader.qualifiedName() == "Campus"){
+          foundCampus = true;
+          break;
+        }
+        reader.skipCurrentElement();
+      }
+    }
+    OS_ASSERT(foundCampus);
+
+    // elements are translated in document order, so references to elements that come later are
+    // resolved once the building is done: spaces listed before their story, and surfaces listed
+    // before the building's spaces
+    std::vector<std::pair<model::Space, QString> > unresolvedStories;
+    std::vector<std::pair<QDomDocument, QDomElement> > pendingSurfaces;
+
+    bool foundBuilding = false;
+    while (readNextChildElement(reader)){
+      QStringRef tagName = reader.qualifiedName();
+      if (tagName == "Building"){
+        OS_ASSERT(!foundBuilding);
+        foundBuilding = true;
+
+        // the building element without its stories and spaces
+        QDomDocument buildingDoc;
+        QDomElement buildingElement = buildingDoc.createElement(reader.qualifiedName().toString());
+        for (const QXmlStreamAttribute& attribute : reader.attributes()){
+          buildingElement.setAttribute(attribute.qualifiedName().toString(), attribute.value().toString());
+        }
+        buildingDoc.appendChild(buildingElement);
+
+        if (m_progressBar){
+          m_progressBar->setWindowTitle(toString("Translating Building Stories and Spaces"));
+          m_progressBar->setMinimum(0);
+          m_progressBar->setMaximum(numStories + numSpaces);
+          m_progressBar->setValue(0);
+        }
+
+        while (readNextChildElement(reader)){
+          QStringRef childTagName = reader.qualifiedName();
+          if (childTagName == "BuildingStorey"){
+            QDomDocument storyDoc;
+            QDomElement storyElement = readElement(reader, storyDoc);
+            boost::optional<model::ModelObject> story = translateBuildingStory(storyElement, storyDoc, model);
+            OS_ASSERT(story);
+
+            if (m_progressBar){
+              m_progressBar->setValue(m_progressBar->value() + 1);
+            }
+          }else if (childTagName == "Space"){
+            QDomDocument spaceDoc;
+            QDomElement spaceElement = readElement(reader, spaceDoc);
+            boost::optional<model::ModelObject> space = translateSpace(spaceElement, spaceDoc, model);
+            OS_ASSERT(space);
+
+            QString storyId = spaceElement.attribute("buildingStoreyIdRef");
+            if (!storyId.isEmpty() && !space->cast<model::Space>().buildingStory()){
+              unresolvedStories.push_back(std::make_pair(space->cast<model::Space>(), storyId));
+            }
+
+            if (m_progressBar){
+              m_progressBar->setValue(m_progressBar->value() + 1);
+            }
+          }else{
+            buildingElement.appendChild(readElement(reader, buildingDoc));
+          }
+        }
+
+        boost::optional<model::ModelObject> building = translateBuilding(buildingElement, buildingDoc, model);
+        OS_ASSERT(building);
+
+        for (auto& unresolvedStory : unresolvedStories){
+          auto storyIt = m_idToObjectMap.find(unresolvedStory.second);
+          if (storyIt != m_idToObjectMap.end()){
+            boost::optional<model::BuildingStory> story = storyIt->second.optionalCast<model::BuildingStory>();
+            if (story){
+              unresolvedStory.first.setBuildingStory(*story);
+            }
+          }
+        }
+        unresolvedStories.clear();
+
+        if (m_progressBar){
+          m_progressBar->setWindowTitle(toString("Translating Surfaces"));
+          m_progressBar->setMinimum(0);
+          m_progressBar->setMaximum(numSurfaces);
+          m_progressBar->setValue(0);
+        }
+
+        for (const auto& pendingSurface : pendingSurfaces){
+          translateStreamedSurface(pendingSurface.second, pendingSurface.first, model);
+        }
+        pendingSurfaces.clear();
+
+      }else if (tagName == "Surface"){
+        QDomDocument surfaceDoc;
+        QDomElement surfaceElement = readElement(reader, surfaceDoc);
+        if (foundBuilding){
+          translateStreamedSurface(surfaceElement, surfaceDoc, model);
+        }else{
+          pendingSurfaces.push_back(std::make_pair(surfaceDoc, surfaceElement));
+        }
+      }else{
+        reader.skipCurrentElement();
+      }
+    }
+    OS_ASSERT(foundBuilding);
+
+    if (reader.hasError()){
+      LOG(Error, "Error reading gbXML file '" << toString(path) << "' at line " << reader.lineNumber() << ": " << toString(reader.errorString()));
+      return boost::none;
+    }
+
+    model.setFastNaming(false);
+
+    return model;
+  }
+
+  void ReverseTranslator::translateStreamedSurface(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model)
+  {
+    try {
+      translateSurface(element, doc, model);
+    }catch(const std::exception&){
+      LOG(Error, "Could not translate surface " << element);
+    }
+
+    if (m_progressBar){
+      m_progressBar->setValue(m_progressBar->value() + 1);
+    }
+  }
+
   boost::optional<model::Model> ReverseTranslator::translateGBXML(const QDomElement& element, const QDomDocument& doc)
   {
     openstudio::model::Model model;
     model.setFastNaming(true);
 
+    translateUnits(element);
+    translateResources(element, doc, model);
+
+    QDomNodeList campusElements = element.elementsByTagName("Campus");
+    OS_ASSERT(campusElements.count() == 1);
+    QDomElement campusElement = campusElements.at(0).toElement();
+    boost::optional<model::ModelObject> facility = translateCampus(campusElement, doc, model);
+    OS_ASSERT(facility); // Krishnan, what type of error handling do you want?
+
+    model.setFastNaming(false);
+
+    return model;
+  }
+
+  void ReverseTranslator::translateUnits(const QDomElement& element)
+  {
     // gbXML attributes not mapped directly to IDF, but needed to map
 
     // {F, C, K, R}
@@ -227,6 +570,11 @@ namespace gbxml {
     }else{
       m_useSIUnitsForResults = true;
     }
+  }
+
+  void ReverseTranslator::translateResources(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model)
+  {
+    buildElementIndex(element);
 
     // do materials before constructions 
     QDomNodeList materialElements = element.elementsByTagName("Material");
@@ -248,7 +596,6 @@ namespace gbxml {
     }
 
     // do constructions before surfaces
-    QDomNodeList layerElements = element.elementsByTagName("Layer");
     QDomNodeList constructionElements = element.elementsByTagName("Construction");
     if (m_progressBar){
       m_progressBar->setWindowTitle(toString("Translating Constructions"));
@@ -259,7 +606,7 @@ namespace gbxml {
 
     for (int i = 0; i < constructionElements.count(); i++){
       QDomElement constructionElement = constructionElements.at(i).toElement();
-      boost::optional<model::ModelObject> construction = translateConstruction(constructionElement, layerElements, doc, model);
+      boost::optional<model::ModelObject> construction = translateConstruction(constructionElement, doc, model);
       OS_ASSERT(construction); // Krishnan, what type of error handling do you want?
       
       if (m_progressBar){
@@ -323,16 +670,6 @@ namespace gbxml {
         m_progressBar->setValue(m_progressBar->value() + 1);
       }
     }
-
-    QDomNodeList campusElements = element.elementsByTagName("Campus");
-    OS_ASSERT(campusElements.count() == 1);
-    QDomElement campusElement = campusElements.at(0).toElement();
-    boost::optional<model::ModelObject> facility = translateCampus(campusElement, doc, model);
-    OS_ASSERT(facility); // Krishnan, what type of error handling do you want?
-
-    model.setFastNaming(false);
-
-    return model;
   }
 
   boost::optional<model::ModelObject> ReverseTranslator::translateCampus(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model)
@@ -646,24 +983,7 @@ namespace gbxml {
 
       // if air wall
       if (surfaceType.contains("Air")){
-        boost::optional<model::Construction> airWall;
-
-        for (const auto& construction : model.getConcreteModelObjects<model::Construction>()){
-          if ((construction.numLayers() == 1) && (construction.isModelPartition())) {
-            model::MaterialVector layers = construction.layers();
-            OS_ASSERT(layers.size() == 1u);
-            if (layers[0].optionalCast<model::AirWallMaterial>()){
-              airWall = construction;
-              break;
-            }
-          }
-        }
-        if (!airWall){
-          airWall = model::Construction(model);
-          model::AirWallMaterial airWallMaterial(model);
-          airWall->setLayer(airWallMaterial);
-        }
-        surface.setConstruction(*airWall);
+        surface.setConstruction(airWallConstruction(model));
 
         // don't translate subsurfaces of air walls?
 
@@ -800,24 +1120,7 @@ namespace gbxml {
 
     // if air wall
     if (openingType.contains("Air")){
-      boost::optional<model::Construction> airWall;
-
-      for (const auto& construction : model.getConcreteModelObjects<model::Construction>()){
-        if ((construction.numLayers() == 1) && (construction.isModelPartition())) {
-          model::MaterialVector layers = construction.layers();
-          OS_ASSERT(layers.size() == 1u);
-          if (layers[0].optionalCast<model::AirWallMaterial>()){
-            airWall = construction;
-            break;
-          }
-        }
-      }
-      if (!airWall){
-        airWall = model::Construction(model);
-        model::AirWallMaterial airWallMaterial(model);
-        airWall->setLayer(airWallMaterial);
-      }
-      subSurface.setConstruction(*airWall);
+      subSurface.setConstruction(airWallConstruction(model));
       
     } else{
 
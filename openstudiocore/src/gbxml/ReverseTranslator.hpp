@@ -37,12 +37,15 @@
 #include "../utilities/core/Optional.hpp"
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/StringStreamLogSink.hpp"
+#include "../utilities/idf/Handle.hpp"
 
 #include "../utilities/units/Unit.hpp"
 
+#include <QDomElement>
+
 class QDomDocument;
-class QDomElement;
 class QDomNodeList;
+class QXmlStreamReader;
 
 namespace openstudio {
 
@@ -52,6 +55,7 @@ namespace model {
   class Model;
   class ModelObject;
   class Surface;
+  class Construction;
 }
 
 namespace gbxml {
@@ -64,6 +68,12 @@ namespace gbxml {
     virtual ~ReverseTranslator();
     
     boost::optional<openstudio::model::Model> loadModel(const openstudio::path& path, ProgressBar* progressBar = nullptr);
+
+    /** Translates the gbXML file at path without loading the entire document into memory. The file is
+     *  read twice with a pull parser, once to collect the small resource elements (materials, constructions,
+     *  schedules, zones, etc.) and once to translate the Campus geometry one element at a time. The resulting
+     *  model is the same as loadModel, this is intended for very large files. */
+    boost::optional<openstudio::model::Model> loadModelStreaming(const openstudio::path& path, ProgressBar* progressBar = nullptr);
     
     /** Get warning messages generated by the last translation. */
     std::vector<LogMessage> warnings() const;
@@ -86,13 +96,27 @@ namespace gbxml {
 
     std::map<QString, openstudio::model::ModelObject> m_idToObjectMap;
 
+    // id to element for the elements that are looked up by reference (Layer, DaySchedule, WeekSchedule)
+    std::map<QString, QDomElement> m_idToElementMap;
+
+    // handle of the air wall construction, created on first use
+    boost::optional<openstudio::Handle> m_airWallConstructionHandle;
+
+    void clearMaps();
+    void buildElementIndex(const QDomElement& element);
+    openstudio::model::Construction airWallConstruction(openstudio::model::Model& model);
+
     boost::optional<openstudio::model::Model> convert(const QDomDocument& doc);
+    boost::optional<openstudio::model::Model> convert(QXmlStreamReader& reader, const openstudio::path& path);
+    void translateStreamedSurface(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
     boost::optional<openstudio::model::Model> translateGBXML(const QDomElement& element, const QDomDocument& doc);
+    void translateUnits(const QDomElement& element);
+    void translateResources(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateCampus(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateBuilding(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateBuildingStory(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateThermalZone(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
-    boost::optional<openstudio::model::ModelObject> translateConstruction(const QDomElement& element, const QDomNodeList& layerElements, const QDomDocument& doc, openstudio::model::Model& model);
+    boost::optional<openstudio::model::ModelObject> translateConstruction(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateWindowType(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateMaterial(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
     boost::optional<openstudio::model::ModelObject> translateScheduleDay(const QDomElement& element, const QDomDocument& doc, openstudio::model::Model& model);
@@ -39,6 +39,8 @@
 #include "../../model/Facility_Impl.hpp"
 #include "../../model/Building.hpp"
 #include "../../model/Building_Impl.hpp"
+#include "../../model/BuildingStory.hpp"
+#include "../../model/BuildingStory_Impl.hpp"
 #include "../../model/ThermalZone.hpp"
 #include "../../model/ThermalZone_Impl.hpp"
 #include "../../model/Space.hpp"
@@ -51,6 +53,7 @@
 
 #include <resources.hxx>
 
+#include <fstream>
 #include <sstream>
 
 using namespace openstudio::energyplus;
@@ -141,3 +144,93 @@ TEST_F(gbXMLFixture, ReverseTranslator_TwoStoryOffice_Trane)
   bool test = forwardTranslator.modelToGbXML(*model, outputPath);
   EXPECT_TRUE(test);
 }
+
+TEST_F(gbXMLFixture, ReverseTranslator_Streaming)
+{
+  std::vector<std::string> files;
+  files.push_back("gbxml/ZNETH.xml");
+  files.push_back("gbxml/simpleBox_vasari.xml");
+  files.push_back("gbxml/TwoStoryOffice_Trane.xml");
+
+  for (const std::string& file : files){
+    openstudio::path inputPath = resourcesPath() / openstudio::toPath(file);
+
+    openstudio::gbxml::ReverseTranslator reverseTranslator;
+    boost::optional<openstudio::model::Model> model = reverseTranslator.loadModel(inputPath);
+    ASSERT_TRUE(model);
+
+    boost::optional<openstudio::model::Model> streamedModel = reverseTranslator.loadModelStreaming(inputPath);
+    ASSERT_TRUE(streamedModel);
+
+    EXPECT_EQ(model->numObjects(), streamedModel->numObjects()) << file;
+    EXPECT_EQ(model->getConcreteModelObjects<Space>().size(), streamedModel->getConcreteModelObjects<Space>().size()) << file;
+    EXPECT_EQ(model->getConcreteModelObjects<Surface>().size(), streamedModel->getConcreteModelObjects<Surface>().size()) << file;
+    EXPECT_EQ(model->getConcreteModelObjects<ThermalZone>().size(), streamedModel->getConcreteModelObjects<ThermalZone>().size()) << file;
+    EXPECT_EQ(model->getUniqueModelObject<Building>().name().get(), streamedModel->getUniqueModelObject<Building>().name().get()) << file;
+
+    OptionalSurface osurf = model->getModelObjectByName<Surface>("B-101-201-I-F-76");
+    OptionalSurface streamedSurf = streamedModel->getModelObjectByName<Surface>("B-101-201-I-F-76");
+    EXPECT_EQ(bool(osurf), bool(streamedSurf)) << file;
+    if (osurf && streamedSurf){
+      EXPECT_EQ(osurf->outsideBoundaryCondition(), streamedSurf->outsideBoundaryCondition());
+      EXPECT_EQ(osurf->vertices().size(), streamedSurf->vertices().size());
+    }
+  }
+}
+
+TEST_F(gbXMLFixture, ReverseTranslator_StreamingForwardReferences)
+{
+  // the surface comes before the building and the space before its story
+  openstudio::path inputPath = resourcesPath() / openstudio::toPath("gbxml/ForwardReferences.xml");
+  {
+    std::ofstream ofs(openstudio::toString(inputPath));
+    ofs << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        << "<gbXML xmlns=\"http://www.gbxml.org/schema\" temperatureUnit=\"C\" lengthUnit=\"Meters\" areaUnit=\"SquareMeters\" volumeUnit=\"CubicMeters\" useSIUnitsForResults=\"true\" version=\"0.37\">\n"
+        << "  <Campus id=\"campus-1\">\n"
+        << "    <Surface id=\"surface-1\" surfaceType=\"SlabOnGrade\">\n"
+        << "      <Name>Floor</Name>\n"
+        << "      <AdjacentSpaceId spaceIdRef=\"space-1\"/>\n"
+        << "      <PlanarGeometry>\n"
+        << "        <PolyLoop>\n"
+        << "          <CartesianPoint><Coordinate>0</Coordinate><Coordinate>0</Coordinate><Coordinate>0</Coordinate></CartesianPoint>\n"
+        << "          <CartesianPoint><Coordinate>0</Coordinate><Coordinate>10</Coordinate><Coordinate>0</Coordinate></CartesianPoint>\n"
+        << "          <CartesianPoint><Coordinate>10</Coordinate><Coordinate>10</Coordinate><Coordinate>0</Coordinate></CartesianPoint>\n"
+        << "          <CartesianPoint><Coordinate>10</Coordinate><Coordinate>0</Coordinate><Coordinate>0</Coordinate></CartesianPoint>\n"
+        << "        </PolyLoop>\n"
+        << "      </PlanarGeometry>\n"
+        << "    </Surface>\n"
+        << "    <Building id=\"building-1\" buildingType=\"Office\">\n"
+        << "      <Name>Building</Name>\n"
+        << "      <Space id=\"space-1\" buildingStoreyIdRef=\"story-1\">\n"
+        << "        <Name>Space 1</Name>\n"
+        << "      </Space>\n"
+        << "      <BuildingStorey id=\"story-1\">\n"
+        << "        <Name>Story 1</Name>\n"
+        << "        <Level>0</Level>\n"
+        << "      </BuildingStorey>\n"
+        << "    </Building>\n"
+        << "  </Campus>\n"
+        << "</gbXML>\n";
+  }
+
+  openstudio::gbxml::ReverseTranslator reverseTranslator;
+  boost::optional<openstudio::model::Model> model = reverseTranslator.loadModel(inputPath);
+  ASSERT_TRUE(model);
+
+  boost::optional<openstudio::model::Model> streamedModel = reverseTranslator.loadModelStreaming(inputPath);
+  ASSERT_TRUE(streamedModel);
+
+  for (openstudio::model::Model m : {*model, *streamedModel}){
+    std::vector<Space> spaces = m.getConcreteModelObjects<Space>();
+    ASSERT_EQ(1u, spaces.size());
+    ASSERT_TRUE(spaces[0].buildingStory());
+    EXPECT_EQ(1u, m.getConcreteModelObjects<BuildingStory>().size());
+
+    std::vector<Surface> surfaces = m.getConcreteModelObjects<Surface>();
+    ASSERT_EQ(1u, surfaces.size());
+    ASSERT_TRUE(surfaces[0].space());
+    EXPECT_EQ(spaces[0].handle(), surfaces[0].space()->handle());
+  }
+
+  EXPECT_EQ(model->numObjects(), streamedModel->numObjects());
+}
@@ -101,7 +101,7 @@ void initializeOutFiles(GenerateIddFactoryOutFiles& outFiles,
     << "#include <utilities/core/Singleton.hpp>" << std::endl
     << "#include <utilities/core/Compare.hpp>" << std::endl
     << "#include <utilities/core/Logger.hpp>" << std::endl
-    << "#include <QMutex>" << std::endl
+    << "#include <mutex>" << std::endl
     << std::endl
     << "#include <map>" << std::endl
     << std::endl
@@ -218,12 +218,12 @@ void initializeOutFiles(GenerateIddFactoryOutFiles& outFiles,
     << "  typedef std::function<IddObject ()> CreateIddObjectCallback;" << std::endl
     << "  typedef std::map<IddObjectType,CreateIddObjectCallback> IddObjectCallbackMap;" << std::endl
     << "  IddObjectCallbackMap m_callbackMap;" << std::endl
-    << "  mutable QMutex m_callbackmutex;" << std::endl
     << std::endl
     << "  typedef std::multimap<IddObjectType,IddFileType> IddObjectSourceFileMap;" << std::endl
     << "  IddObjectSourceFileMap m_sourceFileMap;" << std::endl
     << std::endl
     << "  mutable std::map<VersionString,IddFile> m_osIddFiles;" << std::endl
+    << "  mutable std::mutex m_osIddFilesMutex;" << std::endl
     << "};" << std::endl
     << std::endl
     << "#if _WIN32 || _MSC_VER" << std::endl
@@ -257,7 +257,6 @@ void initializeOutFiles(GenerateIddFactoryOutFiles& outFiles,
     << std::endl
     << "#include <OpenStudio.hxx>" << std::endl
     << std::endl
-    << "#include <QMutexLocker>" << std::endl
     << "#include <QMetaType>" << std::endl
     << std::endl
     << "int _IddObjectType_id = qRegisterMetaType<openstudio::IddObjectType>(\"openstudio::IddObjectType\");" << std::endl
@@ -267,7 +266,7 @@ void initializeOutFiles(GenerateIddFactoryOutFiles& outFiles,
     << std::endl
     << "IddObject createCatchallIddObject() {" << std::endl
     << std::endl
-    << "  static IddObject object;" << std::endl
+    << "  static const IddObject object;" << std::endl
     << std::endl
     << "  // Catchall is the type of IddObject returned by the default constructor." << std::endl
     << "  OS_ASSERT(object.type() == IddObjectType::Catchall);" << std::endl
@@ -283,8 +282,6 @@ void initializeOutFiles(GenerateIddFactoryOutFiles& outFiles,
       << "#include <utilities/core/Assert.hpp>" << std::endl
       << "#include <utilities/core/Compare.hpp>" << std::endl
       << std::endl
-      << "#include <QMutexLocker>" << std::endl
-      << std::endl
       << "namespace openstudio {" << std::endl;
   }
 
@@ -350,9 +347,8 @@ void completeOutFiles(const IddFileFactoryDataVector& iddFiles,
     << std::endl
     << "IddObject createCommentOnlyIddObject() {" << std::endl
     << std::endl
-    << "  static IddObject object;" << std::endl
-    << std::endl
-    << "  if (object.type() == IddObjectType::Catchall) {" << std::endl
+    << "  // initialized once, thread-safe since C++11" << std::endl
+    << "  static const IddObject object = []() {" << std::endl
     << "    std::stringstream ss;" << std::endl
     << "    ss << \"CommentOnly; ! Autogenerated comment only object.\" << std::endl;" << std::endl
     << std::endl
@@ -362,8 +358,8 @@ void completeOutFiles(const IddFileFactoryDataVector& iddFiles,
     << "                                             ss.str()," << std::endl
     << "                                             objType);" << std::endl
     << "    OS_ASSERT(oObj);" << std::endl
-    << "    object = *oObj;" << std::endl
-    << "  }" << std::endl
+    << "    return *oObj;" << std::endl
+    << "  }();" << std::endl
     << std::endl
     << "  return object;" << std::endl
     << "}" << std::endl;
@@ -528,7 +524,6 @@ void completeOutFiles(const IddFileFactoryDataVector& iddFiles,
       << std::endl
       << "  for (IddObjectCallbackMap::const_iterator it = m_callbackMap.begin()," << std::endl
       << "       itEnd = m_callbackMap.end(); it != itEnd; ++it) {" << std::endl
-      << "    QMutexLocker l(&m_callbackmutex);" << std::endl
       << "    result.push_back(it->second());" << std::endl
       << "  }" << std::endl
       << std::endl
@@ -541,8 +536,6 @@ void completeOutFiles(const IddFileFactoryDataVector& iddFiles,
       << "  for(IddObjectCallbackMap::const_iterator it = m_callbackMap.begin()," << std::endl
       << "      itend = m_callbackMap.end(); it != itend; ++it) {" << std::endl
       << "    if (isInFile(it->first,fileType)) { " << std::endl
-      << "      // This lock is necessary to protect construction of the statics used in the callbacks " << std::endl
-      << "      QMutexLocker l(&m_callbackmutex);" << std::endl
       << "      result.push_back(it->second()); " << std::endl
       << "    }" << std::endl
       << "  }" << std::endl
@@ -657,7 +650,6 @@ void completeOutFiles(const IddFileFactoryDataVector& iddFiles,
       << "  IddObjectCallbackMap::const_iterator lookupPair;" << std::endl
       << "  lookupPair = m_callbackMap.find(objectType);" << std::endl
       << "  if (lookupPair != m_callbackMap.end()) { " << std::endl
-      << "    QMutexLocker l(&m_callbackmutex);" << std::endl
       << "    result = lookupPair->second(); " << std::endl
       << "  }" << std::endl
       << "  else { " << std::endl
@@ -677,10 +669,7 @@ void completeOutFiles(const IddFileFactoryDataVector& iddFiles,
     << std::endl
     << "  for (IddObjectCallbackMap::const_iterator it = m_callbackMap.begin()," << std::endl
     << "    itEnd = m_callbackMap.end(); it != itEnd; ++it) {" << std::endl
-    << "    // This lock is necessary to protect construction of the statics used in the callbacks " << std::endl
-    << "    QMutexLocker l(&m_callbackmutex);" << std::endl
     << "    IddObject candidate = it->second();" << std::endl
-    << "    l.unlock(); " << std::endl
     << "    if (candidate.properties().required) {" << std::endl
     << "      result.push_back(candidate);" << std::endl
     << "    }" << std::endl
@@ -712,9 +701,7 @@ void completeOutFiles(const IddFileFactoryDataVector& iddFiles,
     << std::endl
     << "  for (IddObjectCallbackMap::const_iterator it = m_callbackMap.begin()," << std::endl
     << "    itEnd = m_callbackMap.end(); it != itEnd; ++it) {" << std::endl
-    << "    QMutexLocker l(&m_callbackmutex);" << std::endl
     << "    IddObject candidate = it->second();" << std::endl
-    << "    l.unlock(); " << std::endl
     << "    if (candidate.properties().unique) {" << std::endl
     << "      result.push_back(candidate);" << std::endl
     << "    }" << std::endl
@@ -755,8 +742,6 @@ void completeOutFiles(const IddFileFactoryDataVector& iddFiles,
     << "  for(IddObjectCallbackMap::const_iterator it = m_callbackMap.begin()," << std::endl
     << "      itend = m_callbackMap.end(); it != itend; ++it) {" << std::endl
     << "    if (isInFile(it->first,fileType)) {" << std::endl
-    << "      // This lock is necessary to protect construction of the statics used in the callbacks " << std::endl
-    << "      QMutexLocker l(&m_callbackmutex);" << std::endl
     << "      result.addObject(it->second());" << std::endl
     << "    }" << std::endl
     << "  }" << std::endl
@@ -794,9 +779,12 @@ void completeOutFiles(const IddFileFactoryDataVector& iddFiles,
     << "    return getIddFile(fileType);" << std::endl
     << "  }" << std::endl
     << "  else {" << std::endl
-    << "    std::map<VersionString, IddFile>::const_iterator it = m_osIddFiles.find(version);" << std::endl
-    << "    if (it != m_osIddFiles.end()) {" << std::endl
-    << "      return it->second;" << std::endl
+    << "    {" << std::endl
+    << "      std::lock_guard<std::mutex> lock(m_osIddFilesMutex);" << std::endl
+    << "      std::map<VersionString, IddFile>::const_iterator it = m_osIddFiles.find(version);" << std::endl
+    << "      if (it != m_osIddFiles.end()) {" << std::endl
+    << "        return it->second;" << std::endl
+    << "      }" << std::endl
     << "    }" << std::endl
     << "    std::string iddPath = \":/idd/versions\";" << std::endl
     << "    std::stringstream folderString;" << std::endl
@@ -808,7 +796,7 @@ void completeOutFiles(const IddFileFactoryDataVector& iddFiles,
     << "      result = IddFile::load(ss);" << std::endl
     << "    }" << std::endl
     << "    if (result) {" << std::endl
-    << "      QMutexLocker l(&m_callbackmutex);" << std::endl
+    << "      std::lock_guard<std::mutex> lock(m_osIddFilesMutex);" << std::endl
     << "      m_osIddFiles[version] = *result;" << std::endl
     << "    }" << std::endl
     << "  }" << std::endl
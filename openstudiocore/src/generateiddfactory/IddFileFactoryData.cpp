@@ -195,9 +195,8 @@ void IddFileFactoryData::parseFile(const path& outPath,
       << std::endl
       << "IddObject create" << objectName.first << "IddObject() {" << std::endl
       << std::endl
-      << "  static IddObject object;" << std::endl
-      << std::endl
-      << "  if (object.type() == IddObjectType::Catchall) {" << std::endl
+      << "  // initialized once, thread-safe since C++11" << std::endl
+      << "  static const IddObject object = []() {" << std::endl
       << "    std::stringstream ss;" << std::endl
       << "    ss << \"" << m_readyLineForOutput(line) << "\\n\";";
 
@@ -220,8 +219,8 @@ void IddFileFactoryData::parseFile(const path& outPath,
           << "                                             ss.str()," << std::endl
           << "                                             objType);" << std::endl
           << "    OS_ASSERT(oObj);" << std::endl
-          << "    object = *oObj;" << std::endl
-          << "  }" << std::endl
+          << "    return *oObj;" << std::endl
+          << "  }();" << std::endl
           << std::endl
           << "  OS_ASSERT(object.type() == IddObjectType::" << objectName.first << ");" << std::endl
           << "  return object;" << std::endl
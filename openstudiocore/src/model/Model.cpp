@@ -32,10 +32,18 @@
 #include "Component.hpp"
 #include "ComponentWatcher_Impl.hpp"
 #include "Connection.hpp"
+#include "HVACComponent.hpp"
+#include "HVACComponent_Impl.hpp"
 #include "ModelObject.hpp"
 #include "ModelObject_Impl.hpp"
+#include "PlanarSurface.hpp"
+#include "PlanarSurface_Impl.hpp"
+#include "PlanarSurfaceGroup.hpp"
+#include "PlanarSurfaceGroup_Impl.hpp"
 #include "ResourceObject.hpp"
 #include "ResourceObject_Impl.hpp"
+#include "WaterToWaterComponent.hpp"
+#include "WaterToWaterComponent_Impl.hpp"
 
 // central list of all concrete ModelObject header files (_Impl and non-_Impl)
 // needed here for ::createObject
@@ -63,6 +71,12 @@
 
 #include <boost/regex.hpp>
 
+#include <algorithm>
+#include <map>
+#include <mutex>
+#include <set>
+#include <typeindex>
+
 using openstudio::IddObjectType;
 using openstudio::detail::WorkspaceObject_Impl;
 
@@ -159,6 +173,11 @@ namespace detail {
   void Model_Impl::swap(Workspace& other) {
     // Workspace::swap guarantees that other is a Model
 
+    if (isFrozen() || other.isFrozen()) {
+      LOG(Warn,"Cannot swap the contents of a frozen Model.");
+      return;
+    }
+
     // swap Workspace-level data
     openstudio::detail::Workspace_Impl::swap(other);
 
@@ -1082,6 +1101,71 @@ if (_className::iddObjectType() == typeToCreate) { \
     return Model(std::dynamic_pointer_cast<Model_Impl>(std::const_pointer_cast<openstudio::detail::Workspace_Impl>(this->shared_from_this())));
   }
 
+  bool Model_Impl::freeze()
+  {
+    if (isFrozen()) {
+      return true;
+    }
+    if (isBatchingChanges()) {
+      LOG(Warn,"Cannot freeze a Model while a change batch is open.");
+      return false;
+    }
+
+    // Fill the caches that getters otherwise fill on first use. A cache that stays empty here
+    // stays empty while frozen, since its getter has nothing to find in an unchanging model.
+    building();
+    lifeCycleCostParameters();
+    runPeriod();
+    yearDescription();
+    weatherFile();
+
+    // outputVariableNames are function statics, filled by the first call for each class
+    for (const IddObjectType& iddObjectType : objectTypes()) {
+      std::vector<WorkspaceObject> objects = getObjectsByType(iddObjectType);
+      if (!objects.empty()) {
+        if (boost::optional<ModelObject> modelObject = objects.front().optionalCast<ModelObject>()) {
+          modelObject->outputVariableNames();
+        }
+      }
+    }
+
+    Model model = this->model();
+    for (const PlanarSurface& surface : model.getModelObjects<PlanarSurface>()) {
+      surface.vertices();
+      // degenerate surfaces throw without caching, and keep doing so while frozen
+      try {
+        surface.outwardNormal();
+      }
+      catch (...) {}
+      try {
+        surface.plane();
+      }
+      catch (...) {}
+      try {
+        surface.triangulation();
+      }
+      catch (...) {}
+    }
+    for (const PlanarSurfaceGroup& group : model.getModelObjects<PlanarSurfaceGroup>()) {
+      group.transformation();
+    }
+    for (const ScheduleDay& scheduleDay : model.getConcreteModelObjects<ScheduleDay>()) {
+      scheduleDay.times();
+      scheduleDay.values();
+    }
+    for (const HVACComponent& component : model.getModelObjects<HVACComponent>()) {
+      component.airLoopHVAC();
+      component.airLoopHVACOutdoorAirSystem();
+      component.plantLoop();
+    }
+    for (const WaterToWaterComponent& component : model.getModelObjects<WaterToWaterComponent>()) {
+      component.secondaryPlantLoop();
+      component.tertiaryPlantLoop();
+    }
+
+    return openstudio::detail::Workspace_Impl::freeze();
+  }
+
   bool Model_Impl::setIddFile(IddFileType iddFileType) {
     OS_ASSERT(iddFileType == IddFileType::OpenStudio);
     return false;
@@ -1560,15 +1644,69 @@ if (_className::iddObjectType() == typeToCreate) { \
   }
 
   std::vector<openstudio::IdfObject> Model_Impl::purgeUnusedResourceObjects() {
-    ResourceObjectVector resources = model().getModelObjects<ResourceObject>();
     IdfObjectVector removedObjects;
-    for (ResourceObject& resource : resources) {
-      // test for initialized first in case earlier .remove() got this one already
-      if ((resource.initialized()) && (resource.nonResourceObjectUseCount(true) == 0)) {
-        IdfObjectVector thisCallRemoved = resource.remove();
-        removedObjects.insert(removedObjects.end(),thisCallRemoved.begin(),thisCallRemoved.end());
+
+    // A ResourceObject is used if it is pointed to by a non-ResourceObject that is not one of its
+    // children, or by a used ResourceObject, i.e. if nonResourceObjectUseCount(true) > 0.  Mark
+    // the used resources in one pass over the pointer graph and remove the others.  Removing a
+    // resource also removes its children, which may leave more resources unused, so repeat until
+    // a pass removes nothing.
+    bool removedAny = true;
+    while (removedAny) {
+      removedAny = false;
+
+      ResourceObjectVector resources = model().getModelObjects<ResourceObject>();
+      std::map<Handle, size_t> resourceIndices;
+      for (size_t i = 0; i < resources.size(); ++i) {
+        resourceIndices.insert(std::make_pair(resources[i].handle(), i));
+      }
+
+      // uses[i] lists the resources that resources[i] points to, a used resource marks these as used
+      std::vector<std::vector<size_t> > uses(resources.size());
+      std::vector<bool> used(resources.size(), false);
+      std::vector<size_t> toVisit;
+      for (size_t i = 0; i < resources.size(); ++i) {
+        boost::optional<std::set<Handle> > childHandles;
+        for (const WorkspaceObject& source : resources[i].sources()) {
+          auto it = resourceIndices.find(source.handle());
+          if (it != resourceIndices.end()) {
+            uses[it->second].push_back(i);
+          } else if (!used[i]) {
+            if (!childHandles) {
+              childHandles = std::set<Handle>();
+              for (const ModelObject& child : resources[i].children()) {
+                childHandles->insert(child.handle());
+              }
+            }
+            if (childHandles->find(source.handle()) == childHandles->end()) {
+              used[i] = true;
+              toVisit.push_back(i);
+            }
+          }
+        }
+      }
+
+      while (!toVisit.empty()) {
+        size_t i = toVisit.back();
+        toVisit.pop_back();
+        for (size_t j : uses[i]) {
+          if (!used[j]) {
+            used[j] = true;
+            toVisit.push_back(j);
+          }
+        }
+      }
+
+      for (size_t i = 0; i < resources.size(); ++i) {
+        // test for initialized first in case earlier .remove() got this one already
+        if (!used[i] && resources[i].initialized()) {
+          IdfObjectVector thisCallRemoved = resources[i].remove();
+          removedObjects.insert(removedObjects.end(),thisCallRemoved.begin(),thisCallRemoved.end());
+          removedAny = removedAny || !thisCallRemoved.empty();
+        }
       }
     }
+
     return removedObjects;
   }
 
@@ -1588,6 +1726,78 @@ if (_className::iddObjectType() == typeToCreate) { \
     return removedObjects;
   }
 
+  namespace {
+
+    // Remembers which IddObjectTypes are implemented by a class derived from a given implementation
+    // class. All objects of an IddObjectType are created with the same implementation class, so
+    // only one object of each type needs to be tested.
+    struct ImplTypeRegistry
+    {
+      std::mutex mutex;
+      std::map<std::type_index, std::map<IddObjectType, bool> > matchesByImplType;
+    };
+
+    ImplTypeRegistry& implTypeRegistry()
+    {
+      static ImplTypeRegistry registry;
+      return registry;
+    }
+
+  }
+
+  std::vector<WorkspaceObject> Model_Impl::objectsWithImplType(const std::type_info& implType,
+                                                               bool (*isImplType)(const WorkspaceObject&)) const
+  {
+    std::vector<WorkspaceObject> result;
+    ImplTypeRegistry& registry = implTypeRegistry();
+    std::type_index implTypeIndex(implType);
+
+    for (const IddObjectType& iddObjectType : objectTypes()) {
+      if ((iddObjectType == IddObjectType::UserCustom) || (iddObjectType == IddObjectType::Catchall)) {
+        // not tied to one implementation class, test every object
+        for (const WorkspaceObject& object : getObjectsByType(iddObjectType)) {
+          if (isImplType(object)) {
+            result.push_back(object);
+          }
+        }
+        continue;
+      }
+
+      boost::optional<bool> matches;
+      {
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        const std::map<IddObjectType, bool>& matchesByIddObjectType = registry.matchesByImplType[implTypeIndex];
+        auto it = matchesByIddObjectType.find(iddObjectType);
+        if (it != matchesByIddObjectType.end()) {
+          matches = it->second;
+        }
+      }
+
+      if (!matches) {
+        boost::optional<WorkspaceObject> object = getAnyObjectOfType(iddObjectType);
+        if (!object) {
+          continue;
+        }
+        matches = isImplType(*object);
+        std::lock_guard<std::mutex> lock(registry.mutex);
+        registry.matchesByImplType[implTypeIndex][iddObjectType] = *matches;
+      }
+
+      // only matching buckets are copied out
+      if (*matches) {
+        std::vector<WorkspaceObject> objects = getObjectsByType(iddObjectType);
+        result.insert(result.end(), objects.begin(), objects.end());
+      }
+    }
+
+    // objects() is ordered by handle
+    std::sort(result.begin(), result.end(), [](const WorkspaceObject& left, const WorkspaceObject& right) {
+      return left.handle() < right.handle();
+    });
+
+    return result;
+  }
+
   void Model_Impl::connect(const Model& m,
                            ModelObject sourceObject,
                            unsigned sourcePort,
@@ -1786,6 +1996,10 @@ Model::Model()
 }
 
 Model::Model(const openstudio::IdfFile& idfFile)
+  : Model(idfFile,UHPointerVector())
+{}
+
+Model::Model(const openstudio::IdfFile& idfFile, const std::vector<UHPointer>& resolvedPointers)
   : Workspace(std::shared_ptr<detail::Model_Impl>(new detail::Model_Impl(idfFile)))
 {
   // construct WorkspaceObject_ImplPtrs
@@ -1799,7 +2013,8 @@ Model::Model(const openstudio::IdfFile& idfFile)
     LOG(Trace,"objectImplPtr: " << toString(objectImplPtrs.back()->handle()));
   }
   // add Object_ImplPtrs to Workspace_Impl
-  getImpl<detail::Model_Impl>()->addObjects(objectImplPtrs);
+  getImpl<detail::Model_Impl>()->addObjects(objectImplPtrs,UHPointerVector(),HUPointerVector(),
+                                            true,false,resolvedPointers);
   // watch loaded components
   getImpl<detail::Model_Impl>()->createComponentWatchers();
 }
@@ -1865,6 +2080,21 @@ boost::optional<Model> Model::load(const path& osmPath, const path& workflowJSON
 }
 
 
+boost::optional<Model> Model::loadSnapshot(const path& snapshotPath)
+{
+  OptionalModel result;
+  // pointers come back as handles from the snapshot's table, not as text to look up
+  UHPointerVector pointers;
+  OptionalIdfFile oIdfFile = IdfFile::loadSnapshot(snapshotPath,pointers);
+  if (oIdfFile && (oIdfFile->iddFileType() == IddFileType::OpenStudio)) {
+    try {
+      result = Model(*oIdfFile,pointers);
+    }
+    catch (...) {}
+  }
+  return result;
+}
+
 Model::Model(std::shared_ptr<detail::Model_Impl> p)
   : Workspace(p)
 {}
@@ -2043,6 +2273,12 @@ boost::optional<ComponentData> Model::insertComponent(const Component& component
   return getImpl<detail::Model_Impl>()->insertComponent(component);
 }
 
+std::vector<WorkspaceObject> Model::objectsWithImplType(const std::type_info& implType,
+                                                        bool (*isImplType)(const WorkspaceObject&)) const
+{
+  return getImpl<detail::Model_Impl>()->objectsWithImplType(implType, isImplType);
+}
+
 std::vector<openstudio::IdfObject> Model::purgeUnusedResourceObjects() {
   return getImpl<detail::Model_Impl>()->purgeUnusedResourceObjects();
 }
@@ -37,6 +37,7 @@
 #include "../utilities/core/Assert.hpp"
 
 #include <vector>
+#include <typeinfo>
 
 namespace openstudio {
 
@@ -251,7 +252,12 @@ class MODEL_API Model : public openstudio::Workspace {
   std::vector<T> getModelObjects(bool sorted=false) const
   {
     std::vector<T> result;
-    std::vector<WorkspaceObject> objects = this->objects(sorted);
+    std::vector<WorkspaceObject> objects;
+    if (sorted) {
+      objects = this->objects(sorted);
+    } else {
+      objects = this->objectsWithImplType(typeid(typename T::ImplType), &Model::hasImplType<typename T::ImplType>);
+    }
     result.reserve(objects.size());
     for(std::vector<WorkspaceObject>::const_iterator it = objects.begin(), itend = objects.end(); it < itend; ++it)
     {
@@ -261,6 +267,22 @@ class MODEL_API Model : public openstudio::Workspace {
     return result;
   }
 
+#ifndef SWIG
+  /** Returns the objects, in the same order as objects(), whose implementation is derived from
+   *  implType. Only one object of each IddObjectType is tested with isImplType, the result is
+   *  remembered for the lifetime of the program since all objects of an IddObjectType share the
+   *  same implementation class. Used by getModelObjects<T> so that abstract classes such as
+   *  PlanarSurface or ResourceObject only visit the objects of matching types. */
+  std::vector<WorkspaceObject> objectsWithImplType(const std::type_info& implType,
+                                                   bool (*isImplType)(const WorkspaceObject&)) const;
+
+  template <typename ImplType>
+  static bool hasImplType(const WorkspaceObject& object)
+  {
+    return bool(object.getImpl<ImplType>());
+  }
+#endif
+
   /** Returns all \link ModelObject ModelObjects \endlink of type T, using T::iddObjectType() to
    *  speed up the search. This method will only work for concrete model objects (leaves in the
    *  ModelObject inheritance tree), hence the name. */
@@ -378,6 +400,9 @@ class MODEL_API Model : public openstudio::Workspace {
   /** Load Model and WorkflowJSON from files, fails if either osm or workflowJSON cannot be loaded. */
   static boost::optional<Model> load(const path& osmPath, const path& workflowJSONPath);
 
+  /** Load Model from a binary snapshot written by Workspace::saveSnapshot. */
+  static boost::optional<Model> loadSnapshot(const path& snapshotPath);
+
   /// Equality test, tests if this Model shares the same implementation object with other.
   bool operator==(const Model& other) const;
 
@@ -430,6 +455,9 @@ class MODEL_API Model : public openstudio::Workspace {
   /** Protected constructor from impl. */
   Model(std::shared_ptr<detail::Model_Impl> impl);
 
+  /** Construct from idfFile, setting resolvedPointers directly. See IdfFile::loadSnapshot. */
+  Model(const openstudio::IdfFile& idfFile, const std::vector<UHPointer>& resolvedPointers);
+
   virtual void addVersionObject() override;
 
   /// @endcond
@@ -47,6 +47,7 @@
 #include <boost/optional.hpp>
 
 #include <vector>
+#include <typeinfo>
 
 namespace openstudio {
 
@@ -188,6 +189,10 @@ namespace detail {
     /** Override to return false. IddFileType is always equal to IddFileType::OpenStudio. */
     virtual bool setIddFile(IddFileType iddFileType);
 
+    /** Fills the caches that Model and ModelObject getters otherwise fill on first use, then
+     *  freezes the workspace. See Workspace::freeze. */
+    virtual bool freeze() override;
+
     // Overriding this from WorkspaceObject_Impl is how all objects in the model end up
     // as model objects
     virtual std::shared_ptr<openstudio::detail::WorkspaceObject_Impl> createObject(
@@ -228,6 +233,11 @@ namespace detail {
      *  are not ResourceObjects, and these may be removed as well. */
     virtual std::vector<openstudio::IdfObject> purgeUnusedResourceObjects(IddObjectType iddObjectType);
 
+    /** Returns the objects, in the same order as objects(), whose implementation is derived from
+     *  implType. See Model::objectsWithImplType. */
+    std::vector<WorkspaceObject> objectsWithImplType(const std::type_info& implType,
+                                                     bool (*isImplType)(const WorkspaceObject&)) const;
+
     void connect(const Model& model,
                  ModelObject sourceObject,
                  unsigned sourcePort,
@@ -59,6 +59,8 @@
 #include <boost/math/constants/constants.hpp>
 #include <boost/lexical_cast.hpp>
 
+#include <cstdlib>
+
 using openstudio::Handle;
 using openstudio::OptionalHandle;
 using openstudio::HandleVector;
@@ -81,7 +83,7 @@ namespace model {
       : ParentObject_Impl(type, model)
     {
       // connect signals
-      this->PlanarSurface_Impl::onChange.connect<PlanarSurface_Impl, &PlanarSurface_Impl::clearCachedVariables>(this);
+      this->PlanarSurface_Impl::onLocalChange.connect<PlanarSurface_Impl, &PlanarSurface_Impl::clearCachedVariables>(this);
     }
 
     // constructor
@@ -91,7 +93,7 @@ namespace model {
       : ParentObject_Impl(idfObject, model, keepHandle)
     {
       // connect signals
-      this->PlanarSurface_Impl::onChange.connect<PlanarSurface_Impl, &PlanarSurface_Impl::clearCachedVariables>(this);
+      this->PlanarSurface_Impl::onLocalChange.connect<PlanarSurface_Impl, &PlanarSurface_Impl::clearCachedVariables>(this);
     }
 
     PlanarSurface_Impl::PlanarSurface_Impl(const openstudio::detail::WorkspaceObject_Impl& other,
@@ -100,7 +102,7 @@ namespace model {
       : ParentObject_Impl(other,model,keepHandle)
     {
       // connect signals
-      this->PlanarSurface_Impl::onChange.connect<PlanarSurface_Impl, &PlanarSurface_Impl::clearCachedVariables>(this);
+      this->PlanarSurface_Impl::onLocalChange.connect<PlanarSurface_Impl, &PlanarSurface_Impl::clearCachedVariables>(this);
     }
 
     PlanarSurface_Impl::PlanarSurface_Impl(const PlanarSurface_Impl& other,
@@ -109,7 +111,7 @@ namespace model {
       : ParentObject_Impl(other,model,keepHandle)
     {
       // connect signals
-      this->PlanarSurface_Impl::onChange.connect<PlanarSurface_Impl, &PlanarSurface_Impl::clearCachedVariables>(this);
+      this->PlanarSurface_Impl::onLocalChange.connect<PlanarSurface_Impl, &PlanarSurface_Impl::clearCachedVariables>(this);
     }
     
     boost::optional<ConstructionBase> PlanarSurface_Impl::construction() const
@@ -121,22 +123,60 @@ namespace model {
       return boost::none;
     }
 
+    // parse a vertex coordinate field, uses strtod when it is plain decimal text and lexical_cast otherwise.
+    // strtod alone would also take hex, inf and nan, and reads the decimal point of the current C locale.
+    boost::optional<double> parseVertexCoordinate(const std::string& value)
+    {
+      if (value.empty()){
+        return boost::none;
+      }
+      bool plainDecimal = true;
+      for (char c : value){
+        if (!(((c >= '0') && (c <= '9')) || (c == '.') || (c == '-') || (c == '+') || (c == 'e') || (c == 'E'))){
+          plainDecimal = false;
+          break;
+        }
+      }
+      if (plainDecimal){
+        const char* begin = value.c_str();
+        char* end = nullptr;
+        double result = std::strtod(begin, &end);
+        if (end == begin + value.size()){
+          return result;
+        }
+      }
+      try {
+        return boost::lexical_cast<double>(value);
+      } catch (const std::exception&) {
+      }
+      return boost::none;
+    }
+
     /// get the vertices
     Point3dVector PlanarSurface_Impl::vertices() const
     {
       if (!m_cachedVertices){
         Point3dVector result;
 
-        for (const ModelExtensibleGroup& group : castVector<ModelExtensibleGroup>(extensibleGroups()))
+        // read coordinates straight from the vertex fields rather than through extensible group objects
+        unsigned begin = numNonextensibleFields();
+        unsigned n = numExtensibleGroups();
+        result.reserve(n);
+        for (unsigned groupIndex = 0; groupIndex < n; ++groupIndex)
         {
-          OptionalDouble x = group.getDouble(0);
-          OptionalDouble y = group.getDouble(1);
-          OptionalDouble z = group.getDouble(2);
+          unsigned index = begin + 3 * groupIndex;
+
+          OptionalDouble x = parseVertexCoordinate(m_fields[index]);
+          OptionalDouble y = parseVertexCoordinate(m_fields[index + 1]);
+          OptionalDouble z = parseVertexCoordinate(m_fields[index + 2]);
+          if (!x) { x = getDouble(index); }
+          if (!y) { y = getDouble(index + 1); }
+          if (!z) { z = getDouble(index + 2); }
 
           if (x && y && z){
             result.push_back(Point3d(*x, *y, *z));
           }else{
-            LOG(Error, "Could not read vertex " << group.groupIndex() << " in " << briefDescription() << "." );
+            LOG(Error, "Could not read vertex " << groupIndex << " in " << briefDescription() << "." );
           }
         }
 
@@ -168,41 +208,46 @@ namespace model {
 
       bool result = true;
 
-      LOG(Debug, "Before setVertices have " << numFields() << " fields.");
+      // DLM: fitting points to plane here as well as in SketchUp was resulting in unacceptable rounding errors
+      // just use points directly
+      std::vector<std::string> values;
+      values.reserve(3 * n);
+      for (const Point3d& vertex : vertices) {
+        values.push_back(toString(vertex.x()));
+        values.push_back(toString(vertex.y()));
+        values.push_back(toString(vertex.z()));
+      }
 
-      clearExtensibleGroups(false);
+      // the vertices as they will be read back from the formatted fields
+      Point3dVector newVertices;
+      newVertices.reserve(n);
+      for (unsigned vertexIndex = 0; vertexIndex < n; ++vertexIndex) {
+        OptionalDouble x = parseVertexCoordinate(values[3 * vertexIndex]);
+        OptionalDouble y = parseVertexCoordinate(values[3 * vertexIndex + 1]);
+        OptionalDouble z = parseVertexCoordinate(values[3 * vertexIndex + 2]);
+        OS_ASSERT(x && y && z);
+        newVertices.push_back(Point3d(*x, *y, *z));
+      }
 
-      LOG(Debug, "After clearExtensibleGroups in setVertices have " << numFields() << " fields.");
+      LOG(Debug, "Before setVertices have " << numFields() << " fields.");
 
-      // set the vertices
-      // bool nonPlanarPointFound = false;
-      for (unsigned vertexIndex = 0; vertexIndex < n; ++vertexIndex) {
+      if (numExtensibleGroups() == n){
+        // same number of vertices, overwrite the fields in place
+        unsigned begin = numNonextensibleFields();
+        for (unsigned i = 0; i < 3 * n; ++i) {
+          bool ok = setString(begin + i, values[i], false);
+          OS_ASSERT(ok);
+        }
+      }else{
+        clearExtensibleGroups(false);
 
-        // DLM: fitting points to plane here as well as in SketchUp was resulting in unacceptable rounding errors
-        // just use point directly
-        Point3d vertex = vertices[vertexIndex];
-
-        // project point to plane
-        //Point3d vertex = plane->project(vertices[vertexIndex]);
-        //LOG(Debug, "Original vertex = " << vertices[vertexIndex] << ", new vertex = " << vertex);
-
-        // see how far off we were
-        //if (!nonPlanarPointFound){
-        //  Vector3d diff = vertex - vertices[vertexIndex];
-        //  // see if more than 1 inch off of plane
-        //  if (diff.length() > 0.0254){
-        //    LOG(Warn, "PlanarSurface '" << this->name().get() << "' given non-planar vertices, these have been corrected.");
-        //    nonPlanarPointFound = true;
-        //  }
-        //}
-
-        std::vector<std::string> values;
-        values.push_back(toString(vertex.x()));
-        values.push_back(toString(vertex.y()));
-        values.push_back(toString(vertex.z()));
+        LOG(Debug, "After clearExtensibleGroups in setVertices have " << numFields() << " fields.");
 
-        ModelExtensibleGroup group = pushExtensibleGroup(values, false).cast<ModelExtensibleGroup>();
-        OS_ASSERT(!group.empty());
+        for (unsigned vertexIndex = 0; vertexIndex < n; ++vertexIndex) {
+          std::vector<std::string> groupValues(values.begin() + 3 * vertexIndex, values.begin() + 3 * vertexIndex + 3);
+          ModelExtensibleGroup group = pushExtensibleGroup(groupValues, false).cast<ModelExtensibleGroup>();
+          OS_ASSERT(!group.empty());
+        }
       }
 
       LOG(Debug, "After setVertices have " << numFields() << " fields.  Size of vertices is "
@@ -210,6 +255,9 @@ namespace model {
 
       this->emitChangeSignals();
 
+      // change signals cleared the cache, prime it so the fields are not parsed again
+      m_cachedVertices = newVertices;
+
       return result;
     }
 
@@ -287,8 +335,9 @@ namespace model {
     {
       if (!m_cachedOutwardNormal){
         Point3dVector vertices = this->vertices();
-        m_cachedOutwardNormal = getOutwardNormal(vertices);
-        if(!m_cachedOutwardNormal){
+        // only store a successful result, so failing calls do not write the cache
+        boost::optional<Vector3d> outwardNormal = getOutwardNormal(vertices);
+        if(!outwardNormal){
           std::string surfaceNameMsg;
           boost::optional<std::string> name = this->name();
           if (name){
@@ -296,6 +345,7 @@ namespace model {
           }
           LOG_AND_THROW("Cannot compute outward normal for vertices " << vertices << surfaceNameMsg);
         }
+        m_cachedOutwardNormal = outwardNormal;
       }
       return m_cachedOutwardNormal.get();
     }
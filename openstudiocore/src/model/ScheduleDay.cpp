@@ -63,7 +63,7 @@ namespace detail {
     OS_ASSERT(idfObject.iddObject().type() == ScheduleDay::iddObjectType());
 
     // connect signals
-    this->ScheduleDay_Impl::onChange.connect<ScheduleDay_Impl, &ScheduleDay_Impl::clearCachedVariables>(this);
+    this->ScheduleDay_Impl::onLocalChange.connect<ScheduleDay_Impl, &ScheduleDay_Impl::clearCachedVariables>(this);
   }
 
   ScheduleDay_Impl::ScheduleDay_Impl(const openstudio::detail::WorkspaceObject_Impl& other,
@@ -74,7 +74,7 @@ namespace detail {
     OS_ASSERT(other.iddObject().type() == ScheduleDay::iddObjectType());
 
     // connect signals
-    this->ScheduleDay_Impl::onChange.connect<ScheduleDay_Impl, &ScheduleDay_Impl::clearCachedVariables>(this);
+    this->ScheduleDay_Impl::onLocalChange.connect<ScheduleDay_Impl, &ScheduleDay_Impl::clearCachedVariables>(this);
   }
 
   ScheduleDay_Impl::ScheduleDay_Impl(const ScheduleDay_Impl& other,
@@ -83,7 +83,7 @@ namespace detail {
     : ScheduleBase_Impl(other,model,keepHandle)
   {
     // connect signals
-    this->ScheduleDay_Impl::onChange.connect<ScheduleDay_Impl, &ScheduleDay_Impl::clearCachedVariables>(this);
+    this->ScheduleDay_Impl::onLocalChange.connect<ScheduleDay_Impl, &ScheduleDay_Impl::clearCachedVariables>(this);
   }
 
   std::vector<IdfObject> ScheduleDay_Impl::remove() {
@@ -61,7 +61,9 @@
 #include "../utilities/geometry/Transformation.hpp"
 #include "../utilities/geometry/Geometry.hpp"
 
+#include <atomic>
 #include <cmath>
+#include <thread>
 
 namespace openstudio
 {
@@ -497,6 +499,40 @@ namespace openstudio
       userDatas.push_back(userData);
     }
 
+    ThreeSceneMetadata makeSceneMetadata(const Model& model)
+    {
+      BoundingBox boundingBox;
+      boundingBox.addPoint(Point3d(0, 0, 0));
+      boundingBox.addPoint(Point3d(1, 1, 1));
+      for (const auto& group : model.getModelObjects<PlanarSurfaceGroup>()){
+        boundingBox.add(group.transformation()*group.boundingBox());
+      }
+
+      double lookAtX = 0; // (boundingBox.minX().get() + boundingBox.maxX().get()) / 2.0
+      double lookAtY = 0; // (boundingBox.minY().get() + boundingBox.maxY().get()) / 2.0
+      double lookAtZ = 0; // (boundingBox.minZ().get() + boundingBox.maxZ().get()) / 2.0
+      double lookAtR =            sqrt(std::pow(boundingBox.maxX().get() / 2.0, 2) + std::pow(boundingBox.maxY().get() / 2.0, 2) + std::pow(boundingBox.maxZ().get() / 2.0, 2));
+      lookAtR = std::max(lookAtR, sqrt(std::pow(boundingBox.minX().get() / 2.0, 2) + std::pow(boundingBox.maxY().get() / 2.0, 2) + std::pow(boundingBox.maxZ().get() / 2.0, 2)));
+      lookAtR = std::max(lookAtR, sqrt(std::pow(boundingBox.maxX().get() / 2.0, 2) + std::pow(boundingBox.minY().get() / 2.0, 2) + std::pow(boundingBox.maxZ().get() / 2.0, 2)));
+      lookAtR = std::max(lookAtR, sqrt(std::pow(boundingBox.maxX().get() / 2.0, 2) + std::pow(boundingBox.maxY().get() / 2.0, 2) + std::pow(boundingBox.minZ().get() / 2.0, 2)));
+      lookAtR = std::max(lookAtR, sqrt(std::pow(boundingBox.minX().get() / 2.0, 2) + std::pow(boundingBox.minY().get() / 2.0, 2) + std::pow(boundingBox.maxZ().get() / 2.0, 2)));
+      lookAtR = std::max(lookAtR, sqrt(std::pow(boundingBox.minX().get() / 2.0, 2) + std::pow(boundingBox.maxY().get() / 2.0, 2) + std::pow(boundingBox.minZ().get() / 2.0, 2)));
+      lookAtR = std::max(lookAtR, sqrt(std::pow(boundingBox.maxX().get() / 2.0, 2) + std::pow(boundingBox.minY().get() / 2.0, 2) + std::pow(boundingBox.minZ().get() / 2.0, 2)));
+      lookAtR = std::max(lookAtR, sqrt(std::pow(boundingBox.minX().get() / 2.0, 2) + std::pow(boundingBox.minY().get() / 2.0, 2) + std::pow(boundingBox.minZ().get() / 2.0, 2)));
+
+      ThreeBoundingBox threeBoundingBox(boundingBox.minX().get(), boundingBox.minY().get(), boundingBox.minZ().get(),
+                                        boundingBox.maxX().get(), boundingBox.maxY().get(), boundingBox.maxZ().get(),
+                                        lookAtX, lookAtY, lookAtZ, lookAtR);
+
+      std::vector<std::string> buildingStoryNames;
+      for (const auto& buildingStory : model.getConcreteModelObjects<BuildingStory>()){
+        buildingStoryNames.push_back(buildingStory.nameString());
+      }
+      // buildingStoryNames.sort! {|x,y| x.upcase <=> y.upcase} # case insensitive sort
+
+      return ThreeSceneMetadata(buildingStoryNames, threeBoundingBox);
+    }
+
     ThreeScene modelToThreeJS(Model model, bool triangulateSurfaces)
     {
       std::vector<ThreeMaterial> materials;
@@ -530,40 +566,111 @@ namespace openstudio
 
       ThreeSceneObject sceneObject(toThreeUUID(toString(openstudio::createUUID())), sceneChildren);
 
-      BoundingBox boundingBox;
-      boundingBox.addPoint(Point3d(0, 0, 0));
-      boundingBox.addPoint(Point3d(1, 1, 1));
-      for (const auto& group : model.getModelObjects<PlanarSurfaceGroup>()){
-        boundingBox.add(group.transformation()*group.boundingBox());
+      ThreeSceneMetadata metadata = makeSceneMetadata(model);
+  
+      ThreeScene scene(metadata, allGeometries, materials, sceneObject);
+
+      return scene;
+    }
+
+    // inputs read from the model for one surface, triangulated off the model on a worker thread
+    struct SurfaceTriangulationInput
+    {
+      std::string name;
+      std::string materialId;
+      Transformation siteTransformation;
+      Point3dVector vertices;
+      Point3dVectorVector subSurfaceVertices;
+    };
+
+    // triangulate a surface in site coordinates, vertices of each triangle are ordered as in modelToThreeJS
+    Point3dVector triangulateSurface(const SurfaceTriangulationInput& input)
+    {
+      Point3dVector result;
+
+      Transformation t = Transformation::alignFace(input.vertices);
+      Transformation tInv = t.inverse();
+      Point3dVector faceVertices = reverse(tInv*input.vertices);
+
+      Point3dVectorVector faceSubVertices;
+      for (const auto& subSurfaceVertices : input.subSurfaceVertices){
+        faceSubVertices.push_back(reverse(tInv*subSurfaceVertices));
       }
 
-      double lookAtX = 0; // (boundingBox.minX().get() + boundingBox.maxX().get()) / 2.0
-      double lookAtY = 0; // (boundingBox.minY().get() + boundingBox.maxY().get()) / 2.0
-      double lookAtZ = 0; // (boundingBox.minZ().get() + boundingBox.maxZ().get()) / 2.0
-      double lookAtR =            sqrt(std::pow(boundingBox.maxX().get() / 2.0, 2) + std::pow(boundingBox.maxY().get() / 2.0, 2) + std::pow(boundingBox.maxZ().get() / 2.0, 2));
-      lookAtR = std::max(lookAtR, sqrt(std::pow(boundingBox.minX().get() / 2.0, 2) + std::pow(boundingBox.maxY().get() / 2.0, 2) + std::pow(boundingBox.maxZ().get() / 2.0, 2)));
-      lookAtR = std::max(lookAtR, sqrt(std::pow(boundingBox.maxX().get() / 2.0, 2) + std::pow(boundingBox.minY().get() / 2.0, 2) + std::pow(boundingBox.maxZ().get() / 2.0, 2)));
-      lookAtR = std::max(lookAtR, sqrt(std::pow(boundingBox.maxX().get() / 2.0, 2) + std::pow(boundingBox.maxY().get() / 2.0, 2) + std::pow(boundingBox.minZ().get() / 2.0, 2)));
-      lookAtR = std::max(lookAtR, sqrt(std::pow(boundingBox.minX().get() / 2.0, 2) + std::pow(boundingBox.minY().get() / 2.0, 2) + std::pow(boundingBox.maxZ().get() / 2.0, 2)));
-      lookAtR = std::max(lookAtR, sqrt(std::pow(boundingBox.minX().get() / 2.0, 2) + std::pow(boundingBox.maxY().get() / 2.0, 2) + std::pow(boundingBox.minZ().get() / 2.0, 2)));
-      lookAtR = std::max(lookAtR, sqrt(std::pow(boundingBox.maxX().get() / 2.0, 2) + std::pow(boundingBox.minY().get() / 2.0, 2) + std::pow(boundingBox.minZ().get() / 2.0, 2)));
-      lookAtR = std::max(lookAtR, sqrt(std::pow(boundingBox.minX().get() / 2.0, 2) + std::pow(boundingBox.minY().get() / 2.0, 2) + std::pow(boundingBox.minZ().get() / 2.0, 2)));
+      Point3dVectorVector finalFaceVertices = computeTriangulation(faceVertices, faceSubVertices);
+      if (finalFaceVertices.empty()){
+        LOG_FREE(Error, "modelToThreeJSBinary", "Failed to triangulate surface " << input.name << " with " << faceSubVertices.size() << " sub surfaces");
+        return result;
+      }
 
-      ThreeBoundingBox threeBoundingBox(boundingBox.minX().get(), boundingBox.minY().get(), boundingBox.minZ().get(),
-                                        boundingBox.maxX().get(), boundingBox.maxY().get(), boundingBox.maxZ().get(),
-                                        lookAtX, lookAtY, lookAtZ, lookAtR);
-     
-      std::vector<std::string> buildingStoryNames;
-      for (const auto& buildingStory : model.getConcreteModelObjects<BuildingStory>()){
-        buildingStoryNames.push_back(buildingStory.nameString());
+      Transformation toSite = input.siteTransformation*t;
+      for (const auto& finalFaceVerts : finalFaceVertices) {
+        Point3dVector finalVerts = toSite*finalFaceVerts;
+        result.insert(result.end(), finalVerts.rbegin(), finalVerts.rend());
       }
-      // buildingStoryNames.sort! {|x,y| x.upcase <=> y.upcase} # case insensitive sort
-  
-      ThreeSceneMetadata metadata(buildingStoryNames, threeBoundingBox);
-  
-      ThreeScene scene(metadata, allGeometries, materials, sceneObject);
 
-      return scene;
+      return result;
+    }
+
+    ThreeBinaryScene modelToThreeJSBinary(Model model)
+    {
+      std::vector<ThreeMaterial> materials;
+      std::map<std::string, std::string> materialMap;
+      buildMaterials(model, materials, materialMap);
+
+      // gather everything needed from the model up front, model access is not thread safe
+      std::vector<SurfaceTriangulationInput> inputs;
+      for (const auto& planarSurface : model.getModelObjects<PlanarSurface>())
+      {
+        SurfaceTriangulationInput input;
+        input.name = planarSurface.nameString();
+        input.vertices = planarSurface.vertices();
+
+        boost::optional<PlanarSurfaceGroup> planarSurfaceGroup = planarSurface.planarSurfaceGroup();
+        if (planarSurfaceGroup){
+          input.siteTransformation = planarSurfaceGroup->siteTransformation();
+        }
+
+        boost::optional<Surface> surface = planarSurface.optionalCast<Surface>();
+        if (surface){
+          for (const auto& subSurface : surface->subSurfaces()){
+            input.subSurfaceVertices.push_back(subSurface.vertices());
+          }
+        }
+
+        ThreeUserData userData;
+        updateUserData(userData, planarSurface);
+        input.materialId = getMaterialId(userData.surfaceTypeMaterialName(), materialMap);
+
+        inputs.push_back(input);
+      }
+
+      // triangulation only touches the gathered geometry so it can be spread across threads
+      std::vector<Point3dVector> triangles(inputs.size());
+      std::atomic<size_t> next(0);
+      auto worker = [&inputs, &triangles, &next]() {
+        for (size_t i = next++; i < inputs.size(); i = next++){
+          triangles[i] = triangulateSurface(inputs[i]);
+        }
+      };
+
+      size_t numThreads = std::max<size_t>(1, std::min<size_t>(std::thread::hardware_concurrency(), inputs.size()));
+      std::vector<std::thread> threads;
+      for (size_t i = 1; i < numThreads; ++i){
+        threads.push_back(std::thread(worker));
+      }
+      worker();
+      for (auto& thread : threads){
+        thread.join();
+      }
+
+      // merge in surface order so the output does not depend on scheduling
+      ThreeBinaryGeometry geometry;
+      for (size_t i = 0; i < inputs.size(); ++i){
+        geometry.addTriangles(inputs[i].materialId, triangles[i]);
+      }
+
+      return ThreeBinaryScene(makeSceneMetadata(model), geometry, materials);
     }
 
     Point3dVectorVector getFaces(const ThreeGeometryData& data)
@@ -591,11 +698,8 @@ namespace openstudio
       return result;
     }
     
-    boost::optional<Model> modelFromThreeJS(const ThreeScene& scene)
+    void addThreeSceneToModel(Model& model, const ThreeScene& scene)
     {
-
-      Model model;
-
       ThreeSceneObject sceneObject = scene.object();
       for (const auto& child : sceneObject.children()){
         boost::optional<ThreeGeometry> geometry = scene.getGeometry(child.geometry());
@@ -693,9 +797,26 @@ namespace openstudio
           }
         }
       }
+    }
 
+    boost::optional<Model> modelFromThreeJS(const ThreeScene& scene)
+    {
+      Model model;
+      addThreeSceneToModel(model, scene);
       return model;
     }
+
+    void updateModelFromThreeJS(Model& model, const ThreeScene& scene, const std::vector<std::string>& replacedSpaceNames)
+    {
+      for (const auto& spaceName : replacedSpaceNames){
+        boost::optional<Space> space = model.getConcreteModelObjectByName<Space>(spaceName);
+        if (space){
+          space->remove();
+        }
+      }
+
+      addThreeSceneToModel(model, scene);
+    }
     
   }//model
 }//openstudio
@@ -43,9 +43,17 @@ namespace openstudio
     /// Triangulate surfaces if the ThreeJS representation will be used for display
     /// Do not triangulate surfaces if the ThreeJs representation will be translated back to a model
     MODEL_API ThreeScene modelToThreeJS(Model model, bool triangulateSurfaces);
+
+    /// Convert an OpenStudio Model to a triangulated binary buffer for display
+    /// Vertices are shared within each surface but not between surfaces, triangles are grouped into one draw batch per material
+    MODEL_API ThreeBinaryScene modelToThreeJSBinary(Model model);
     
     MODEL_API boost::optional<Model> modelFromThreeJS(const ThreeScene& scene);
 
+    /// Update a Model created by modelFromThreeJS in place, the named spaces are removed and then the surfaces in scene are added
+    /// Use with FloorplanJS::diff and FloorplanJS::toThreeScene so only spaces changed by an edit are rebuilt
+    MODEL_API void updateModelFromThreeJS(Model& model, const ThreeScene& scene, const std::vector<std::string>& replacedSpaceNames);
+
   }
 }
 #endif //MODEL_THREEJS_HPP
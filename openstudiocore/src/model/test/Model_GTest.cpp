@@ -42,6 +42,10 @@
 #include "../OutputVariable.hpp"
 #include "../OutputVariable_Impl.hpp"
 #include "../ParentObject_Impl.hpp"
+#include "../ResourceObject.hpp"
+#include "../ResourceObject_Impl.hpp"
+#include "../PlanarSurface.hpp"
+#include "../PlanarSurface_Impl.hpp"
 #include "../RunPeriod.hpp"
 
 #include "../Site.hpp"
@@ -67,12 +71,17 @@
 #include "../Space.hpp"
 #include "../Space_Impl.hpp"
 #include "../Surface.hpp"
+#include "../SubSurface.hpp"
 #include "../Surface_Impl.hpp"
 
 #include "../FanConstantVolume.hpp"
 #include "../FanConstantVolume_Impl.hpp"
 #include "../AirLoopHVAC.hpp"
 #include "../AirLoopHVAC_Impl.hpp"
+#include "../HVACComponent.hpp"
+#include "../HVACComponent_Impl.hpp"
+#include "../PlantLoop.hpp"
+#include "../ScheduleDay.hpp"
 
 #include "../../utilities/sql/SqlFile.hpp"
 #include "../../utilities/data/TimeSeries.hpp"
@@ -80,10 +89,18 @@
 #include "../../utilities/idf/Workspace.hpp"
 #include "../../utilities/idf/WorkspaceObject.hpp"
 #include "../../utilities/idf/ValidityReport.hpp"
+#include "../../utilities/idf/IdfObjectWatcher.hpp"
+#include "../../utilities/geometry/Point3d.hpp"
+#include "../../utilities/geometry/Vector3d.hpp"
+#include "../../utilities/geometry/Transformation.hpp"
+#include "../../utilities/time/Time.hpp"
 
 #include <utilities/idd/IddEnums.hxx>
 
 #include <boost/algorithm/string/case_conv.hpp>
+#include <algorithm>
+#include <sstream>
+#include <thread>
 
 using namespace openstudio::model;
 using namespace openstudio;
@@ -434,6 +451,41 @@ TEST_F(ModelFixture, ExampleModel)
   }
 }
 
+TEST_F(ModelFixture, ExampleModel_GetModelObjectsByImplType)
+{
+  Model model = exampleModel();
+
+  // compare against casting every object in the model
+  std::vector<Handle> expectedParents;
+  std::vector<Handle> expectedResources;
+  std::vector<Handle> expectedSurfaces;
+  for (const WorkspaceObject& object : model.objects()) {
+    if (object.optionalCast<ParentObject>()) {
+      expectedParents.push_back(object.handle());
+    }
+    if (object.optionalCast<ResourceObject>()) {
+      expectedResources.push_back(object.handle());
+    }
+    if (object.optionalCast<PlanarSurface>()) {
+      expectedSurfaces.push_back(object.handle());
+    }
+  }
+  EXPECT_FALSE(expectedParents.empty());
+  EXPECT_FALSE(expectedResources.empty());
+  EXPECT_FALSE(expectedSurfaces.empty());
+
+  // run twice, the second time uses the remembered IddObjectTypes
+  for (unsigned i = 0; i < 2; ++i) {
+    EXPECT_EQ(expectedParents, getHandles(model.getModelObjects<ParentObject>()));
+    EXPECT_EQ(expectedResources, getHandles(model.getModelObjects<ResourceObject>()));
+    EXPECT_EQ(expectedSurfaces, getHandles(model.getModelObjects<PlanarSurface>()));
+    EXPECT_EQ(model.objects().size(), model.getModelObjects<ModelObject>().size());
+  }
+
+  // concrete types give the same result as getConcreteModelObjects
+  EXPECT_EQ(getHandles(model.getConcreteModelObjects<Space>()), getHandles(model.getModelObjects<Space>()));
+}
+
 TEST_F(ModelFixture, ExampleModel_Save)
 {
   Model model = exampleModel();
@@ -451,6 +503,172 @@ TEST_F(ModelFixture, ExampleModel_Save)
   EXPECT_EQ(model.numObjects(), model2->numObjects());
 }
 
+TEST_F(ModelFixture, ExampleModel_Snapshot)
+{
+  Model model = exampleModel();
+
+  openstudio::path path = toPath("./ExampleModel_Snapshot.snap");
+  EXPECT_TRUE(model.saveSnapshot(path, true));
+
+  openstudio::path textPath = toPath("./ExampleModel_Snapshot.osm");
+  EXPECT_TRUE(model.save(textPath, true));
+  openstudio::Time start = openstudio::Time::currentTime();
+  boost::optional<Model> textModel = Model::load(textPath);
+  openstudio::Time textLoadTime = openstudio::Time::currentTime() - start;
+  ASSERT_TRUE(textModel);
+
+  start = openstudio::Time::currentTime();
+  boost::optional<Model> model2 = Model::loadSnapshot(path);
+  openstudio::Time snapshotLoadTime = openstudio::Time::currentTime() - start;
+  ASSERT_TRUE(model2);
+  LOG(Info, "Model loaded from osm text in " << textLoadTime << "s, from snapshot in "
+      << snapshotLoadTime << "s.");
+
+  ASSERT_EQ(model.numObjects(), model2->numObjects());
+  EXPECT_EQ(textModel->numObjects(), model2->numObjects());
+
+  // pointers between objects are restored
+  ThermalZoneVector zones = model2->getModelObjects<ThermalZone>();
+  ASSERT_FALSE(zones.empty());
+  EXPECT_FALSE(zones[0].spaces().empty());
+  for (const Space& space : model2->getConcreteModelObjects<Space>()) {
+    boost::optional<Space> original = model.getModelObject<Space>(space.handle());
+    ASSERT_TRUE(original);
+    ASSERT_EQ(original->thermalZone().is_initialized(), space.thermalZone().is_initialized());
+    if (space.thermalZone()) {
+      EXPECT_EQ(original->thermalZone()->handle(), space.thermalZone()->handle());
+    }
+  }
+
+  // snapshot prints exactly like the saved model
+  boost::optional<IdfFile> idfFile = IdfFile::loadSnapshot(path);
+  ASSERT_TRUE(idfFile);
+  std::stringstream ss1;
+  std::stringstream ss2;
+  model.toIdfFile().print(ss1);
+  idfFile->print(ss2);
+  EXPECT_EQ(ss1.str(), ss2.str());
+}
+
+TEST_F(ModelFixture, ExampleModel_Navigation)
+{
+  Model model = exampleModel();
+  std::vector<ThermalZone> zones = model.getConcreteModelObjects<ThermalZone>();
+  std::vector<Space> spaces = model.getConcreteModelObjects<Space>();
+  ASSERT_FALSE(zones.empty());
+  ASSERT_FALSE(spaces.empty());
+
+  openstudio::Time start = openstudio::Time::currentTime();
+  unsigned n = 0;
+  for (unsigned i = 0; i < 100; ++i) {
+    for (const ThermalZone& zone : zones) {
+      n += zone.spaces().size();
+    }
+    for (const Space& space : spaces) {
+      for (const Surface& surface : space.surfaces()) {
+        n += surface.subSurfaces().size() + 1;
+      }
+    }
+  }
+  openstudio::Time navigationTime = openstudio::Time::currentTime() - start;
+  EXPECT_GT(n, 0u);
+  LOG(Info, "Navigated zones, spaces and surfaces 100 times in " << navigationTime << "s.");
+}
+
+namespace {
+
+  // read-only pass over the geometry and HVAC of a model, returns a digest of what it saw
+  double readModel(const Model& model)
+  {
+    double result = 0.0;
+    for (const Space& space : model.getConcreteModelObjects<Space>()) {
+      result += space.floorArea();
+      for (const Surface& surface : space.surfaces()) {
+        result += surface.grossArea() + surface.netArea() + surface.outwardNormal().z();
+        result += surface.subSurfaces().size();
+        result += surface.triangulation().size();
+      }
+    }
+    for (const ThermalZone& zone : model.getConcreteModelObjects<ThermalZone>()) {
+      result += zone.spaces().size();
+      if (zone.airLoopHVAC()) {
+        result += 1.0;
+      }
+    }
+    for (const AirLoopHVAC& airLoop : model.getConcreteModelObjects<AirLoopHVAC>()) {
+      result += airLoop.supplyComponents().size() + airLoop.demandComponents().size();
+    }
+    for (const HVACComponent& component : model.getModelObjects<HVACComponent>()) {
+      if (component.airLoopHVAC() || component.plantLoop()) {
+        result += 1.0;
+      }
+    }
+    if (boost::optional<Building> building = model.building()) {
+      result += building->floorArea();
+    }
+    return result;
+  }
+
+}
+
+TEST_F(ModelFixture, ExampleModel_FrozenConcurrentReads)
+{
+  Model model = exampleModel();
+  EXPECT_TRUE(model.freeze());
+  EXPECT_TRUE(model.isFrozen());
+  double expected = readModel(model);
+  EXPECT_GT(expected, 0.0);
+
+  // stress: many threads reading the same objects at once
+  unsigned numThreads = std::max(4u, std::thread::hardware_concurrency());
+  std::vector<double> results(numThreads, 0.0);
+  std::vector<std::thread> threads;
+  for (unsigned i = 0; i < numThreads; ++i) {
+    threads.emplace_back([&model, &results, i]() {
+      for (unsigned j = 0; j < 5; ++j) {
+        results[i] = readModel(model);
+      }
+    });
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  for (double result : results) {
+    EXPECT_DOUBLE_EQ(expected, result);
+  }
+
+  // scaling: the same total work on more threads
+  unsigned numPasses = 2 * std::max(1u, std::thread::hardware_concurrency());
+  for (unsigned n = 1; n <= std::max(1u, std::thread::hardware_concurrency()); n *= 2) {
+    openstudio::Time start = openstudio::Time::currentTime();
+    threads.clear();
+    for (unsigned i = 0; i < n; ++i) {
+      threads.emplace_back([&model, numPasses, n, i]() {
+        for (unsigned j = i; j < numPasses; j += n) {
+          readModel(model);
+        }
+      });
+    }
+    for (std::thread& thread : threads) {
+      thread.join();
+    }
+    openstudio::Time readTime = openstudio::Time::currentTime() - start;
+    LOG(Info, "Read the example model " << numPasses << " times on " << n << " threads in " << readTime << "s.");
+  }
+
+  // writes are refused while frozen
+  Space space = model.getConcreteModelObjects<Space>()[0];
+  std::string name = space.name().get();
+  EXPECT_FALSE(space.setName("Frozen Space"));
+  EXPECT_EQ(name, space.name().get());
+  EXPECT_FALSE(model.addObject(IdfObject(IddObjectType::OS_Space)));
+
+  model.unfreeze();
+  EXPECT_FALSE(model.isFrozen());
+  EXPECT_TRUE(space.setName("Thawed Space"));
+  EXPECT_DOUBLE_EQ(expected, readModel(model));
+}
+
 TEST_F(ModelFixture, ExampleModel_StagedLoad) {
   Model model = exampleModel();
   openstudio::path path = toPath("./example.osm");
@@ -531,6 +749,63 @@ TEST_F(ModelFixture, Model_building) {
   EXPECT_FALSE(building);
 }
 
+TEST_F(ModelFixture, Model_ChangeBatchLocalCaches)
+{
+  Model model;
+
+  ScheduleDay daySchedule(model);
+
+  Space space(model);
+  std::vector<Point3d> points;
+  points.push_back(Point3d(0, 0, 0));
+  points.push_back(Point3d(0, 1, 0));
+  points.push_back(Point3d(1, 1, 0));
+  points.push_back(Point3d(1, 0, 0));
+  Surface surface(points, model);
+  EXPECT_TRUE(surface.setSpace(space));
+
+  // prime the caches
+  EXPECT_EQ(1u, daySchedule.times().size());
+  Vector3d normal = surface.outwardNormal();
+  EXPECT_DOUBLE_EQ(0.0, (space.transformation() * Point3d(0, 0, 0)).x());
+
+  IdfObjectWatcher watcher(daySchedule);
+
+  {
+    WorkspaceChangeBatch batch(model);
+
+    // each addValue finds its insert position from the cached times
+    EXPECT_TRUE(daySchedule.addValue(Time(0, 17, 0), 1.0));
+    EXPECT_TRUE(daySchedule.addValue(Time(0, 8, 0), 0.5));
+    ASSERT_EQ(3u, daySchedule.times().size());
+    EXPECT_EQ(Time(0, 8, 0), daySchedule.times()[0]);
+    EXPECT_EQ(Time(0, 17, 0), daySchedule.times()[1]);
+    EXPECT_EQ(Time(0, 24, 0), daySchedule.times()[2]);
+    ASSERT_EQ(3u, daySchedule.values().size());
+    EXPECT_EQ(0.5, daySchedule.values()[0]);
+    EXPECT_EQ(1.0, daySchedule.values()[1]);
+    EXPECT_EQ(0.0, daySchedule.values()[2]);
+
+    // reversing the vertices flips the normal and plane right away
+    std::reverse(points.begin(), points.end());
+    EXPECT_TRUE(surface.setVertices(points));
+    EXPECT_DOUBLE_EQ(-normal.z(), surface.outwardNormal().z());
+    EXPECT_DOUBLE_EQ(-normal.z(), surface.plane().outwardNormal().z());
+
+    space.setXOrigin(10.0);
+    EXPECT_DOUBLE_EQ(10.0, (space.transformation() * Point3d(0, 0, 0)).x());
+
+    // external notification waits for the batch to end
+    EXPECT_FALSE(watcher.dirty());
+  }
+
+  EXPECT_TRUE(watcher.dirty());
+  ASSERT_EQ(3u, daySchedule.times().size());
+  EXPECT_EQ(Time(0, 8, 0), daySchedule.times()[0]);
+  EXPECT_DOUBLE_EQ(-normal.z(), surface.outwardNormal().z());
+  EXPECT_DOUBLE_EQ(10.0, (space.transformation() * Point3d(0, 0, 0)).x());
+}
+
 TEST_F(ModelFixture, MatchSurfaces)
 {
   std::stringstream testOSMString;
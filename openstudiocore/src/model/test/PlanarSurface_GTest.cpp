@@ -31,6 +31,8 @@
 #include "ModelFixture.hpp"
 #include "../PlanarSurface.hpp"
 #include "../PlanarSurface_Impl.hpp"
+#include "../Surface.hpp"
+#include "../Surface_Impl.hpp"
 
 #include "../../utilities/units/QuantityFactory.hpp"
 #include "../../utilities/units/QuantityConverter.hpp"
@@ -86,3 +88,57 @@ TEST_F(ModelFixture, PlanarSurface_FilmResistanceConversions)
   EXPECT_NEAR(qc->value(),PlanarSurface::filmResistance(FilmResistanceType::MovingAir_7p5mph),1.0E-8);
 }
 
+
+TEST_F(ModelFixture, PlanarSurface_Vertices)
+{
+  Model model;
+
+  Point3dVector points;
+  points.push_back(Point3d(0, 0, 0.1 + 0.2));
+  points.push_back(Point3d(0, 1.0 / 3.0, 0.1 + 0.2));
+  points.push_back(Point3d(2.0 / 3.0, 1.0 / 3.0, 0.1 + 0.2));
+  Surface surface(points, model);
+  EXPECT_EQ(3u, surface.numExtensibleGroups());
+
+  // vertices after a set are what is read back from the fields
+  Point3dVector vertices = surface.vertices();
+  ASSERT_EQ(3u, vertices.size());
+  EXPECT_TRUE(surface.setName("Clear Cache"));
+  EXPECT_EQ(vertices, surface.vertices());
+
+  // same number of vertices
+  points.clear();
+  points.push_back(Point3d(0, 0, 1.0 / 7.0));
+  points.push_back(Point3d(0, 1, 1.0 / 7.0));
+  points.push_back(Point3d(1, 1, 1.0 / 7.0));
+  EXPECT_TRUE(surface.setVertices(points));
+  EXPECT_EQ(3u, surface.numExtensibleGroups());
+  vertices = surface.vertices();
+  ASSERT_EQ(3u, vertices.size());
+  EXPECT_NEAR(1.0 / 7.0, vertices[0].z(), 1.0e-12);
+  EXPECT_TRUE(surface.setName("Clear Cache Again"));
+  EXPECT_EQ(vertices, surface.vertices());
+
+  // more vertices
+  points.push_back(Point3d(1, 0, 1.0 / 7.0));
+  EXPECT_TRUE(surface.setVertices(points));
+  EXPECT_EQ(4u, surface.numExtensibleGroups());
+  vertices = surface.vertices();
+  ASSERT_EQ(4u, vertices.size());
+  EXPECT_TRUE(surface.setName("Clear Cache Once More"));
+  EXPECT_EQ(vertices, surface.vertices());
+
+  // editing a field directly is picked up
+  unsigned zIndex = surface.numNonextensibleFields() + 2;
+  EXPECT_TRUE(surface.setString(zIndex, "2"));
+  vertices = surface.vertices();
+  ASSERT_EQ(4u, vertices.size());
+  EXPECT_DOUBLE_EQ(2.0, vertices[0].z());
+
+  // only plain decimal text is a coordinate, hex is not read as 16
+  model.setStrictnessLevel(StrictnessLevel::None);
+  EXPECT_TRUE(surface.setString(zIndex, "0x10"));
+  vertices = surface.vertices();
+  ASSERT_EQ(3u, vertices.size());
+  EXPECT_DOUBLE_EQ(1.0 / 7.0, vertices[0].z());
+}
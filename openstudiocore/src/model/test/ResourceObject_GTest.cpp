@@ -39,6 +39,12 @@
 #include "../StandardsInformationConstruction_Impl.hpp"
 #include "../StandardOpaqueMaterial.hpp"
 #include "../StandardOpaqueMaterial_Impl.hpp"
+#include "../DefaultConstructionSet.hpp"
+#include "../DefaultConstructionSet_Impl.hpp"
+#include "../DefaultSurfaceConstructions.hpp"
+#include "../DefaultSurfaceConstructions_Impl.hpp"
+#include "../Space.hpp"
+#include "../Space_Impl.hpp"
 
 #include "../../utilities/core/Optional.hpp"
 
@@ -133,3 +139,56 @@ TEST_F(ModelFixture,ResourceObject_Clone) {
   EXPECT_EQ("Material with Changed Data",newConstruction.layers()[0].name().get());
   EXPECT_EQ("Material 1",anotherNewConstruction.layers()[0].name().get());
 }
+
+TEST_F(ModelFixture,ResourceObject_PurgeUnusedResourceObjects) {
+  Model model;
+
+  // used through a chain of resources
+  Space space(model);
+  DefaultConstructionSet constructionSet(model);
+  DefaultSurfaceConstructions surfaceConstructions(model);
+  Construction usedConstruction(model);
+  StandardOpaqueMaterial usedMaterial(model);
+  StandardOpaqueMaterial sharedMaterial(model);
+  MaterialVector usedLayers;
+  usedLayers.push_back(usedMaterial);
+  usedLayers.push_back(sharedMaterial);
+  EXPECT_TRUE(usedConstruction.setLayers(usedLayers));
+  EXPECT_TRUE(surfaceConstructions.setWallConstruction(usedConstruction));
+  EXPECT_TRUE(constructionSet.setDefaultExteriorSurfaceConstructions(surfaceConstructions));
+  EXPECT_TRUE(space.setDefaultConstructionSet(constructionSet));
+
+  // not used by any non-resource object, the child does not count as a use
+  Construction unusedConstruction(model);
+  StandardsInformationConstruction standardsInformation = unusedConstruction.standardsInformation();
+  StandardOpaqueMaterial unusedMaterial(model);
+  MaterialVector unusedLayers;
+  unusedLayers.push_back(unusedMaterial);
+  unusedLayers.push_back(sharedMaterial);
+  EXPECT_TRUE(unusedConstruction.setLayers(unusedLayers));
+
+  EXPECT_EQ(0u, unusedConstruction.nonResourceObjectUseCount(true));
+  EXPECT_EQ(0u, unusedMaterial.nonResourceObjectUseCount(true));
+  EXPECT_LT(0u, sharedMaterial.nonResourceObjectUseCount(true));
+
+  IdfObjectVector removedObjects = model.purgeUnusedResourceObjects();
+  EXPECT_FALSE(removedObjects.empty());
+  EXPECT_FALSE(unusedConstruction.initialized());
+  EXPECT_FALSE(standardsInformation.initialized());
+  EXPECT_FALSE(unusedMaterial.initialized());
+
+  EXPECT_TRUE(space.initialized());
+  EXPECT_TRUE(constructionSet.initialized());
+  EXPECT_TRUE(surfaceConstructions.initialized());
+  EXPECT_TRUE(usedConstruction.initialized());
+  EXPECT_TRUE(usedMaterial.initialized());
+  EXPECT_TRUE(sharedMaterial.initialized());
+  EXPECT_EQ(2u, usedConstruction.numLayers());
+
+  for (const ResourceObject& resource : model.getModelObjects<ResourceObject>()) {
+    EXPECT_LT(0u, resource.nonResourceObjectUseCount(true));
+  }
+
+  // nothing left to purge
+  EXPECT_TRUE(model.purgeUnusedResourceObjects().empty());
+}
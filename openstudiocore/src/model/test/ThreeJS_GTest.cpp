@@ -66,6 +66,44 @@ TEST_F(ModelFixture,ThreeJS_ExampleModel) {
   EXPECT_EQ(model.getConcreteModelObjects<Surface>().size(), model2->getConcreteModelObjects<Surface>().size());
 }
 
+TEST_F(ModelFixture,ThreeJS_ExampleModel_Binary) {
+  Model model = exampleModel();
+
+  ThreeBinaryScene scene = modelToThreeJSBinary(model);
+  ThreeBinaryGeometry geometry = scene.geometry();
+
+  EXPECT_LT(0u, geometry.numTriangles());
+  EXPECT_LT(0u, geometry.numVertices());
+  EXPECT_EQ(3 * geometry.numVertices(), geometry.positions().size());
+
+  std::vector<unsigned> indices = geometry.indices();
+  EXPECT_EQ(3 * geometry.numTriangles(), indices.size());
+  for (const auto& index : indices){
+    EXPECT_LT(index, geometry.numVertices());
+  }
+
+  // batches are contiguous and cover all indices
+  unsigned offset = 0;
+  for (const auto& batch : geometry.batches()){
+    EXPECT_EQ(offset, batch.indexOffset());
+    EXPECT_LT(0u, batch.indexCount());
+    offset += batch.indexCount();
+  }
+  EXPECT_EQ(indices.size(), offset);
+
+  EXPECT_EQ(12 * geometry.numVertices() + 4 * indices.size(), scene.toBinary().size());
+  EXPECT_FALSE(scene.toJSON(false).empty());
+
+  // same triangles as the json export, which does not share vertices between surfaces
+  ThreeScene threeScene = modelToThreeJS(model, true);
+  size_t numJsonTriangles = 0;
+  for (const auto& threeGeometry : threeScene.geometries()){
+    std::vector<size_t> faces = threeGeometry.data().faces();
+    numJsonTriangles += faces.size() / 4;
+  }
+  EXPECT_EQ(numJsonTriangles, geometry.numTriangles());
+}
+
 TEST_F(ModelFixture,ThreeJS_FloorplanJS) {
   openstudio::path p = resourcesPath() / toPath("utilities/Geometry/floorplan.json");
   ASSERT_TRUE(exists(p));
@@ -95,3 +133,41 @@ TEST_F(ModelFixture,ThreeJS_FloorplanJS) {
   file << json;
   file.close();
 }
+
+TEST_F(ModelFixture,ThreeJS_FloorplanJS_Update) {
+  openstudio::path p = resourcesPath() / toPath("utilities/Geometry/floorplan.json");
+  ASSERT_TRUE(exists(p));
+
+  boost::optional<FloorplanJS> floorPlan = FloorplanJS::load(toString(p));
+  ASSERT_TRUE(floorPlan);
+
+  boost::optional<Model> model = modelFromThreeJS(floorPlan->toThreeScene(true));
+  ASSERT_TRUE(model);
+  size_t numSpaces = model->getConcreteModelObjects<Space>().size();
+  size_t numSurfaces = model->getConcreteModelObjects<Surface>().size();
+
+  Json::Value value;
+  Json::Reader reader;
+  ASSERT_TRUE(reader.parse(floorPlan->toJSON(), value));
+  value["stories"][1]["geometry"]["vertices"][0]["x"] = 1.5;
+  boost::optional<FloorplanJS> floorPlan2 = FloorplanJS::load(Json::FastWriter().write(value));
+  ASSERT_TRUE(floorPlan2);
+
+  boost::optional<Space> unchanged = model->getConcreteModelObjectByName<Space>("Space 1");
+  ASSERT_TRUE(unchanged);
+  Handle unchangedHandle = unchanged->handle();
+
+  FloorplanJSDiff diff = floorPlan2->diff(*floorPlan);
+  updateModelFromThreeJS(*model, floorPlan2->toThreeScene(true, diff), diff.previousSpaceNames());
+
+  // untouched spaces keep their objects
+  EXPECT_TRUE(model->getModelObject<Space>(unchangedHandle));
+
+  // same result as converting the whole floorplan
+  boost::optional<Model> model2 = modelFromThreeJS(floorPlan2->toThreeScene(true));
+  ASSERT_TRUE(model2);
+  EXPECT_EQ(numSpaces, model->getConcreteModelObjects<Space>().size());
+  EXPECT_EQ(model2->getConcreteModelObjects<Space>().size(), model->getConcreteModelObjects<Space>().size());
+  EXPECT_EQ(model2->getConcreteModelObjects<Surface>().size(), model->getConcreteModelObjects<Surface>().size());
+  EXPECT_EQ(numSurfaces, model->getConcreteModelObjects<Surface>().size());
+}
@@ -98,7 +98,7 @@ namespace sdd {
       for (int i = 0; i < materialElements.count(); i++){
         QDomElement materialElement = materialElements.at(i).toElement();
         std::string materialName = escapeName(materialElement.text());
-        boost::optional<model::Material> material = model.getModelObjectByName<model::Material>(materialName);
+        boost::optional<model::Material> material = getModelObjectByName<model::Material>(model, materialName);
         if( ! material )
         {
           LOG(Error,"Construction: " << construction.name().get() << " references material: " << materialName << " that is not defined.");
@@ -531,7 +531,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateVRFS
   {
     auto element = vrfSysElement.firstChildElement("AvailSchRef");
     auto name = escapeName(element.text());
-    if( auto schedule = model.getModelObjectByName<model::Schedule>(name) ) {
+    if( auto schedule = getModelObjectByName<model::Schedule>(model, name) ) {
       vrf.setAvailabilitySchedule(schedule.get());
     }
   }
@@ -577,7 +577,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateVRFS
 
   {
     auto element = vrfSysElement.firstChildElement("CtrlSchRef");
-    if( auto schedule = model.getModelObjectByName<model::Schedule>(element.text().toStdString()) ) {
+    if( auto schedule = getModelObjectByName<model::Schedule>(model, element.text().toStdString()) ) {
       vrf.setThermostatPrioritySchedule(schedule.get());
     }
   }
@@ -850,7 +850,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateVRFS
       const std::function<boost::optional<model::Curve>(model::AirConditionerVariableRefrigerantFlow &)> & osGetter) {
 
     auto value = vrfSysElement.firstChildElement(QString::fromStdString(elementName)).text().toStdString();
-    auto newcurve = model.getModelObjectByName<model::Curve>(value);
+    auto newcurve = getModelObjectByName<model::Curve>(model, value);
     if( newcurve ) {
       if( auto oldcurve = osGetter(vrf) ) {
         if( oldcurve.get() != newcurve.get() ) {
@@ -1033,7 +1033,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateAirS
   boost::optional<model::Schedule> availabilitySchedule; 
   if( ! airHndlrAvailSchElement.isNull() )
   {
-      availabilitySchedule = model.getModelObjectByName<model::Schedule>(airHndlrAvailSchElement.text().toStdString());
+      availabilitySchedule = getModelObjectByName<model::Schedule>(model, airHndlrAvailSchElement.text().toStdString());
   }
 
   if( availabilitySchedule )
@@ -1527,7 +1527,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateAirS
       // MinOAFracSchRef
       QDomElement minOAFracSchRefElement = airSystemOACtrlElement.firstChildElement("MinOAFracSchRef");
       if( boost::optional<model::Schedule> schedule = 
-          model.getModelObjectByName<model::Schedule>(minOAFracSchRefElement.text().toStdString()) )
+          getModelObjectByName<model::Schedule>(model, minOAFracSchRefElement.text().toStdString()) )
       {
         oaController.setMinimumFractionofOutdoorAirSchedule(schedule.get());
       }
@@ -1535,7 +1535,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateAirS
       // MaxOAFracSchRef
       QDomElement maxOAFracSchRefElement = airSystemOACtrlElement.firstChildElement("MaxOAFracSchRef");
       if( boost::optional<model::Schedule> schedule = 
-          model.getModelObjectByName<model::Schedule>(maxOAFracSchRefElement.text().toStdString()) ) {
+          getModelObjectByName<model::Schedule>(model, maxOAFracSchRefElement.text().toStdString()) ) {
         oaController.setMaximumFractionofOutdoorAirSchedule(schedule.get());
       } else {
         // MaxOARat
@@ -1570,7 +1570,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateAirS
 
       // EconoAvailSchRef
       auto econoAvailSchRef = airSystemOACtrlElement.firstChildElement("EconoAvailSchRef").text().toStdString();
-      if( auto schedule = model.getModelObjectByName<model::Schedule>(econoAvailSchRef) ) {
+      if( auto schedule = getModelObjectByName<model::Schedule>(model, econoAvailSchRef) ) {
         oaController.setTimeofDayEconomizerControlSchedule(schedule.get());
       }
 
@@ -1620,7 +1620,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateAirS
         QDomElement oaSchRefElement = airSystemOACtrlElement.firstChildElement("OASchRef");
 
         boost::optional<model::Schedule> schedule; 
-        schedule = model.getModelObjectByName<model::Schedule>(oaSchRefElement.text().toStdString());
+        schedule = getModelObjectByName<model::Schedule>(model, oaSchRefElement.text().toStdString());
 
         if( schedule )
         {
@@ -1779,7 +1779,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateAirS
         } else if( istringEqual(tempCtrl,"Scheduled") ) {
           hx.setSupplyAirOutletTemperatureControl(true);
           auto schRef = htRcvryElement.firstChildElement("TempSetptSchRef").text().toStdString();
-          auto sch = model.getModelObjectByName<model::Schedule>(schRef);
+          auto sch = getModelObjectByName<model::Schedule>(model, schRef);
           if( sch ) {
             model::SetpointManagerScheduled spm(model,sch.get());
             spm.setName(hx.nameString() + " Setpoint");
@@ -2068,7 +2068,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateAirS
   {
     QDomElement clgSetPtSchRefElement = airSystemElement.firstChildElement("ClgSetptSchRef");
 
-    boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(clgSetPtSchRefElement.text().toStdString());
+    boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, clgSetPtSchRefElement.text().toStdString());
 
     if( ! schedule )
     {
@@ -2199,7 +2199,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateAirS
 
     QDomElement clgSetptSchRefElement = airSystemElement.firstChildElement("ClgSetptSchRef");
     std::string clgSetptSchRef = escapeName(clgSetptSchRefElement.text());
-    coolingSchedule = model.getModelObjectByName<model::Schedule>(clgSetptSchRef);
+    coolingSchedule = getModelObjectByName<model::Schedule>(model, clgSetptSchRef);
 
     if( ! coolingSchedule ) {
       LOG(Warn,nameElement.text().toStdString() << " requests scheduled dual setpoint control, but does not define schedules."
@@ -2213,7 +2213,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateAirS
 
     QDomElement htgSetptSchRefElement = airSystemElement.firstChildElement("HtgSetptSchRef");
     std::string htgSetptSchRef = escapeName(htgSetptSchRefElement.text());
-    heatingSchedule = model.getModelObjectByName<model::Schedule>(htgSetptSchRef);
+    heatingSchedule = getModelObjectByName<model::Schedule>(model, htgSetptSchRef);
 
     if( ! heatingSchedule ) {
       LOG(Warn,nameElement.text().toStdString() << " requests scheduled dual setpoint control, but does not define schedules."
@@ -2323,7 +2323,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
     QDomElement hirCurveElement = 
       heatingCoilElement.firstChildElement("FurnHIR_fPLRCrvRef");
     hirCurve = 
-      model.getModelObjectByName<model::Curve>(
+      getModelObjectByName<model::Curve>(model,
         hirCurveElement.text().toStdString());
     if( hirCurve )
     {
@@ -2559,7 +2559,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
       QDomElement totalHeatingCapacityFunctionofTemperatureCurveElement = 
         heatingCoilElement.firstChildElement("HtPumpCap_fTempCrvRef");
       totalHeatingCapacityFunctionofTemperatureCurve = 
-        model.getModelObjectByName<model::Curve>(
+        getModelObjectByName<model::Curve>(model,
           totalHeatingCapacityFunctionofTemperatureCurveElement.text().toStdString());
 
       if( ! totalHeatingCapacityFunctionofTemperatureCurve )
@@ -2580,7 +2580,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
       QDomElement totalHeatingCapacityFunctionofFlowFractionCurveElement = 
         heatingCoilElement.firstChildElement("HtPumpCap_fFlowCrvRef");
       totalHeatingCapacityFunctionofFlowFractionCurve = 
-        model.getModelObjectByName<model::Curve>(
+        getModelObjectByName<model::Curve>(model,
           totalHeatingCapacityFunctionofFlowFractionCurveElement.text().toStdString());
 
       if( ! totalHeatingCapacityFunctionofFlowFractionCurve )
@@ -2601,7 +2601,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
       QDomElement energyInputRatioFunctionofTemperatureCurveElement = 
         heatingCoilElement.firstChildElement("HtPumpEIR_fTempCrvRef");
       energyInputRatioFunctionofTemperatureCurve = 
-        model.getModelObjectByName<model::Curve>(
+        getModelObjectByName<model::Curve>(model,
           energyInputRatioFunctionofTemperatureCurveElement.text().toStdString());
 
       if( ! energyInputRatioFunctionofTemperatureCurve )
@@ -2622,7 +2622,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
       QDomElement energyInputRatioFunctionofFlowFractionCurveElement = 
         heatingCoilElement.firstChildElement("HtPumpEIR_fFlowCrvRef");
       energyInputRatioFunctionofFlowFractionCurve = 
-        model.getModelObjectByName<model::Curve>(
+        getModelObjectByName<model::Curve>(model,
           energyInputRatioFunctionofFlowFractionCurveElement.text().toStdString());
 
       if( ! energyInputRatioFunctionofFlowFractionCurve )
@@ -2642,7 +2642,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
       QDomElement partLoadFractionCorrelationCurveElement = 
         heatingCoilElement.firstChildElement("HtPumpEIR_fPLFCrvRef");
       partLoadFractionCorrelationCurve = 
-        model.getModelObjectByName<model::Curve>(
+        getModelObjectByName<model::Curve>(model,
           partLoadFractionCorrelationCurveElement.text().toStdString());
 
       if( ! partLoadFractionCorrelationCurve )
@@ -2812,7 +2812,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateFan(
   //AvailSchRef
   QDomElement availSchRefElement = fanElement.firstChildElement("AvailSchRef");
   std::string availSchRef = escapeName(availSchRefElement.text());
-  auto availSch = model.getModelObjectByName<model::Schedule>(availSchRef);
+  auto availSch = getModelObjectByName<model::Schedule>(model, availSchRef);
 
   // FanControlMethod
   QDomElement fanControlMethodElement = fanElement.firstChildElement("CtrlMthdSim");
@@ -2954,7 +2954,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateFan(
         // Pwr_fPLRCrvRef
         QDomElement pwr_fPLRCrvElement = fanElement.firstChildElement("Pwr_fPLRCrvRef");
         boost::optional<model::Curve> pwr_fPLRCrv;
-        pwr_fPLRCrv = model.getModelObjectByName<model::Curve>(pwr_fPLRCrvElement.text().toStdString());
+        pwr_fPLRCrv = getModelObjectByName<model::Curve>(model, pwr_fPLRCrvElement.text().toStdString());
         if( pwr_fPLRCrv )
         {
           fan.setFanPowerRatioFunctionofSpeedRatioCurve(pwr_fPLRCrv.get());
@@ -3088,7 +3088,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateFan(
     // Pwr_fPLRCrvRef
     QDomElement pwr_fPLRCrvElement = fanElement.firstChildElement("Pwr_fPLRCrvRef");
     boost::optional<model::Curve> pwr_fPLRCrv;
-    pwr_fPLRCrv = model.getModelObjectByName<model::Curve>(pwr_fPLRCrvElement.text().toStdString());
+    pwr_fPLRCrv = getModelObjectByName<model::Curve>(model, pwr_fPLRCrvElement.text().toStdString());
     if( pwr_fPLRCrv )
     {
       if( boost::optional<model::CurveCubic> curveCubic = pwr_fPLRCrv->optionalCast<model::CurveCubic>() )
@@ -3152,7 +3152,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateHtRc
   // AvailSchRef
   auto availSchRefElement = element.firstChildElement("AvailSchRef");
   auto availSchRef = escapeName(availSchRefElement.text());
-  auto availSch = model.getModelObjectByName<model::Schedule>(availSchRef);
+  auto availSch = getModelObjectByName<model::Schedule>(model, availSchRef);
   if( availSch ) {
     hx.setAvailabilitySchedule(availSch.get());
   }
@@ -3550,7 +3550,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
 
       boost::optional<model::Curve> coolingCurveFofTemp;
       QDomElement cap_fTempCrvRefElement = coolingCoilElement.firstChildElement("Cap_fTempCrvRef");
-      coolingCurveFofTemp = model.getModelObjectByName<model::Curve>(cap_fTempCrvRefElement.text().toStdString());
+      coolingCurveFofTemp = getModelObjectByName<model::Curve>(model, cap_fTempCrvRefElement.text().toStdString());
       if( ! coolingCurveFofTemp )
       {
         LOG(Error,"Coil: " << nameElement.text().toStdString() << "Broken Cap_fTempCrvRef");
@@ -3574,7 +3574,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
       
       boost::optional<model::Curve> coolingCurveFofFlow;
       QDomElement cap_fFlowCrvRefElement = coolingCoilElement.firstChildElement("Cap_fFlowCrvRef");
-      coolingCurveFofFlow = model.getModelObjectByName<model::Curve>(cap_fFlowCrvRefElement.text().toStdString());
+      coolingCurveFofFlow = getModelObjectByName<model::Curve>(model, cap_fFlowCrvRefElement.text().toStdString());
       if( ! coolingCurveFofFlow )
       {
         LOG(Error,"Coil: " << nameElement.text().toStdString() << "Broken Cap_fFlowCrvRef");
@@ -3594,7 +3594,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
 
       boost::optional<model::Curve> energyInputRatioFofTemp;
       QDomElement dxEIR_fTempCrvRefElement = coolingCoilElement.firstChildElement("DXEIR_fTempCrvRef");
-      energyInputRatioFofTemp = model.getModelObjectByName<model::Curve>(dxEIR_fTempCrvRefElement.text().toStdString());
+      energyInputRatioFofTemp = getModelObjectByName<model::Curve>(model, dxEIR_fTempCrvRefElement.text().toStdString());
       if( ! energyInputRatioFofTemp )
       {
         LOG(Error,"Coil: " << nameElement.text().toStdString() << "Broken DXEIR_fTempCrvRef");
@@ -3618,7 +3618,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
 
       boost::optional<model::Curve> energyInputRatioFofFlow;
       QDomElement dxEIR_fFlowCrvRefElement = coolingCoilElement.firstChildElement("DXEIR_fFlowCrvRef");
-      energyInputRatioFofFlow = model.getModelObjectByName<model::Curve>(dxEIR_fFlowCrvRefElement.text().toStdString());
+      energyInputRatioFofFlow = getModelObjectByName<model::Curve>(model, dxEIR_fFlowCrvRefElement.text().toStdString());
       if( ! energyInputRatioFofFlow )
       {
         model::CurveQuadratic _energyInputRatioFofFlow(model);
@@ -3634,7 +3634,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
 
       boost::optional<model::Curve> partLoadFraction;
       QDomElement dxEIR_fPLFCrvRefElement = coolingCoilElement.firstChildElement("DXEIR_fPLFCrvRef");
-      partLoadFraction = model.getModelObjectByName<model::Curve>(dxEIR_fPLFCrvRefElement.text().toStdString());
+      partLoadFraction = getModelObjectByName<model::Curve>(model, dxEIR_fPLFCrvRefElement.text().toStdString());
       if( ! partLoadFraction )
       {
         LOG(Error,"Coil: " << nameElement.text().toStdString() << "Broken DXEIR_fPLFCrvRef");
@@ -3744,7 +3744,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
 
       boost::optional<model::Curve> coolingCurveFofTemp;
       QDomElement cap_fTempCrvRefElement = coolingCoilElement.firstChildElement("Cap_fTempCrvRef");
-      coolingCurveFofTemp = model.getModelObjectByName<model::Curve>(cap_fTempCrvRefElement.text().toStdString());
+      coolingCurveFofTemp = getModelObjectByName<model::Curve>(model, cap_fTempCrvRefElement.text().toStdString());
       if( ! coolingCurveFofTemp )
       {
         LOG(Error,"Coil: " << nameElement.text().toStdString() << "Broken Cap_fTempCrvRef");
@@ -3768,7 +3768,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
       
       boost::optional<model::Curve> coolingCurveFofFlow;
       QDomElement cap_fFlowCrvRefElement = coolingCoilElement.firstChildElement("Cap_fFlowCrvRef");
-      coolingCurveFofFlow = model.getModelObjectByName<model::Curve>(cap_fFlowCrvRefElement.text().toStdString());
+      coolingCurveFofFlow = getModelObjectByName<model::Curve>(model, cap_fFlowCrvRefElement.text().toStdString());
       if( ! coolingCurveFofFlow )
       {
         LOG(Error,"Coil: " << nameElement.text().toStdString() << "Broken Cap_fFlowCrvRef");
@@ -3788,7 +3788,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
 
       boost::optional<model::Curve> energyInputRatioFofTemp;
       QDomElement dxEIR_fTempCrvRefElement = coolingCoilElement.firstChildElement("DXEIR_fTempCrvRef");
-      energyInputRatioFofTemp = model.getModelObjectByName<model::Curve>(dxEIR_fTempCrvRefElement.text().toStdString());
+      energyInputRatioFofTemp = getModelObjectByName<model::Curve>(model, dxEIR_fTempCrvRefElement.text().toStdString());
       if( ! energyInputRatioFofTemp )
       {
         LOG(Error,"Coil: " << nameElement.text().toStdString() << "Broken DXEIR_fTempCrvRef");
@@ -3812,7 +3812,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
 
       boost::optional<model::Curve> energyInputRatioFofFlow;
       QDomElement dxEIR_fFlowCrvRefElement = coolingCoilElement.firstChildElement("DXEIR_fFlowCrvRef");
-      energyInputRatioFofFlow = model.getModelObjectByName<model::Curve>(dxEIR_fFlowCrvRefElement.text().toStdString());
+      energyInputRatioFofFlow = getModelObjectByName<model::Curve>(model, dxEIR_fFlowCrvRefElement.text().toStdString());
       if( ! energyInputRatioFofFlow )
       {
         model::CurveQuadratic _energyInputRatioFofFlow(model);
@@ -3828,7 +3828,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
 
       boost::optional<model::Curve> partLoadFraction;
       QDomElement dxEIR_fPLFCrvRefElement = coolingCoilElement.firstChildElement("DXEIR_fPLFCrvRef");
-      partLoadFraction = model.getModelObjectByName<model::Curve>(dxEIR_fPLFCrvRefElement.text().toStdString());
+      partLoadFraction = getModelObjectByName<model::Curve>(model, dxEIR_fPLFCrvRefElement.text().toStdString());
       if( ! partLoadFraction )
       {
         LOG(Error,"Coil: " << nameElement.text().toStdString() << "Broken DXEIR_fPLFCrvRef");
@@ -4059,7 +4059,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
   // Name
   QDomElement nameElement = thermalZoneElement.firstChildElement("Name");
   std::string name = nameElement.text().toStdString();
-  optionalThermalZone = model.getModelObjectByName<model::ThermalZone>(name);
+  optionalThermalZone = getModelObjectByName<model::ThermalZone>(model, name);
 
   if( ! optionalThermalZone )
   {
@@ -4253,7 +4253,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
 
     QDomElement exhAvailSchRefElement = thermalZoneElement.firstChildElement("ExhAvailSchRef");
     std::string exhAvailSchRef = escapeName(exhAvailSchRefElement.text());
-    boost::optional<model::Schedule> exhAvailSch = model.getModelObjectByName<model::Schedule>(exhAvailSchRef);
+    boost::optional<model::Schedule> exhAvailSch = getModelObjectByName<model::Schedule>(model, exhAvailSchRef);
     if( exhAvailSch )
     {
       exhaustFan.setAvailabilitySchedule(exhAvailSch.get());
@@ -4276,7 +4276,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
 
     QDomElement exhFlowSchRefElement = thermalZoneElement.firstChildElement("ExhFlowSchRef");
     std::string exhFlowSchRef = escapeName(exhFlowSchRefElement.text());
-    boost::optional<model::Schedule> exhFlowSch = model.getModelObjectByName<model::Schedule>(exhFlowSchRef);
+    boost::optional<model::Schedule> exhFlowSch = getModelObjectByName<model::Schedule>(model, exhFlowSchRef);
     if( exhFlowSch )
     {
       exhaustFan.setFlowFractionSchedule(exhFlowSch.get());
@@ -4294,7 +4294,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
 
     QDomElement exhMinTempSchRefElement = thermalZoneElement.firstChildElement("ExhMinTempSchRef");
     std::string exhMinTempSchRef = escapeName(exhMinTempSchRefElement.text());
-    boost::optional<model::Schedule> exhMinTempSch = model.getModelObjectByName<model::Schedule>(exhMinTempSchRef);
+    boost::optional<model::Schedule> exhMinTempSch = getModelObjectByName<model::Schedule>(model, exhMinTempSchRef);
     if( exhMinTempSch )
     {
       exhaustFan.setMinimumZoneTemperatureLimitSchedule(exhMinTempSch.get());
@@ -4302,7 +4302,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
 
     QDomElement exhBalancedSchRefElement = thermalZoneElement.firstChildElement("ExhBalancedSchRef");
     std::string exhBalancedSchRef = escapeName(exhBalancedSchRefElement.text());
-    boost::optional<model::Schedule> exhBalancedSch = model.getModelObjectByName<model::Schedule>(exhBalancedSchRef);
+    boost::optional<model::Schedule> exhBalancedSch = getModelObjectByName<model::Schedule>(model, exhBalancedSchRef);
     if( exhBalancedSch )
     {
       exhaustFan.setBalancedExhaustFractionSchedule(exhBalancedSch.get());
@@ -4592,7 +4592,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
   }
 
   if( translateVentSys ) {
-    airLoopHVAC = model.getModelObjectByName<model::AirLoopHVAC>(ventSysRefElement.text().toStdString());
+    airLoopHVAC = getModelObjectByName<model::AirLoopHVAC>(model, ventSysRefElement.text().toStdString());
 
     if( airLoopHVAC && ! thermalZone.airLoopHVAC() )
     {
@@ -4603,7 +4603,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
           ventSysEquip = trmlUnit;
           airLoopHVAC->addBranchForZone(thermalZone,trmlUnit->cast<model::StraightComponent>());
           QDomElement inducedAirZnRefElement = trmlUnitElement.firstChildElement("InducedAirZnRef");
-          if( boost::optional<model::ThermalZone> tz = model.getModelObjectByName<model::ThermalZone>(inducedAirZnRefElement.text().toStdString()) )
+          if( boost::optional<model::ThermalZone> tz = getModelObjectByName<model::ThermalZone>(model, inducedAirZnRefElement.text().toStdString()) )
           {
              if( tz->isPlenum() )
              {
@@ -4679,7 +4679,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
     }
     else
     {
-      airLoopHVAC = model.getModelObjectByName<model::AirLoopHVAC>(sysInfo.SysRefElement.text().toStdString());
+      airLoopHVAC = getModelObjectByName<model::AirLoopHVAC>(model, sysInfo.SysRefElement.text().toStdString());
 
       if( airLoopHVAC && ! thermalZone.airLoopHVAC() )
       {
@@ -4690,7 +4690,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
             sysInfo.ModelObject = trmlUnit;
             airLoopHVAC->addBranchForZone(thermalZone,trmlUnit->cast<model::StraightComponent>());
             QDomElement inducedAirZnRefElement = trmlUnitElement.firstChildElement("InducedAirZnRef");
-            if( boost::optional<model::ThermalZone> tz = model.getModelObjectByName<model::ThermalZone>(inducedAirZnRefElement.text().toStdString()) )
+            if( boost::optional<model::ThermalZone> tz = getModelObjectByName<model::ThermalZone>(model, inducedAirZnRefElement.text().toStdString()) )
             {
                if( tz->isPlenum() )
                {
@@ -4845,7 +4845,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
   QDomElement clgTstatSchRefElement = thermalZoneElement.firstChildElement("ClgTstatSchRef");
   if (!clgTstatSchRefElement.isNull()){
     std::string scheduleName = escapeName(clgTstatSchRefElement.text());
-    boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+    boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, scheduleName);
     if (schedule){
       if (optionalThermostat){
         optionalThermostat->setCoolingSchedule(*schedule);
@@ -4875,7 +4875,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
   QDomElement htgTstatSchRefElement = thermalZoneElement.firstChildElement("HtgTstatSchRef");
   if (!htgTstatSchRefElement.isNull()){
     std::string scheduleName = escapeName(htgTstatSchRefElement.text());
-    boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(scheduleName);
+    boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, scheduleName);
     if (schedule){
       if (optionalThermostat){
         optionalThermostat->setHeatingSchedule(*schedule);
@@ -4908,7 +4908,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
   {
     QDomElement rtnPlenumZnRefElement = thermalZoneElement.firstChildElement("RetPlenumZnRef");
     boost::optional<model::ThermalZone> returnPlenumZone;
-    returnPlenumZone = model.getModelObjectByName<model::ThermalZone>(rtnPlenumZnRefElement.text().toStdString()); 
+    returnPlenumZone = getModelObjectByName<model::ThermalZone>(model, rtnPlenumZnRefElement.text().toStdString()); 
     if( returnPlenumZone )
     {
       thermalZone.setReturnPlenum(returnPlenumZone.get());  
@@ -4916,7 +4916,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
 
     QDomElement supPlenumZnRefElement = thermalZoneElement.firstChildElement("SupPlenumZnRef");
     boost::optional<model::ThermalZone> supplyPlenumZone;
-    supplyPlenumZone = model.getModelObjectByName<model::ThermalZone>(supPlenumZnRefElement.text().toStdString());
+    supplyPlenumZone = getModelObjectByName<model::ThermalZone>(model, supPlenumZnRefElement.text().toStdString());
     if( supplyPlenumZone )
     {
       thermalZone.setSupplyPlenum(supplyPlenumZone.get());
@@ -4983,14 +4983,14 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateTher
     for( const auto & info : priAirCondInfo ) {
       if( ! info.ZnSysElement.isNull() ) {
         auto availSchRefElement = info.ZnSysElement.firstChildElement("AvailSchRef");
-        if( auto availSch = model.getModelObjectByName<model::Schedule>(availSchRefElement.text().toStdString()) ) {
+        if( auto availSch = getModelObjectByName<model::Schedule>(model, availSchRefElement.text().toStdString()) ) {
           zoneVent.setSchedule(availSch.get());
           break;
         }
       } else if( ! info.AirSysElement.isNull() ) {
         auto availSchRefElement = info.AirSysElement.firstChildElement("AvailSchRef");
-        auto availSch = model.getModelObjectByName<model::Schedule>(availSchRefElement.text().toStdString());
-        if( auto availSch = model.getModelObjectByName<model::Schedule>(availSchRefElement.text().toStdString()) ) {
+        auto availSch = getModelObjectByName<model::Schedule>(model, availSchRefElement.text().toStdString());
+        if( auto availSch = getModelObjectByName<model::Schedule>(model, availSchRefElement.text().toStdString()) ) {
           zoneVent.setSchedule(availSch.get());
           break;
         }
@@ -5022,7 +5022,7 @@ boost::optional<model::ModelObject> ReverseTranslator::translateTrmlUnit(const Q
 
   // AvailSchRef
   QDomElement availSchRefElement = trmlUnitElement.firstChildElement("AvailSchRef");
-  boost::optional<model::Schedule> availSch = model.getModelObjectByName<model::Schedule>(availSchRefElement.text().toStdString());
+  boost::optional<model::Schedule> availSch = getModelObjectByName<model::Schedule>(model, availSchRefElement.text().toStdString());
 
   // Type
   QDomElement typeElement = trmlUnitElement.firstChildElement("TypeSim");
@@ -5062,7 +5062,7 @@ boost::optional<model::ModelObject> ReverseTranslator::translateTrmlUnit(const Q
     model::AirTerminalSingleDuctVAVNoReheat terminal(model,schedule);
 
     QDomElement minAirFracSchRefElement = trmlUnitElement.firstChildElement("MinAirFracSchRef");
-    if( boost::optional<model::Schedule> minAirFracSch = model.getModelObjectByName<model::Schedule>(minAirFracSchRefElement.text().toStdString()) )
+    if( boost::optional<model::Schedule> minAirFracSch = getModelObjectByName<model::Schedule>(model, minAirFracSchRefElement.text().toStdString()) )
     {
       terminal.setZoneMinimumAirFlowInputMethod("Scheduled");
       terminal.setMinimumAirFlowFractionSchedule(minAirFracSch.get());
@@ -5120,7 +5120,7 @@ boost::optional<model::ModelObject> ReverseTranslator::translateTrmlUnit(const Q
     model::AirTerminalSingleDuctVAVReheat terminal(model,schedule,coil.get());
 
     QDomElement minAirFracSchRefElement = trmlUnitElement.firstChildElement("MinAirFracSchRef");
-    if( boost::optional<model::Schedule> minAirFracSch = model.getModelObjectByName<model::Schedule>(minAirFracSchRefElement.text().toStdString()) )
+    if( boost::optional<model::Schedule> minAirFracSch = getModelObjectByName<model::Schedule>(model, minAirFracSchRefElement.text().toStdString()) )
     {
       terminal.setZoneMinimumAirFlowMethod("Scheduled");
       terminal.setMinimumAirFlowFractionSchedule(minAirFracSch.get());
@@ -5437,7 +5437,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateFlui
 
   QDomElement nameElement = fluidSysElement.firstChildElement("Name");
 
-  if( boost::optional<model::PlantLoop> plant = model.getModelObjectByName<model::PlantLoop>(nameElement.text().toStdString()) )
+  if( boost::optional<model::PlantLoop> plant = getModelObjectByName<model::PlantLoop>(model, nameElement.text().toStdString()) )
   {
     return plant.get();
   }
@@ -5546,21 +5546,21 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateFlui
 
     {
       auto schRef = thrmlEngyStorElement.firstChildElement("ChlrOnlySchRef").text().toStdString();
-      if( auto sch = model.getModelObjectByName<model::Schedule>(schRef) ) {
+      if( auto sch = getModelObjectByName<model::Schedule>(model, schRef) ) {
         plantLoop.setPlantEquipmentOperationCoolingLoadSchedule(sch.get());
       }
     }
 
     {
       auto schRef = thrmlEngyStorElement.firstChildElement("DischrgSchRef").text().toStdString();
-      if( auto sch = model.getModelObjectByName<model::Schedule>(schRef) ) {
+      if( auto sch = getModelObjectByName<model::Schedule>(model, schRef) ) {
         plantLoop.setPrimaryPlantEquipmentOperationSchemeSchedule(sch.get());
       }
     }
 
     {
       auto schRef = thrmlEngyStorElement.firstChildElement("ChrgSchRef").text().toStdString();
-      if( auto sch = model.getModelObjectByName<model::Schedule>(schRef) ) {
+      if( auto sch = getModelObjectByName<model::Schedule>(model, schRef) ) {
         plantLoop.setComponentSetpointOperationSchemeSchedule(sch.get());
       }
     }
@@ -6035,7 +6035,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateFlui
   {
     QDomElement tempSetPtSchRefElement = fluidSysElement.firstChildElement("TempSetptSchRef");
 
-    boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(tempSetPtSchRefElement.text().toStdString());
+    boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, tempSetPtSchRefElement.text().toStdString());
 
     if( ! schedule )
     {
@@ -6461,7 +6461,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translatePump
 
     boost::optional<model::CurveCubic> pwr_fPLRCrv;
     QDomElement pwr_fPLRCrvRefElement = pumpElement.firstChildElement("Pwr_fPLRCrvRef");
-    pwr_fPLRCrv = model.getModelObjectByName<model::CurveCubic>(pwr_fPLRCrvRefElement.text().toStdString());
+    pwr_fPLRCrv = getModelObjectByName<model::CurveCubic>(model, pwr_fPLRCrvRefElement.text().toStdString());
 
     if( pwr_fPLRCrv )
     {
@@ -6523,7 +6523,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateBoil
 
   boost::optional<model::Curve> hirfPLRCrv;
   QDomElement hirfPLRCrvRefElement = boilerElement.firstChildElement("HIR_fPLRCrvRef");
-  hirfPLRCrv = model.getModelObjectByName<model::Curve>(hirfPLRCrvRefElement.text().toStdString());
+  hirfPLRCrv = getModelObjectByName<model::Curve>(model, hirfPLRCrvRefElement.text().toStdString());
   if( hirfPLRCrv )
   {
     boiler.setNormalizedBoilerEfficiencyCurve(hirfPLRCrv.get());
@@ -6722,7 +6722,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateHtRe
 
     boost::optional<model::CurveCubic> vsdFanPwrRatio_fQRatio;
     QDomElement vsdFanPwrRatio_fQRatioElement = htRejElement.firstChildElement("VSDFanPwrRatio_fQRatio");
-    vsdFanPwrRatio_fQRatio = model.getModelObjectByName<model::CurveCubic>(vsdFanPwrRatio_fQRatioElement.text().toStdString());
+    vsdFanPwrRatio_fQRatio = getModelObjectByName<model::CurveCubic>(model, vsdFanPwrRatio_fQRatioElement.text().toStdString());
 
     if( vsdFanPwrRatio_fQRatio )
     {
@@ -6957,7 +6957,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateThrm
   if( istringEqual("Zone",text) ) {
     tes.setAmbientTemperatureIndicator("Zone");
     text = tesElement.firstChildElement("StorZnRef").text().toStdString();
-    if( auto tz = model.getModelObjectByName<model::ThermalZone>(text) ) {
+    if( auto tz = getModelObjectByName<model::ThermalZone>(model, text) ) {
       tes.setAmbientTemperatureThermalZone(tz.get());
     }
   } else {
@@ -6979,7 +6979,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateThrm
   tes.setUseSideHeatTransferEffectiveness(1.0);
 
   text = tesElement.firstChildElement("DischrgSchRef").text().toStdString();
-  if( auto schedule = model.getModelObjectByName<model::Schedule>(text) ) {
+  if( auto schedule = getModelObjectByName<model::Schedule>(model, text) ) {
     tes.setUseSideAvailabilitySchedule(schedule.get());
   }
 
@@ -7001,7 +7001,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateThrm
   tes.setSourceSideHeatTransferEffectiveness(1.0);
 
   text = tesElement.firstChildElement("ChrgSchRef").text().toStdString();
-  if( auto schedule = model.getModelObjectByName<model::Schedule>(text) ) {
+  if( auto schedule = getModelObjectByName<model::Schedule>(model, text) ) {
     tes.setSourceSideAvailabilitySchedule(schedule.get());
   }
 
@@ -7116,7 +7116,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateChil
 
     {
       auto curveElement = chillerElement.firstChildElement("HIR_fPLRCrvRef");
-      if( auto curve = model.getModelObjectByName<model::Curve>(curveElement.text().toStdString()) ) {
+      if( auto curve = getModelObjectByName<model::Curve>(model, curveElement.text().toStdString()) ) {
         auto oldCurve = chiller.generatorHeatInputFunctionofPartLoadRatioCurve();
         if( chiller.setGeneratorHeatInputFunctionofPartLoadRatioCurve(curve.get()) ) {
           oldCurve.remove();
@@ -7126,7 +7126,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateChil
 
     {
       auto curveElement = chillerElement.firstChildElement("HIR_fCndTempCrvRef");
-      if( auto curve = model.getModelObjectByName<model::Curve>(curveElement.text().toStdString()) ) {
+      if( auto curve = getModelObjectByName<model::Curve>(model, curveElement.text().toStdString()) ) {
         auto oldCurve = chiller.generatorHeatInputCorrectionFunctionofCondenserTemperatureCurve();
         if( chiller.setGeneratorHeatInputCorrectionFunctionofCondenserTemperatureCurve(curve.get()) ) {
           oldCurve.remove();
@@ -7136,7 +7136,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateChil
 
     {
       auto curveElement = chillerElement.firstChildElement("HIR_fEvapTempCrvRef");
-      if( auto curve = model.getModelObjectByName<model::Curve>(curveElement.text().toStdString()) ) {
+      if( auto curve = getModelObjectByName<model::Curve>(model, curveElement.text().toStdString()) ) {
         auto oldCurve = chiller.generatorHeatInputCorrectionFunctionofChilledWaterTemperatureCurve();
         if( chiller.setGeneratorHeatInputCorrectionFunctionofChilledWaterTemperatureCurve(curve.get()) ) {
           oldCurve.remove();
@@ -7146,7 +7146,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateChil
 
     {
       auto curveElement = chillerElement.firstChildElement("Cap_fCndTempCrvRef");
-      if( auto curve = model.getModelObjectByName<model::Curve>(curveElement.text().toStdString()) ) {
+      if( auto curve = getModelObjectByName<model::Curve>(model, curveElement.text().toStdString()) ) {
         auto oldCurve = chiller.capacityCorrectionFunctionofCondenserTemperatureCurve();
         if( chiller.setCapacityCorrectionFunctionofCondenserTemperatureCurve(curve.get()) ) {
           oldCurve.remove();
@@ -7156,7 +7156,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateChil
 
     {
       auto curveElement = chillerElement.firstChildElement("Cap_fEvapTempCrvRef");
-      if( auto curve = model.getModelObjectByName<model::Curve>(curveElement.text().toStdString()) ) {
+      if( auto curve = getModelObjectByName<model::Curve>(model, curveElement.text().toStdString()) ) {
         auto oldCurve = chiller.capacityCorrectionFunctionofChilledWaterTemperatureCurve();
         if( chiller.setCapacityCorrectionFunctionofChilledWaterTemperatureCurve(curve.get()) ) {
           oldCurve.remove();
@@ -7166,7 +7166,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateChil
 
     {
       auto curveElement = chillerElement.firstChildElement("Cap_fGenTempCrvRef");
-      if( auto curve = model.getModelObjectByName<model::Curve>(curveElement.text().toStdString()) ) {
+      if( auto curve = getModelObjectByName<model::Curve>(model, curveElement.text().toStdString()) ) {
         auto oldCurve = chiller.capacityCorrectionFunctionofGeneratorTemperatureCurve();
         if( chiller.setCapacityCorrectionFunctionofGeneratorTemperatureCurve(curve.get()) ) {
           oldCurve.remove();
@@ -7177,7 +7177,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateChil
     // Cap_fTempCrvRef
     boost::optional<model::CurveBiquadratic> cap_fTempCrv;
     QDomElement cap_fTempCrvElement = chillerElement.firstChildElement("Cap_fTempCrvRef");
-    cap_fTempCrv = model.getModelObjectByName<model::CurveBiquadratic>(cap_fTempCrvElement.text().toStdString());
+    cap_fTempCrv = getModelObjectByName<model::CurveBiquadratic>(model, cap_fTempCrvElement.text().toStdString());
     if( ! cap_fTempCrv ) {
       LOG(Error,"Coil: " << name << " Broken Cap_fTempCrv");
 
@@ -7197,7 +7197,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateChil
     // EIR_fTempCrvRef
     boost::optional<model::CurveBiquadratic> eir_fTempCrv;
     QDomElement eir_fTempCrvElement = chillerElement.firstChildElement("EIR_fTempCrvRef");
-    eir_fTempCrv = model.getModelObjectByName<model::CurveBiquadratic>(eir_fTempCrvElement.text().toStdString());
+    eir_fTempCrv = getModelObjectByName<model::CurveBiquadratic>(model, eir_fTempCrvElement.text().toStdString());
     if( ! eir_fTempCrv ) {
       LOG(Error,"Coil: " << name << "Broken EIR_fTempCrvRef");
 
@@ -7217,7 +7217,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateChil
     // EIR_fPLRCrvRef
     boost::optional<model::CurveQuadratic> eir_fPLRCrv;
     QDomElement eir_fPLRCrvElement = chillerElement.firstChildElement("EIR_fPLRCrvRef");
-    eir_fPLRCrv = model.getModelObjectByName<model::CurveQuadratic>(eir_fPLRCrvElement.text().toStdString());
+    eir_fPLRCrv = getModelObjectByName<model::CurveQuadratic>(model, eir_fPLRCrvElement.text().toStdString());
     if( ! eir_fPLRCrv ) {
       LOG(Error,"Coil: " << name << "Broken EIR_fPLRCrvRef");
 
@@ -7363,7 +7363,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateWtrH
 
     // Might have to relocate after zones are available
     text = element.firstChildElement("CprsrZnRef").text().toStdString();
-    if( auto zone = model.getModelObjectByName<model::ThermalZone>(text) ) {
+    if( auto zone = getModelObjectByName<model::ThermalZone>(model, text) ) {
       heatPump.addToThermalZone(zone.get());
     }
 
@@ -7407,7 +7407,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateWtrH
     }
 
     text = element.firstChildElement("StorZnRef").text().toStdString();
-    if( auto zone = model.getModelObjectByName<model::ThermalZone>(text) ) {
+    if( auto zone = getModelObjectByName<model::ThermalZone>(model, text) ) {
       waterHeater.setAmbientTemperatureThermalZone(zone.get());
     }
 
@@ -7442,7 +7442,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateWtrH
 
 		{
   	  auto curveRef = element.firstChildElement("HIR_fPLRCrvRef").text().toStdString();
-  	  auto newcurve = model.getModelObjectByName<model::Curve>(curveRef);
+  	  auto newcurve = getModelObjectByName<model::Curve>(model, curveRef);
   	  if( newcurve ) {
   	    auto oldcurve = waterHeater.partLoadFactorCurve();
   	    if( oldcurve && (oldcurve.get() != newcurve.get()) ) {
@@ -7531,7 +7531,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateWtrH
   	    const std::function<model::Curve(model::CoilWaterHeatingAirToWaterHeatPump &)> & osGetter) {
 
   	  auto value = element.firstChildElement(QString::fromStdString(elementName)).text().toStdString();
-  	  auto newcurve = model.getModelObjectByName<model::Curve>(value);
+  	  auto newcurve = getModelObjectByName<model::Curve>(model, value);
   	  if( newcurve ) {
   	    auto oldcurve = osGetter(coil);
   	    if( oldcurve != newcurve.get() ) {
@@ -7716,7 +7716,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateWtrH
     // HIR_fPLRCrvRef
 
     QDomElement hirfPLRCrvRefElement = element.firstChildElement("HIR_fPLRCrvRef");
-    boost::optional<model::CurveCubic> hirfPLRCrv = model.getModelObjectByName<model::CurveCubic>(hirfPLRCrvRefElement.text().toStdString());
+    boost::optional<model::CurveCubic> hirfPLRCrv = getModelObjectByName<model::CurveCubic>(model, hirfPLRCrvRefElement.text().toStdString());
     if( hirfPLRCrv )
     {
       waterHeaterMixed.setPartLoadFactorCurve(hirfPLRCrv.get());
@@ -7765,7 +7765,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateZnSy
 
   if( ! scheduleElement.isNull() )
   {
-    schedule = model.getModelObjectByName<model::Schedule>(scheduleElement.text().toStdString()); 
+    schedule = getModelObjectByName<model::Schedule>(model, scheduleElement.text().toStdString()); 
   }
 
   if( ! schedule )
@@ -8474,7 +8474,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateZnSy
 
       {
         auto value = element.firstChildElement("VRFSysRef").text().toStdString();
-        auto vrfSys = model.getModelObjectByName<model::AirConditionerVariableRefrigerantFlow>(value);
+        auto vrfSys = getModelObjectByName<model::AirConditionerVariableRefrigerantFlow>(model, value);
         if( vrfSys ) {
           vrfSys->addTerminal(vrfTerminal);
         } else {
@@ -8634,7 +8634,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
       const std::function<model::Curve(model::CoilHeatingDXVariableRefrigerantFlow &)> & osGetter) {
 
     auto value = element.firstChildElement(QString::fromStdString(elementName)).text().toStdString();
-    auto newcurve = model.getModelObjectByName<model::Curve>(value);
+    auto newcurve = getModelObjectByName<model::Curve>(model, value);
     if( newcurve ) {
       auto oldcurve = osGetter(coil);
       if( oldcurve != newcurve.get() ) {
@@ -8691,7 +8691,7 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCoil
       const std::function<model::Curve(model::CoilCoolingDXVariableRefrigerantFlow &)> & osGetter) {
 
     auto value = element.firstChildElement(QString::fromStdString(elementName)).text().toStdString();
-    auto newcurve = model.getModelObjectByName<model::Curve>(value);
+    auto newcurve = getModelObjectByName<model::Curve>(model, value);
     if( newcurve ) {
       auto oldcurve = osGetter(coil);
       if( oldcurve != newcurve.get() ) {
@@ -9291,18 +9291,10 @@ boost::optional<openstudio::model::ModelObject> ReverseTranslator::translateCrvM
 
 QDomElement ReverseTranslator::findZnSysElement(const QString & znSysName,const QDomDocument & doc)
 {
-  QDomNodeList znSysElements = doc.documentElement().firstChildElement("Proj").elementsByTagName("ZnSys");
-
-  for (int i = 0; i < znSysElements.count(); i++)
+  auto it = m_znSysElements.find(znSysName);
+  if( it != m_znSysElements.end() )
   {
-    QDomElement znSysElement = znSysElements.at(i).toElement();
-
-    QDomElement znSysNameElement = znSysElement.firstChildElement("Name");
-
-    if( znSysNameElement.text() == znSysName )
-    {
-      return znSysElement;
-    }
+    return it->second;
   }
 
   return QDomElement();
@@ -9310,22 +9302,10 @@ QDomElement ReverseTranslator::findZnSysElement(const QString & znSysName,const
 
 QDomElement ReverseTranslator::findTrmlUnitElementForZone(const QString & zoneName,const QDomDocument & doc)
 {
-  QDomNodeList airSystemElements = doc.documentElement().elementsByTagName("AirSys");
-  
-  for( int i = 0; i < airSystemElements.count(); i++ )
+  auto it = m_trmlUnitElements.find(zoneName.toLower());
+  if( it != m_trmlUnitElements.end() )
   {
-    QDomElement airSystemElement = airSystemElements.at(i).toElement();
-    QDomNodeList terminalElements = airSystemElement.elementsByTagName("TrmlUnit");
-    for( int j = 0; j < terminalElements.count(); j++ )
-    {
-      QDomElement terminalElement = terminalElements.at(j).toElement();
-      QDomElement zoneServedElement = terminalElement.firstChildElement("ZnServedRef");
-  
-      if(zoneName.compare(zoneServedElement.text(),Qt::CaseInsensitive) == 0)
-      {
-        return terminalElement;
-      }
-    }
+    return it->second;
   }
 
   return QDomElement();
@@ -9333,17 +9313,10 @@ QDomElement ReverseTranslator::findTrmlUnitElementForZone(const QString & zoneNa
 
 QDomElement ReverseTranslator::findAirSysElement(const QString & airSysName,const QDomDocument & doc)
 {
-  QDomNodeList airSystemElements = doc.documentElement().elementsByTagName("AirSys");
-  
-  for( int i = 0; i < airSystemElements.count(); i++ )
+  auto it = m_airSysElements.find(airSysName.toLower());
+  if( it != m_airSysElements.end() )
   {
-    QDomElement airSystemElement = airSystemElements.at(i).toElement();
-    QDomElement airSystemNameElement = airSystemElement.firstChildElement("Name");
-  
-    if(airSysName.compare(airSystemNameElement.text(),Qt::CaseInsensitive) == 0)
-    {
-      return airSystemElement;
-    }
+    return it->second;
   }
 
   return QDomElement();
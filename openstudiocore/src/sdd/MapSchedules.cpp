@@ -78,7 +78,7 @@ namespace sdd {
     model::ScheduleDay scheduleDay(model);
     scheduleDay.setName(name);
    
-    boost::optional<model::ScheduleTypeLimits> scheduleTypeLimits = model.getModelObjectByName<model::ScheduleTypeLimits>(type);
+    boost::optional<model::ScheduleTypeLimits> scheduleTypeLimits = getModelObjectByName<model::ScheduleTypeLimits>(model, type);
     bool isTemperature = false;
     if (type == "Temperature"){
       isTemperature = true;
@@ -157,13 +157,13 @@ namespace sdd {
     scheduleWeek.setName(name);
 
 
-    boost::optional<model::ScheduleTypeLimits> scheduleTypeLimits = model.getModelObjectByName<model::ScheduleTypeLimits>(type);
+    boost::optional<model::ScheduleTypeLimits> scheduleTypeLimits = getModelObjectByName<model::ScheduleTypeLimits>(model, type);
     if (scheduleTypeLimits){
       //scheduleWeek.setScheduleTypeLimits(*scheduleTypeLimits);
     }
 
     if (!schDaySunRefElement.isNull()){
-      boost::optional<model::ScheduleDay> scheduleDay = model.getModelObjectByName<model::ScheduleDay>(escapeName(schDaySunRefElement.text()));
+      boost::optional<model::ScheduleDay> scheduleDay = getModelObjectByName<model::ScheduleDay>(model, escapeName(schDaySunRefElement.text()));
       if (scheduleDay){
         scheduleWeek.setSundaySchedule(*scheduleDay);
       }else{
@@ -172,7 +172,7 @@ namespace sdd {
     }
 
     if (!schDayMonRefElement.isNull()){
-      boost::optional<model::ScheduleDay> scheduleDay = model.getModelObjectByName<model::ScheduleDay>(escapeName(schDayMonRefElement.text()));
+      boost::optional<model::ScheduleDay> scheduleDay = getModelObjectByName<model::ScheduleDay>(model, escapeName(schDayMonRefElement.text()));
       if (scheduleDay){
         scheduleWeek.setMondaySchedule(*scheduleDay);
       }else{
@@ -181,7 +181,7 @@ namespace sdd {
     }
 
     if (!schDayTueRefElement.isNull()){
-      boost::optional<model::ScheduleDay> scheduleDay = model.getModelObjectByName<model::ScheduleDay>(escapeName(schDayTueRefElement.text()));
+      boost::optional<model::ScheduleDay> scheduleDay = getModelObjectByName<model::ScheduleDay>(model, escapeName(schDayTueRefElement.text()));
       if (scheduleDay){
         scheduleWeek.setTuesdaySchedule(*scheduleDay);
       }else{
@@ -190,7 +190,7 @@ namespace sdd {
     }
 
     if (!schDayWedRefElement.isNull()){
-      boost::optional<model::ScheduleDay> scheduleDay = model.getModelObjectByName<model::ScheduleDay>(escapeName(schDayWedRefElement.text()));
+      boost::optional<model::ScheduleDay> scheduleDay = getModelObjectByName<model::ScheduleDay>(model, escapeName(schDayWedRefElement.text()));
       if (scheduleDay){
         scheduleWeek.setWednesdaySchedule(*scheduleDay);
       }else{
@@ -199,7 +199,7 @@ namespace sdd {
     }
 
     if (!schDayThuRefElement.isNull()){
-      boost::optional<model::ScheduleDay> scheduleDay = model.getModelObjectByName<model::ScheduleDay>(escapeName(schDayThuRefElement.text()));
+      boost::optional<model::ScheduleDay> scheduleDay = getModelObjectByName<model::ScheduleDay>(model, escapeName(schDayThuRefElement.text()));
       if (scheduleDay){
         scheduleWeek.setThursdaySchedule(*scheduleDay);
       }else{
@@ -208,7 +208,7 @@ namespace sdd {
     }
 
     if (!schDayFriRefElement.isNull()){
-      boost::optional<model::ScheduleDay> scheduleDay = model.getModelObjectByName<model::ScheduleDay>(escapeName(schDayFriRefElement.text()));
+      boost::optional<model::ScheduleDay> scheduleDay = getModelObjectByName<model::ScheduleDay>(model, escapeName(schDayFriRefElement.text()));
       if (scheduleDay){
         scheduleWeek.setFridaySchedule(*scheduleDay);
       }else{
@@ -217,7 +217,7 @@ namespace sdd {
     }
 
     if (!schDaySatRefElement.isNull()){
-      boost::optional<model::ScheduleDay> scheduleDay = model.getModelObjectByName<model::ScheduleDay>(escapeName(schDaySatRefElement.text()));
+      boost::optional<model::ScheduleDay> scheduleDay = getModelObjectByName<model::ScheduleDay>(model, escapeName(schDaySatRefElement.text()));
       if (scheduleDay){
         scheduleWeek.setSaturdaySchedule(*scheduleDay);
       }else{
@@ -226,7 +226,7 @@ namespace sdd {
     }
    
     if (!schDayHolRefElement.isNull()){
-      boost::optional<model::ScheduleDay> scheduleDay = model.getModelObjectByName<model::ScheduleDay>(escapeName(schDayHolRefElement.text()));
+      boost::optional<model::ScheduleDay> scheduleDay = getModelObjectByName<model::ScheduleDay>(model, escapeName(schDayHolRefElement.text()));
       if (scheduleDay){
         scheduleWeek.setHolidaySchedule(*scheduleDay);
         scheduleWeek.setCustomDay1Schedule(*scheduleDay);
@@ -237,7 +237,7 @@ namespace sdd {
     }
 
     if (!schDayClgDDRefElement.isNull()){
-      boost::optional<model::ScheduleDay> scheduleDay = model.getModelObjectByName<model::ScheduleDay>(escapeName(schDayClgDDRefElement.text()));
+      boost::optional<model::ScheduleDay> scheduleDay = getModelObjectByName<model::ScheduleDay>(model, escapeName(schDayClgDDRefElement.text()));
       if (scheduleDay){
         scheduleWeek.setSummerDesignDaySchedule(*scheduleDay);
       }else{
@@ -246,7 +246,7 @@ namespace sdd {
     }
 
     if (!schDayHtgDDRefElement.isNull()){
-      boost::optional<model::ScheduleDay> scheduleDay = model.getModelObjectByName<model::ScheduleDay>(escapeName(schDayHtgDDRefElement.text()));
+      boost::optional<model::ScheduleDay> scheduleDay = getModelObjectByName<model::ScheduleDay>(model, escapeName(schDayHtgDDRefElement.text()));
       if (scheduleDay){
         scheduleWeek.setWinterDesignDaySchedule(*scheduleDay);
       }else{
@@ -292,7 +292,7 @@ namespace sdd {
     model::ScheduleYear scheduleYear(model);
     scheduleYear.setName(name);
     
-    boost::optional<model::ScheduleTypeLimits> scheduleTypeLimits = model.getModelObjectByName<model::ScheduleTypeLimits>(type);
+    boost::optional<model::ScheduleTypeLimits> scheduleTypeLimits = getModelObjectByName<model::ScheduleTypeLimits>(model, type);
     if (scheduleTypeLimits){
       scheduleYear.setScheduleTypeLimits(*scheduleTypeLimits);
     }
@@ -302,7 +302,7 @@ namespace sdd {
       QDomElement endDayElement = endDayElements.at(i).toElement();
       QDomElement schWeekRefElement = schWeekRefElements.at(i).toElement();
 
-      boost::optional<model::ScheduleWeek> scheduleWeek = model.getModelObjectByName<model::ScheduleWeek>(escapeName(schWeekRefElement.text()));
+      boost::optional<model::ScheduleWeek> scheduleWeek = getModelObjectByName<model::ScheduleWeek>(model, escapeName(schWeekRefElement.text()));
       if (scheduleWeek){
 
         boost::optional<model::YearDescription> yearDescription = model.getOptionalUniqueModelObject<model::YearDescription>();
@@ -28,6 +28,7 @@
 
 #include "ReverseTranslator.hpp"
 #include "../model/Model.hpp"
+#include "../model/Model_Impl.hpp"
 #include "../model/Component.hpp"
 #include "../model/ModelObject.hpp"
 #include "../model/ModelObject_Impl.hpp"
@@ -136,6 +137,10 @@
 #include <QDomElement>
 #include <QThread>
 
+#include <boost/algorithm/string/case_conv.hpp>
+
+#include <algorithm>
+
 namespace openstudio {
 namespace sdd {
 
@@ -231,6 +236,25 @@ namespace sdd {
     return translateSDD(doc.documentElement(), doc);
   }
 
+  class ReverseTranslator::ModelObjectIndexGuard
+  {
+  public:
+    ModelObjectIndexGuard(ReverseTranslator& translator, openstudio::model::Model& model)
+      : m_translator(translator), m_model(model)
+    {
+      m_translator.startModelObjectIndex(m_model);
+    }
+
+    ~ModelObjectIndexGuard()
+    {
+      m_translator.stopModelObjectIndex(m_model);
+    }
+
+  private:
+    ReverseTranslator& m_translator;
+    openstudio::model::Model m_model;
+  };
+
   boost::optional<model::Model> ReverseTranslator::translateSDD(const QDomElement& element, const QDomDocument& doc)
   {
     boost::optional<model::Model> result;
@@ -255,6 +279,9 @@ namespace sdd {
       result = openstudio::model::Model();
       result->setFastNaming(true);
 
+      buildElementIndex(doc);
+      ModelObjectIndexGuard modelObjectIndexGuard(*this, *result);
+
       // do runperiod
       boost::optional<model::ModelObject> runPeriod = translateRunPeriod(projectElement, doc, *result);
       //if (!runPeriod){
@@ -1961,7 +1988,7 @@ namespace sdd {
 
     QDomElement wtrMnTempSchRefElement = element.firstChildElement("WtrMnTempSchRef");
     if (!wtrMnTempSchRefElement.isNull()){
-      boost::optional<model::Schedule> schedule = model.getModelObjectByName<model::Schedule>(wtrMnTempSchRefElement.text().toStdString());
+      boost::optional<model::Schedule> schedule = getModelObjectByName<model::Schedule>(model, wtrMnTempSchRefElement.text().toStdString());
       if (schedule){
         model::SiteWaterMainsTemperature waterMains = model.getUniqueModelObject<model::SiteWaterMainsTemperature>();
         waterMains.setTemperatureSchedule(*schedule);
@@ -2056,24 +2083,9 @@ namespace sdd {
 
 QDomElement ReverseTranslator::supplySegment(const QString & fluidSegmentName, const QDomDocument& doc)
 {
-  QDomNodeList fluidSysElements = doc.documentElement().firstChildElement("Proj").elementsByTagName("FluidSys");
-
-  for (int i = 0; i < fluidSysElements.count(); i++) {
-    QDomElement fluidSysElement = fluidSysElements.at(i).toElement();
-    QDomNodeList fluidSegmentElements = fluidSysElement.elementsByTagName("FluidSeg");
-
-    for (int i = 0; i < fluidSegmentElements.count(); i++) {
-      QDomElement fluidSegmentElement = fluidSegmentElements.at(i).toElement();
-
-      QDomElement nameElement = fluidSegmentElement.firstChildElement("Name");
-      QDomElement typeElement = fluidSegmentElement.firstChildElement("Type");
-
-      if( (typeElement.text().toLower() == "secondarysupply" ||
-           typeElement.text().toLower() == "primarysupply" ) &&
-           nameElement.text().toLower() == fluidSegmentName.toLower() ) {
-        return fluidSegmentElement; 
-      }
-    }
+  auto it = m_supplySegmentElements.find(fluidSegmentName.toLower());
+  if( it != m_supplySegmentElements.end() ) {
+    return it->second;
   }
 
   return QDomElement();
@@ -2085,58 +2097,183 @@ boost::optional<model::PlantLoop> ReverseTranslator::loopForSupplySegment(const
   auto fluidSysElement = fluidSegmentElement.parentNode().toElement();
   auto fluidSysNameElement = fluidSysElement.firstChildElement("Name");
 
-  return model.getModelObjectByName<model::PlantLoop>(fluidSysNameElement.text().toStdString());
+  return getModelObjectByName<model::PlantLoop>(model, fluidSysNameElement.text().toStdString());
 }
 
 boost::optional<model::PlantLoop> ReverseTranslator::serviceHotWaterLoopForSupplySegment(const QString & fluidSegmentName, const QDomDocument & doc, openstudio::model::Model& model)
 {
   boost::optional<model::PlantLoop> result;
 
-  QDomNodeList fluidSysElements = doc.documentElement().firstChildElement("Proj").elementsByTagName("FluidSys");
-
-  for (int i = 0; i < fluidSysElements.count(); i++)
+  auto it = m_serviceHotWaterSysElements.find(fluidSegmentName.toLower());
+  if( it != m_serviceHotWaterSysElements.end() )
   {
-    QDomElement fluidSysElement = fluidSysElements.at(i).toElement();
+    QDomElement fluidSysElement = it->second;
 
     QDomElement fluidSysNameElement = fluidSysElement.firstChildElement("Name");
 
-    QDomElement fluidSysTypeElement = fluidSysElement.firstChildElement("Type");
-
-    if( fluidSysTypeElement.text().toLower() == "servicehotwater" )
+    if( boost::optional<model::PlantLoop> loop = getModelObjectByName<model::PlantLoop>(model, fluidSysNameElement.text().toStdString()) )
     {
-      QDomNodeList fluidSegmentElements = fluidSysElement.elementsByTagName("FluidSeg");
-
-      for (int i = 0; i < fluidSegmentElements.count(); i++)
+      return loop; 
+    }
+    else
+    {
+      if( boost::optional<model::ModelObject> mo = translateFluidSys(fluidSysElement,doc,model) )
       {
-        QDomElement fluidSegmentElement = fluidSegmentElements.at(i).toElement();
+        return mo->optionalCast<model::PlantLoop>();
+      }
+    }
+  }
+
+  return result;
+}
+
+void ReverseTranslator::buildElementIndex(const QDomDocument & doc)
+{
+  m_znSysElements.clear();
+  m_airSysElements.clear();
+  m_trmlUnitElements.clear();
+  m_supplySegmentElements.clear();
+  m_serviceHotWaterSysElements.clear();
+
+  // std::map::insert does not replace existing entries, so the first element with a given name is kept
+  // which matches the behavior of searching the document in order
+
+  QDomElement projectElement = doc.documentElement().firstChildElement("Proj");
+
+  QDomNodeList znSysElements = projectElement.elementsByTagName("ZnSys");
+  for (int i = 0; i < znSysElements.count(); i++)
+  {
+    QDomElement znSysElement = znSysElements.at(i).toElement();
+    m_znSysElements.insert(std::make_pair(znSysElement.firstChildElement("Name").text(), znSysElement));
+  }
 
-        QDomElement nameElement = fluidSegmentElement.firstChildElement("Name");
-        QDomElement typeElement = fluidSegmentElement.firstChildElement("Type");
+  QDomNodeList airSystemElements = doc.documentElement().elementsByTagName("AirSys");
+  for (int i = 0; i < airSystemElements.count(); i++)
+  {
+    QDomElement airSystemElement = airSystemElements.at(i).toElement();
+    m_airSysElements.insert(std::make_pair(airSystemElement.firstChildElement("Name").text().toLower(), airSystemElement));
 
-        if( (typeElement.text().toLower() == "secondarysupply" ||
-             typeElement.text().toLower() == "primarysupply" ) &&
-            nameElement.text().toLower() == fluidSegmentName.toLower()
-          )
+    QDomNodeList terminalElements = airSystemElement.elementsByTagName("TrmlUnit");
+    for (int j = 0; j < terminalElements.count(); j++)
+    {
+      QDomElement terminalElement = terminalElements.at(j).toElement();
+      m_trmlUnitElements.insert(std::make_pair(terminalElement.firstChildElement("ZnServedRef").text().toLower(), terminalElement));
+    }
+  }
+
+  QDomNodeList fluidSysElements = projectElement.elementsByTagName("FluidSys");
+  for (int i = 0; i < fluidSysElements.count(); i++)
+  {
+    QDomElement fluidSysElement = fluidSysElements.at(i).toElement();
+    bool isServiceHotWater = (fluidSysElement.firstChildElement("Type").text().toLower() == "servicehotwater");
+
+    QDomNodeList fluidSegmentElements = fluidSysElement.elementsByTagName("FluidSeg");
+    for (int j = 0; j < fluidSegmentElements.count(); j++)
+    {
+      QDomElement fluidSegmentElement = fluidSegmentElements.at(j).toElement();
+      QString type = fluidSegmentElement.firstChildElement("Type").text().toLower();
+      if( type == "secondarysupply" || type == "primarysupply" )
+      {
+        QString name = fluidSegmentElement.firstChildElement("Name").text().toLower();
+        m_supplySegmentElements.insert(std::make_pair(name, fluidSegmentElement));
+        if( isServiceHotWater )
         {
-          if( boost::optional<model::PlantLoop> loop = model.getModelObjectByName<model::PlantLoop>(fluidSysNameElement.text().toStdString()) )
-          {
-            return loop; 
-          }
-          else
-          {
-            if( boost::optional<model::ModelObject> mo = translateFluidSys(fluidSysElement,doc,model) )
-            {
-              return mo->optionalCast<model::PlantLoop>();
-            }
-          }
+          m_serviceHotWaterSysElements.insert(std::make_pair(name, fluidSysElement));
         }
       }
     }
   }
+}
+
+std::vector<model::ModelObject> ReverseTranslator::indexedModelObjectsByName(const std::string& name)
+{
+  for( const auto & object : m_unindexedModelObjects )
+  {
+    if( object.initialized() )
+    {
+      if( boost::optional<model::ModelObject> modelObject = object.optionalCast<model::ModelObject>() )
+      {
+        indexModelObject(*modelObject);
+      }
+    }
+  }
+  m_unindexedModelObjects.clear();
+
+  std::vector<model::ModelObject> result;
+
+  auto it = m_modelObjectsByName.find(boost::to_lower_copy(name));
+  if( it != m_modelObjectsByName.end() )
+  {
+    // drop objects that have been removed, reindex objects that have been renamed since they were indexed
+    std::vector<model::ModelObject> candidates;
+    candidates.swap(it->second);
+    for( const auto & candidate : candidates )
+    {
+      if( ! candidate.initialized() )
+      {
+        continue;
+      }
+      boost::optional<std::string> candidateName = candidate.name();
+      if( candidateName && istringEqual(*candidateName, name) )
+      {
+        result.push_back(candidate);
+      }
+      else
+      {
+        indexModelObject(candidate);
+      }
+    }
+    it->second = result;
+  }
 
   return result;
 }
 
+void ReverseTranslator::indexModelObject(const model::ModelObject& modelObject)
+{
+  if( boost::optional<std::string> name = modelObject.name() )
+  {
+    m_modelObjectsByName[boost::to_lower_copy(*name)].push_back(modelObject);
+  }
+}
+
+void ReverseTranslator::reindexModelObject(const model::ModelObject& modelObject)
+{
+  // remove the entry under the name the object had when it was indexed
+  for( auto & p : m_modelObjectsByName )
+  {
+    std::vector<model::ModelObject> & candidates = p.second;
+    candidates.erase(std::remove(candidates.begin(), candidates.end(), modelObject), candidates.end());
+  }
+  indexModelObject(modelObject);
+}
+
+void ReverseTranslator::startModelObjectIndex(openstudio::model::Model& model)
+{
+  m_modelObjectsByName.clear();
+  m_unindexedModelObjects.clear();
+
+  for( const auto & modelObject : model.modelObjects() )
+  {
+    indexModelObject(modelObject);
+  }
+
+  model.getImpl<model::detail::Model_Impl>().get()->addWorkspaceObject.connect<ReverseTranslator, &ReverseTranslator::onModelObjectAdded>(this);
+}
+
+void ReverseTranslator::stopModelObjectIndex(openstudio::model::Model& model)
+{
+  model.getImpl<model::detail::Model_Impl>().get()->addWorkspaceObject.disconnect<ReverseTranslator, &ReverseTranslator::onModelObjectAdded>(this);
+
+  m_modelObjectsByName.clear();
+  m_unindexedModelObjects.clear();
+}
+
+void ReverseTranslator::onModelObjectAdded(const WorkspaceObject& object, const openstudio::IddObjectType& type, const openstudio::UUID& handle)
+{
+  m_unindexedModelObjects.push_back(object);
+}
+
 //TODO probably should be in OS proper
 //helper method to do unit conversions;
 boost::optional<double> ReverseTranslator::unitToUnit(const double& val, const std::string& fstUnitString, const std::string& secUnitString)
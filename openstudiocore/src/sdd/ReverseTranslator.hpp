@@ -36,16 +36,20 @@
 #include "../utilities/core/Logger.hpp"
 #include "../utilities/core/StringStreamLogSink.hpp"
 
+#include "../model/Model.hpp"
 #include "../model/Schedule.hpp"
 #include "../model/AvailabilityManagerOptimumStart.hpp"
 #include "../model/AvailabilityManagerNightCycle.hpp"
 #include "../model/ConstructionBase.hpp"
 #include "../model/AirConditionerVariableRefrigerantFlow.hpp"
 
+#include <QDomElement>
+
 class QDomDocument;
-class QDomElement;
 class QDomNodeList;
 
+class SDDFixture_ReverseTranslator_RenamedReference_Test;
+
 namespace openstudio {
 
 class ProgressBar;
@@ -82,6 +86,8 @@ namespace sdd {
 
   private:
 
+    friend class ::SDDFixture_ReverseTranslator_RenamedReference_Test; // for testing
+
     std::string escapeName(QString name);
 
     // listed in translation order
@@ -158,6 +164,49 @@ namespace sdd {
     // Return the "TrmlUnit" element serving zoneName
     QDomElement findTrmlUnitElementForZone(const QString & zoneName,const QDomDocument & doc);
 
+    // Build the name indices used by the find methods above, called once per translation
+    void buildElementIndex(const QDomDocument & doc);
+    std::map<QString, QDomElement> m_znSysElements; // "ZnSys" by name
+    std::map<QString, QDomElement> m_airSysElements; // "AirSys" by lower case name
+    std::map<QString, QDomElement> m_trmlUnitElements; // "TrmlUnit" by lower case name of the zone served
+    std::map<QString, QDomElement> m_supplySegmentElements; // supply "FluidSeg" by lower case name
+    std::map<QString, QDomElement> m_serviceHotWaterSysElements; // "FluidSys" of type ServiceHotWater by lower case supply segment name
+
+    // Return the model object of type T with name, same as Model::getModelObjectByName.
+    // Lookups go through an index of the translated model by lower case name instead of searching the entire model.
+    // Objects added to the model are indexed at the next lookup, under the name they have at that time. An object
+    // renamed after it was indexed is still filed under its old name, so a miss falls back to searching the model.
+    boost::optional<T> getModelObjectByName(const openstudio::model::Model& model, const std::string& name)
+    {
+      boost::optional<T> result;
+      std::vector<T> intermediate;
+      for (const auto& candidate : indexedModelObjectsByName(name)) {
+        if (boost::optional<T> t = candidate.optionalCast<T>()) {
+          intermediate.push_back(*t);
+        }
+      }
+      if (!intermediate.empty()) {
+        OS_ASSERT(intermediate.size() == 1u);
+        result = intermediate[0];
+      } else {
+        result = model.getModelObjectByName<T>(name);
+        if (result) {
+          reindexModelObject(*result);
+        }
+      }
+      return result;
+    }
+    std::vector<model::ModelObject> indexedModelObjectsByName(const std::string& name);
+    void indexModelObject(const model::ModelObject& modelObject);
+    void reindexModelObject(const model::ModelObject& modelObject);
+    void startModelObjectIndex(openstudio::model::Model& model);
+    void stopModelObjectIndex(openstudio::model::Model& model);
+    // Indexes the model for its lifetime, the index is released however the translation exits
+    class ModelObjectIndexGuard;
+    void onModelObjectAdded(const WorkspaceObject& object, const openstudio::IddObjectType& type, const openstudio::UUID& handle);
+    std::map<std::string, std::vector<model::ModelObject> > m_modelObjectsByName; // by lower case name
+    std::vector<WorkspaceObject> m_unindexedModelObjects; // added since the last lookup
+
     model::Schedule alwaysOnSchedule(openstudio::model::Model& model);
     boost::optional<model::Schedule> m_alwaysOnSchedule;
 
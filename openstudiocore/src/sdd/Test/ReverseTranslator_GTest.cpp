@@ -39,6 +39,8 @@
 #include "../../model/Facility_Impl.hpp"
 #include "../../model/Building.hpp"
 #include "../../model/Building_Impl.hpp"
+#include "../../model/BuildingStory.hpp"
+#include "../../model/BuildingStory_Impl.hpp"
 #include "../../model/ThermalZone.hpp"
 #include "../../model/ThermalZone_Impl.hpp"
 #include "../../model/Space.hpp"
@@ -61,8 +63,107 @@
 #include <resources.hxx>
 
 #include <sstream>
+#include <fstream>
 
 using namespace openstudio::model;
 using namespace openstudio;
 
+TEST_F(SDDFixture, ReverseTranslator_RepeatedReferences)
+{
+  // two spaces reference the same zone, one reference differs in case from the zone name
+  openstudio::path inputPath = resourcesPath() / openstudio::toPath("sdd/RepeatedReferences.xml");
+  {
+    std::ofstream ofs(openstudio::toString(inputPath));
+    ofs << "<?xml version=\"1.0\" encoding=\"UTF-8\"?>\n"
+        << "<SDDXML>\n"
+        << "  <Proj>\n"
+        << "    <SimFlag>1</SimFlag>\n"
+        << "    <Bldg>\n"
+        << "      <Name>Building</Name>\n"
+        << "      <Story>\n"
+        << "        <Name>Story 1</Name>\n"
+        << "        <Spc>\n"
+        << "          <Name>Space 1</Name>\n"
+        << "          <ThrmlZnRef>Zone 1</ThrmlZnRef>\n"
+        << "        </Spc>\n"
+        << "        <Spc>\n"
+        << "          <Name>Space 2</Name>\n"
+        << "          <ThrmlZnRef>Zone 1</ThrmlZnRef>\n"
+        << "        </Spc>\n"
+        << "        <Spc>\n"
+        << "          <Name>Space 3</Name>\n"
+        << "          <ThrmlZnRef>zone 2</ThrmlZnRef>\n"
+        << "        </Spc>\n"
+        << "      </Story>\n"
+        << "      <ThrmlZn>\n"
+        << "        <Name>Zone 1</Name>\n"
+        << "      </ThrmlZn>\n"
+        << "      <ThrmlZn>\n"
+        << "        <Name>Zone 2</Name>\n"
+        << "      </ThrmlZn>\n"
+        << "    </Bldg>\n"
+        << "  </Proj>\n"
+        << "</SDDXML>\n";
+  }
 
+  openstudio::sdd::ReverseTranslator reverseTranslator;
+  boost::optional<Model> model = reverseTranslator.loadModel(inputPath);
+  ASSERT_TRUE(model);
+
+  boost::optional<BuildingStory> story = model->getModelObjectByName<BuildingStory>("Story 1");
+  ASSERT_TRUE(story);
+  boost::optional<ThermalZone> zone1 = model->getModelObjectByName<ThermalZone>("Zone 1");
+  ASSERT_TRUE(zone1);
+  boost::optional<ThermalZone> zone2 = model->getModelObjectByName<ThermalZone>("Zone 2");
+  ASSERT_TRUE(zone2);
+
+  EXPECT_EQ(3u, model->getConcreteModelObjects<Space>().size());
+  for (const std::string& spaceName : {"Space 1", "Space 2", "Space 3"}){
+    boost::optional<Space> space = model->getModelObjectByName<Space>(spaceName);
+    ASSERT_TRUE(space);
+    ASSERT_TRUE(space->buildingStory());
+    EXPECT_EQ(story->handle(), space->buildingStory()->handle());
+    ASSERT_TRUE(space->thermalZone());
+    if (spaceName == "Space 3"){
+      EXPECT_EQ(zone2->handle(), space->thermalZone()->handle());
+    } else{
+      EXPECT_EQ(zone1->handle(), space->thermalZone()->handle());
+    }
+  }
+
+  EXPECT_EQ(2u, zone1->spaces().size());
+  EXPECT_EQ(1u, zone2->spaces().size());
+}
+
+TEST_F(SDDFixture, ReverseTranslator_RenamedReference)
+{
+  Model model;
+  openstudio::sdd::ReverseTranslator reverseTranslator;
+  reverseTranslator.startModelObjectIndex(model);
+
+  ThermalZone zone(model);
+  zone.setName("Zone 1");
+  boost::optional<ThermalZone> found = reverseTranslator.getModelObjectByName<ThermalZone>(model, "Zone 1");
+  ASSERT_TRUE(found);
+  EXPECT_EQ(zone.handle(), found->handle());
+
+  // the zone is indexed under its old name, look it up by the new name first
+  zone.setName("Zone 2");
+  found = reverseTranslator.getModelObjectByName<ThermalZone>(model, "zone 2");
+  ASSERT_TRUE(found);
+  EXPECT_EQ(zone.handle(), found->handle());
+  EXPECT_FALSE(reverseTranslator.getModelObjectByName<ThermalZone>(model, "Zone 1"));
+  found = reverseTranslator.getModelObjectByName<ThermalZone>(model, "Zone 2");
+  ASSERT_TRUE(found);
+  EXPECT_EQ(zone.handle(), found->handle());
+
+  // objects of another type with the old name are found by type
+  Space space(model);
+  space.setName("Zone 1");
+  EXPECT_FALSE(reverseTranslator.getModelObjectByName<ThermalZone>(model, "Zone 1"));
+  boost::optional<Space> foundSpace = reverseTranslator.getModelObjectByName<Space>(model, "Zone 1");
+  ASSERT_TRUE(foundSpace);
+  EXPECT_EQ(space.handle(), foundSpace->handle());
+
+  reverseTranslator.stopModelObjectIndex(model);
+}
@@ -50,8 +50,136 @@
 
 #include <src/utilities/embedded_files.hxx>
 
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <ctime>
+#include <map>
+#include <sstream>
+#include <thread>
+
+#if !(_WIN32 || _MSC_VER)
+#include <sys/stat.h>
+#endif
+
 namespace openstudio{
 
+  namespace {
+
+    // Size, modification time and inode of a file when its checksum was last computed
+    struct FileStat {
+      FileStat() : size(0), modified(0), inode(0) {}
+      bool operator==(const FileStat& other) const {
+        return (size == other.size) && (modified == other.modified) && (inode == other.inode);
+      }
+      uintmax_t size;
+      std::time_t modified;
+      uintmax_t inode;
+    };
+
+    struct FileChecksumCacheEntry {
+      FileStat stat;
+      std::string checksum;
+    };
+
+    // keyed by path relative to the measure directory
+    typedef std::map<std::string, FileChecksumCacheEntry> FileChecksumCache;
+
+    boost::optional<FileStat> fileStat(const openstudio::path& p)
+    {
+      boost::system::error_code ec;
+      FileStat result;
+      result.size = openstudio::filesystem::file_size(p, ec);
+      if (ec){
+        return boost::none;
+      }
+      result.modified = openstudio::filesystem::last_write_time(p, ec);
+      if (ec){
+        return boost::none;
+      }
+#if !(_WIN32 || _MSC_VER)
+      struct stat buf;
+      if (::stat(p.c_str(), &buf) == 0){
+        result.inode = static_cast<uintmax_t>(buf.st_ino);
+      }
+#endif
+      return result;
+    }
+
+    // One line per file: size, modification time, inode, checksum, then the relative path to the end of the line
+    FileChecksumCache loadFileChecksumCache(const openstudio::path& p)
+    {
+      FileChecksumCache result;
+
+      openstudio::filesystem::ifstream file(p);
+      if (!file.is_open()){
+        return result;
+      }
+
+      std::string line;
+      while (std::getline(file, line)){
+        std::istringstream ss(line);
+        FileChecksumCacheEntry entry;
+        std::string relativePath;
+        if (ss >> entry.stat.size >> entry.stat.modified >> entry.stat.inode >> entry.checksum){
+          ss.ignore(1);
+          if (std::getline(ss, relativePath) && !relativePath.empty()){
+            result[relativePath] = entry;
+          }
+        }
+      }
+
+      return result;
+    }
+
+    void saveFileChecksumCache(const openstudio::path& p, const FileChecksumCache& cache)
+    {
+      openstudio::filesystem::ofstream file(p, std::ios_base::trunc);
+      if (!file.is_open()){
+        // the measure directory may be read only, the cache is only an optimization
+        return;
+      }
+
+      for (const auto& entry : cache){
+        file << entry.second.stat.size << ' ' << entry.second.stat.modified << ' ' << entry.second.stat.inode << ' '
+             << entry.second.checksum << ' ' << entry.first << '\n';
+      }
+    }
+
+    // Compute checksums of paths using multiple threads, results are in the same order as paths
+    std::vector<std::string> parallelChecksums(const std::vector<openstudio::path>& paths)
+    {
+      std::vector<std::string> result(paths.size());
+
+      unsigned numThreads = std::min<unsigned>(std::max(1u, std::thread::hardware_concurrency()), static_cast<unsigned>(paths.size()));
+      if (numThreads <= 1){
+        for (size_t i = 0; i < paths.size(); ++i){
+          result[i] = openstudio::checksum(paths[i]);
+        }
+        return result;
+      }
+
+      std::atomic<size_t> next(0);
+      auto worker = [&](){
+        for (size_t i = next++; i < paths.size(); i = next++){
+          result[i] = openstudio::checksum(paths[i]);
+        }
+      };
+
+      std::vector<std::thread> threads;
+      for (unsigned i = 1; i < numThreads; ++i){
+        threads.emplace_back(worker);
+      }
+      worker();
+      for (auto& thread : threads){
+        thread.join();
+      }
+
+      return result;
+    }
+
+  }
+
   void BCLMeasure::createDirectory(const openstudio::path& dir) const {
     if (exists(dir)){
       if (!isEmptyDirectory(dir)){
@@ -994,12 +1122,29 @@ namespace openstudio{
     return missing;
   }
 
+  openstudio::path BCLMeasure::fileChecksumCachePath() const
+  {
+    return m_directory / toPath(".checksums");
+  }
+
   bool BCLMeasure::checkForUpdatesFiles()
   {
     bool result = false;
 
+    // files whose size, modification time and inode match the cache and whose checksum matches the xml
+    // have not changed, only the remaining files are read to compute their checksums
+    FileChecksumCache cache = loadFileChecksumCache(fileChecksumCachePath());
+    FileChecksumCache newCache;
+
+    // modification times have limited resolution, a file modified again within that window could keep the
+    // same stat, so recently modified files are not cached and will be checksummed again next time
+    const std::time_t cacheBefore = std::time(nullptr) - 2;
+
     std::vector<BCLFileReference> filesToRemove;
-    std::vector<BCLFileReference> filesToAdd;
+    std::vector<BCLFileReference> filesToCheck;
+    std::vector<openstudio::path> pathsToCheck;
+    std::vector<std::string> cacheKeysToCheck;
+    std::vector<boost::optional<FileStat> > statsToCheck;
     for (BCLFileReference file : m_bclXML.files()) {
       std::string filename = file.fileName();
       if (!exists(file.path())){
@@ -1009,10 +1154,47 @@ namespace openstudio{
       }else if (filename.empty() || boost::starts_with(filename, ".")){
         result = true;
         filesToRemove.push_back(file);
-      }else if (file.checkForUpdate()){
+      }else{
+        std::string cacheKey = relativePath(file.path(), m_directory).generic_string();
+        boost::optional<FileStat> stat = fileStat(file.path());
+        if (stat && !cacheKey.empty()){
+          auto it = cache.find(cacheKey);
+          if (it != cache.end() && it->second.stat == *stat && it->second.checksum == file.checksum()){
+            newCache[cacheKey] = it->second;
+            continue;
+          }
+        }
+        filesToCheck.push_back(file);
+        pathsToCheck.push_back(file.path());
+        cacheKeysToCheck.push_back(cacheKey);
+        statsToCheck.push_back(stat);
+      }
+    }
+
+    std::vector<std::string> newChecksums = parallelChecksums(pathsToCheck);
+
+    std::vector<BCLFileReference> filesToAdd;
+    for (size_t i = 0; i < filesToCheck.size(); ++i){
+      BCLFileReference& file = filesToCheck[i];
+      if (file.checksum() != newChecksums[i]){
+        file.setChecksum(newChecksums[i]);
         result = true;
         filesToAdd.push_back(file);
       }
+      if (statsToCheck[i] && !cacheKeysToCheck[i].empty() && statsToCheck[i]->modified < cacheBefore){
+        FileChecksumCacheEntry entry;
+        entry.stat = *statsToCheck[i];
+        entry.checksum = newChecksums[i];
+        newCache[cacheKeysToCheck[i]] = entry;
+      }
+    }
+
+    if (newCache.size() != cache.size() || !std::equal(newCache.begin(), newCache.end(), cache.begin(),
+      [](const FileChecksumCache::value_type& a, const FileChecksumCache::value_type& b){
+        return (a.first == b.first) && (a.second.stat == b.second.stat) && (a.second.checksum == b.second.checksum);
+      }))
+    {
+      saveFileChecksumCache(fileChecksumCachePath(), newCache);
     }
 
     // look for new files and add them
@@ -320,6 +320,9 @@ namespace openstudio{
 
     std::string computeXMLChecksum() const;
 
+    // cache of file sizes, modification times and checksums used by checkForUpdatesFiles
+    openstudio::path fileChecksumCachePath() const;
+
     openstudio::path m_directory;
     BCLXML m_bclXML;
   };
@@ -34,6 +34,8 @@
 #include "../BCLFileReference.hpp"
 #include "../BCLMeasure.hpp"
 
+#include <ctime>
+
 
 using namespace openstudio;
 
@@ -145,6 +147,57 @@ TEST_F(BCLFixture, BCLMeasure_CTor)
   boost::optional<BCLMeasure> measure = BCLMeasure::load(dir);
   ASSERT_TRUE(measure);
 }
+
+TEST_F(BCLFixture, BCLMeasure_ChecksumCache)
+{
+  openstudio::path dir = resourcesPath() / toPath("/utilities/BCL/Measures/v2/SetWindowToWallRatioByFacade/");
+  boost::optional<BCLMeasure> measure = BCLMeasure::load(dir);
+  ASSERT_TRUE(measure);
+
+  openstudio::path dir2 = resourcesPath() / toPath("/utilities/BCL/Measures/v2/SetWindowToWallRatioByFacade3/");
+  if (openstudio::filesystem::exists(dir2)){
+    ASSERT_TRUE(removeDirectory(dir2));
+  }
+  ASSERT_FALSE(openstudio::filesystem::exists(dir2));
+
+  boost::optional<BCLMeasure> measure2 = measure->clone(dir2);
+  ASSERT_TRUE(measure2);
+
+  // files modified just now are not cached
+  openstudio::path cachePath = dir2 / toPath(".checksums");
+  EXPECT_FALSE(measure2->checkForUpdatesFiles());
+  EXPECT_FALSE(exists(cachePath));
+
+  // make the files look old so they are cached
+  std::time_t modified = std::time(nullptr) - 60;
+  for (const BCLFileReference& file : measure2->files()) {
+    openstudio::filesystem::last_write_time(file.path(), modified);
+  }
+  EXPECT_FALSE(measure2->checkForUpdatesFiles());
+  EXPECT_TRUE(exists(cachePath));
+  EXPECT_FALSE(measure2->checkForUpdatesFiles());
+
+  // cache is used after reloading the measure
+  measure2 = BCLMeasure::load(dir2);
+  ASSERT_TRUE(measure2);
+  EXPECT_FALSE(measure2->checkForUpdatesFiles());
+
+  // a modified file is detected even if its modification time is old
+  ASSERT_TRUE(measure2->primaryRubyScriptPath());
+  openstudio::filesystem::ofstream file(measure2->primaryRubyScriptPath().get());
+  ASSERT_TRUE(file.is_open());
+  file << "Hi";
+  file.close();
+  openstudio::filesystem::last_write_time(measure2->primaryRubyScriptPath().get(), modified - 60);
+  std::string versionId = measure2->versionId();
+  EXPECT_TRUE(measure2->checkForUpdatesFiles());
+  EXPECT_NE(versionId, measure2->versionId());
+  EXPECT_FALSE(measure2->checkForUpdatesFiles());
+
+  measure2.reset();
+  ASSERT_TRUE(removeDirectory(dir2));
+  ASSERT_FALSE(exists(dir2));
+}
 /*
 TEST_F(BCLFixture, PatApplicationMeasures)
 {
@@ -28,10 +28,13 @@
 
 #include "Checksum.hpp"
 
+#include <QFile>
+
+#include <cstdint>
+#include <cstring>
 #include <ios>
 #include <sstream>
-
-#include <boost/crc.hpp> 
+#include <vector>
 
 
 namespace openstudio {
@@ -48,41 +51,131 @@ namespace openstudio {
 
       return result;
     }
+
+    // Lookup tables for the slice-by-8 CRC-32, same polynomial as boost::crc_32_type
+    struct Crc32Tables
+    {
+      Crc32Tables()
+      {
+        for (uint32_t i = 0; i < 256; ++i) {
+          uint32_t c = i;
+          for (int k = 0; k < 8; ++k) {
+            c = (c & 1) ? ((c >> 1) ^ 0xEDB88320u) : (c >> 1);
+          }
+          table[0][i] = c;
+        }
+        for (uint32_t i = 0; i < 256; ++i) {
+          for (int slice = 1; slice < 8; ++slice) {
+            table[slice][i] = (table[slice - 1][i] >> 8) ^ table[0][table[slice - 1][i] & 0xFF];
+          }
+        }
+      }
+
+      uint32_t table[8][256];
+    };
+
+    const Crc32Tables& crc32Tables()
+    {
+      static const Crc32Tables tables;
+      return tables;
+    }
+
+    /// CRC-32 matching boost::crc_32_type, bytes ignored by checksumIgnore are skipped without copying the input
+    class Crc32
+    {
+    public:
+
+      Crc32()
+        : m_tables(crc32Tables().table), m_crc(0xFFFFFFFFu)
+      {}
+
+      void processBytes(const char* data, size_t size)
+      {
+        const char* end = data + size;
+        while (data < end) {
+          const char* cr = static_cast<const char*>(std::memchr(data, '\r', end - data));
+          if (!cr) {
+            processBlock(reinterpret_cast<const unsigned char*>(data), end - data);
+            break;
+          }
+          processBlock(reinterpret_cast<const unsigned char*>(data), cr - data);
+          data = cr + 1;
+        }
+      }
+
+      uint32_t checksum() const
+      {
+        return m_crc ^ 0xFFFFFFFFu;
+      }
+
+    private:
+
+      void processBlock(const unsigned char* p, size_t size)
+      {
+        uint32_t crc = m_crc;
+
+        // process eight bytes at a time, bytes are assembled explicitly so this does not depend on endianness
+        while (size >= 8) {
+          uint32_t one = crc ^ (uint32_t(p[0]) | (uint32_t(p[1]) << 8) | (uint32_t(p[2]) << 16) | (uint32_t(p[3]) << 24));
+          uint32_t two = uint32_t(p[4]) | (uint32_t(p[5]) << 8) | (uint32_t(p[6]) << 16) | (uint32_t(p[7]) << 24);
+          crc = m_tables[7][one & 0xFF] ^
+                m_tables[6][(one >> 8) & 0xFF] ^
+                m_tables[5][(one >> 16) & 0xFF] ^
+                m_tables[4][one >> 24] ^
+                m_tables[3][two & 0xFF] ^
+                m_tables[2][(two >> 8) & 0xFF] ^
+                m_tables[1][(two >> 16) & 0xFF] ^
+                m_tables[0][two >> 24];
+          p += 8;
+          size -= 8;
+        }
+
+        while (size > 0) {
+          crc = (crc >> 8) ^ m_tables[0][(crc ^ *p) & 0xFF];
+          ++p;
+          --size;
+        }
+
+        m_crc = crc;
+      }
+
+      const uint32_t (*m_tables)[256];
+      uint32_t m_crc;
+    };
+
+    std::string checksumString(uint32_t crc)
+    {
+      std::stringstream ss;
+      ss << std::hex << std::uppercase << crc;
+      std::string result = "00000000";
+      std::string checksum = ss.str();
+      result.replace(8-checksum.size(), checksum.size(), checksum);
+
+      return result;
+    }
   }
 
   /// return 8 character hex checksum of string
   std::string checksum(const std::string& s)
   {
-    std::stringstream ss(s);
-    return checksum(ss);
+    detail::Crc32 crc;
+    crc.processBytes(s.data(), s.size());
+    return detail::checksumString(crc.checksum());
   }
 
   /// return 8 character hex checksum of istream
   std::string checksum(std::istream& is)
   {
-    boost::crc_32_type  crc;
+    detail::Crc32 crc;
+    const std::streamsize n = 65536;
+    std::vector<char> buffer(static_cast<size_t>(n));
     do{
-      const std::streamsize n = 1024;
-      char  buffer[n];
-      is.read(buffer, n);
+      is.read(buffer.data(), n);
       std::streamsize readSize = is.gcount();
-      //crc.process_bytes(buffer, readSize);
-
-      size_t stringSize = static_cast<size_t>(readSize);
-      std::string str(buffer, stringSize);
-      str.erase( std::remove_if( str.begin(), str.end(), openstudio::detail::checksumIgnore ), str.end() );
-      stringSize = str.size();
-      
-      crc.process_bytes(str.c_str(), stringSize);
+      crc.processBytes(buffer.data(), static_cast<size_t>(readSize));
     } while ( is );
-    
-    std::stringstream ss;
-    ss << std::hex << std::uppercase << crc.checksum();
-    std::string result = "00000000";
-    std::string checksum = ss.str();
-    result.replace(8-checksum.size(), checksum.size(), checksum);
 
-    return result;
+    return detail::checksumString(crc.checksum());
   }
 
   /// return 8 character hex checksum of file contents
@@ -90,6 +183,25 @@ namespace openstudio {
   { 
     std::string result = "00000000";
     try{
+      if (!openstudio::filesystem::is_regular_file(p)){
+        return result;
+      }
+
+      // map the file into memory when possible to avoid copying it through a stream buffer
+      QFile file(toQString(p));
+      if (file.open(QIODevice::ReadOnly)){
+        qint64 size = file.size();
+        if (size == 0){
+          return result;
+        }
+        if (uchar* data = file.map(0, size)){
+          detail::Crc32 crc;
+          crc.processBytes(reinterpret_cast<const char*>(data), static_cast<size_t>(size));
+          file.unmap(data);
+          return detail::checksumString(crc.checksum());
+        }
+      }
+
       openstudio::filesystem::ifstream  ifs(p, std::ios_base::binary );
       if ( ifs ){
         result = checksum(ifs);
@@ -59,6 +59,8 @@ namespace openstudio{
 
     LogSink_Impl::~LogSink_Impl()
     {
+      LoggerSingleton::resetSinkFilter(m_sink);
+
       delete m_mutex;
     }
 
@@ -223,6 +225,8 @@ namespace openstudio{
         filterChannelRegex = *m_channelRegex;
       }
 
+      LoggerSingleton::setSinkFilter(m_sink, filterLogLevel, filterChannelRegex);
+
       if (m_threadId){
         m_sink->set_filter(expr::attr< LogLevel >("Severity") >= filterLogLevel &&
                            expr::attr< QThread* >("QThread") == m_threadId &&
@@ -45,6 +45,10 @@
 #include <boost/utility/empty_deleter.hpp>
 
 #include <sstream>
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <mutex>
 #include <stdio.h>
 #include <stdlib.h>
 
@@ -58,6 +62,88 @@ namespace keywords = boost::log::keywords;
 
 namespace openstudio{
 
+  namespace {
+
+    // Lowest level accepted by any enabled sink for each channel, lets the logging macros skip formatting
+    // messages that every sink would discard.  Kept outside of LoggerSingleton so that sinks constructed
+    // by the LoggerSingleton constructor can report their filters.
+    struct LogLevelGate
+    {
+      struct SinkFilter
+      {
+        LogLevel logLevel;
+        boost::regex channelRegex;
+      };
+
+      LogLevelGate()
+        : minLogLevel(Fatal + 1)
+      {}
+
+      // called with mutex held, lowest level accepted on the channel, thread filters are not considered
+      int channelLogLevel(const LogChannel& channel) const
+      {
+        int result = Fatal + 1;
+        for (const LogSinkBackend* sink : enabledSinks){
+          auto it = sinkFilters.find(sink);
+          if (it == sinkFilters.end()){
+            // sinks without a recorded filter accept everything
+            return Trace;
+          }
+          if (boost::regex_match(channel, it->second.channelRegex)){
+            result = std::min(result, static_cast<int>(it->second.logLevel));
+          }
+        }
+        return result;
+      }
+
+      // called with mutex held, recomputes the thresholds after a sink changes
+      void update()
+      {
+        int result = Fatal + 1;
+        for (const LogSinkBackend* sink : enabledSinks){
+          auto it = sinkFilters.find(sink);
+          if (it == sinkFilters.end()){
+            result = Trace;
+            break;
+          }
+          result = std::min(result, static_cast<int>(it->second.logLevel));
+        }
+        minLogLevel.store(result, std::memory_order_release);
+
+        for (auto& channelLevel : channelLogLevels){
+          channelLevel.second->store(channelLogLevel(channelLevel.first), std::memory_order_release);
+        }
+      }
+
+      // returns the threshold for the channel, creating it if needed, entries are never removed
+      const std::atomic<int>& channelThreshold(const LogChannel& channel)
+      {
+        std::lock_guard<std::mutex> lock(mutex);
+        auto it = channelLogLevels.find(channel);
+        if (it == channelLogLevels.end()){
+          std::unique_ptr<std::atomic<int> > threshold(new std::atomic<int>(channelLogLevel(channel)));
+          it = channelLogLevels.insert(std::make_pair(channel, std::move(threshold))).first;
+        }
+        return *it->second;
+      }
+
+      std::mutex mutex;
+      std::map<const LogSinkBackend*, SinkFilter> sinkFilters;
+      std::set<const LogSinkBackend*> enabledSinks;
+      std::set<const LogSinkBackend*> orphanedSinks; // enabled sinks whose LogSink_Impl was destroyed
+      std::map<LogChannel, std::unique_ptr<std::atomic<int> >, IstringCompare> channelLogLevels;
+      std::atomic<int> minLogLevel;
+    };
+
+    // never destroyed, classes cache references to their channel thresholds and may log during static destruction
+    LogLevelGate& logLevelGate()
+    {
+      static LogLevelGate* gate = new LogLevelGate();
+      return *gate;
+    }
+
+  }
+
   // handle Qt messages
   void logQtMessage(QtMsgType type, const char *msg)
   {
@@ -94,6 +180,30 @@ namespace openstudio{
     BOOST_LOG_SEV(openstudio::Logger::instance().loggerFromChannel(channel), level) << message;
   }
 
+  void logFree(LogLevel level, LoggerType& logger, const std::string& message)
+  {
+    BOOST_LOG_SEV(logger, level) << message;
+  }
+
+  bool logLevelEnabled(LogLevel level)
+  {
+    return static_cast<int>(level) >= logLevelGate().minLogLevel.load(std::memory_order_acquire);
+  }
+
+  bool logLevelEnabled(LogLevel level, const LogChannel& logChannel)
+  {
+    // no sink accepts the level on any channel, skip the channel lookup
+    if (!logLevelEnabled(level)){
+      return false;
+    }
+    return logLevelEnabled(level, logLevelGate().channelThreshold(logChannel));
+  }
+
+  const std::atomic<int>& logChannelThreshold(const LogChannel& logChannel)
+  {
+    return logLevelGate().channelThreshold(logChannel);
+  }
+
   LoggerSingleton::LoggerSingleton()
     : m_mutex(new QReadWriteLock())
   {
@@ -188,6 +298,11 @@ namespace openstudio{
 
       // Register the sink in the logging core
       boost::log::core::get()->add_sink(sink);
+
+      LogLevelGate& gate = logLevelGate();
+      std::lock_guard<std::mutex> gateLock(gate.mutex);
+      gate.enabledSinks.insert(sink.get());
+      gate.update();
     }
   }
 
@@ -207,7 +322,39 @@ namespace openstudio{
 
       // Register the sink in the logging core
       boost::log::core::get()->remove_sink(sink);
+
+      LogLevelGate& gate = logLevelGate();
+      std::lock_guard<std::mutex> gateLock(gate.mutex);
+      gate.enabledSinks.erase(sink.get());
+      if (gate.orphanedSinks.erase(sink.get())){
+        gate.sinkFilters.erase(sink.get());
+      }
+      gate.update();
+    }
+  }
+
+  void LoggerSingleton::setSinkFilter(const boost::shared_ptr<LogSinkBackend>& sink, LogLevel logLevel, const boost::regex& channelRegex)
+  {
+    LogLevelGate& gate = logLevelGate();
+    std::lock_guard<std::mutex> gateLock(gate.mutex);
+    gate.orphanedSinks.erase(sink.get());
+    LogLevelGate::SinkFilter& filter = gate.sinkFilters[sink.get()];
+    filter.logLevel = logLevel;
+    filter.channelRegex = channelRegex;
+    gate.update();
+  }
+
+  void LoggerSingleton::resetSinkFilter(const boost::shared_ptr<LogSinkBackend>& sink)
+  {
+    LogLevelGate& gate = logLevelGate();
+    std::lock_guard<std::mutex> gateLock(gate.mutex);
+    if (gate.enabledSinks.count(sink.get())){
+      // the backend stays in the logging core with the same filter, forget it when it is removed
+      gate.orphanedSinks.insert(sink.get());
+    } else{
+      gate.sinkFilters.erase(sink.get());
     }
+    gate.update();
   }
 
 } // openstudio
@@ -38,6 +38,7 @@
 
 #include <boost/shared_ptr.hpp>
 
+#include <atomic>
 #include <sstream>
 #include <set>
 #include <map>
@@ -45,24 +46,50 @@
 class QReadWriteLock;
 class QWriteLocker;
 
-/// defines method logChannel() to get a logger for a class
+/// defines method logChannel() to get a logger for a class, and logChannelLogger() and logChannelThreshold()
+/// to get the logger and the level threshold for that channel without looking them up on every message
+#ifdef SWIG
 #define REGISTER_LOGGER(__logChannel__) \
   static openstudio::LogChannel logChannel(){ return __logChannel__; } \
 
-/// log a message from within a registered class
+#else
+#define REGISTER_LOGGER(__logChannel__) \
+  static openstudio::LogChannel logChannel(){ return __logChannel__; } \
+  static openstudio::LoggerType& logChannelLogger(){ \
+    static openstudio::LoggerType& _logger = openstudio::Logger::instance().loggerFromChannel(logChannel()); \
+    return _logger; \
+  } \
+  static const std::atomic<int>& logChannelThreshold(){ \
+    static const std::atomic<int>& _threshold = openstudio::logChannelThreshold(logChannel()); \
+    return _threshold; \
+  } \
+
+#endif
+
+/// log a message from within a registered class, the message is only formatted
+/// if at least one enabled sink accepts messages at this level on the class channel
 #define LOG(__level__, __message__) \
-  LOG_FREE(__level__, logChannel(), __message__);
+  { \
+    if (openstudio::logLevelEnabled(__level__, logChannelThreshold())){ \
+      std::stringstream _ss1; \
+      _ss1 << __message__; \
+      openstudio::logFree(__level__, logChannelLogger(), _ss1.str()); \
+    } \
+  }
 
 /// log a message from within a registered class and throw an exception
 #define LOG_AND_THROW(__message__) \
   LOG_FREE_AND_THROW(logChannel(), __message__);
 
-/// log a message from outside a registered class
+/// log a message from outside a registered class, the message is only formatted
+/// if at least one enabled sink accepts messages at this level on the channel
 #define LOG_FREE(__level__, __channel__, __message__) \
   { \
-    std::stringstream _ss1; \
-    _ss1 << __message__; \
-    openstudio::logFree(__level__, __channel__, _ss1.str()); \
+    if (openstudio::logLevelEnabled(__level__, __channel__)){ \
+      std::stringstream _ss1; \
+      _ss1 << __message__; \
+      openstudio::logFree(__level__, __channel__, _ss1.str()); \
+    } \
   }
 
 /// log a message from outside a registered class and throw an exception
@@ -79,6 +106,29 @@ namespace openstudio{
   /// convenience function for SWIG, prefer macros in C++
   UTILITIES_API void logFree(LogLevel level, const std::string& channel, const std::string& message);
 
+  /// log a message to a logger returned by LoggerSingleton::loggerFromChannel
+  UTILITIES_API void logFree(LogLevel level, LoggerType& logger, const std::string& message);
+
+  /// returns false if no enabled sink accepts messages at this level on any channel, in which case
+  /// the message does not need to be formatted; this does not consider channel or thread filters
+  UTILITIES_API bool logLevelEnabled(LogLevel level);
+
+  /// returns false if no enabled sink accepts messages at this level on logChannel, considering
+  /// each sink's level and channel regex but not its thread filter
+  UTILITIES_API bool logLevelEnabled(LogLevel level, const LogChannel& logChannel);
+
+#ifndef SWIG
+  /// lowest level accepted by any enabled sink on logChannel, updated whenever a sink changes;
+  /// the reference stays valid for the lifetime of the program so callers can cache it
+  UTILITIES_API const std::atomic<int>& logChannelThreshold(const LogChannel& logChannel);
+
+  /// same as logLevelEnabled(level, logChannel) for a threshold returned by logChannelThreshold
+  inline bool logLevelEnabled(LogLevel level, const std::atomic<int>& channelThreshold)
+  {
+    return static_cast<int>(level) >= channelThreshold.load(std::memory_order_acquire);
+  }
+#endif
+
   /** Singleton logger class.  Singleton Logger object maintains logging state throughout
    *   program execution.
    */
@@ -114,6 +164,13 @@ namespace openstudio{
     /// removes a sink to the logging core, equivalent to logSink.disable()
     void removeSink(boost::shared_ptr<LogSinkBackend> sink);
 
+    /// records the lowest level and the channel regex accepted by a sink, called whenever the sink's filter changes
+    /// this does not access the instance so it is safe to call while the instance is constructed
+    static void setSinkFilter(const boost::shared_ptr<LogSinkBackend>& sink, LogLevel logLevel, const boost::regex& channelRegex);
+
+    /// forgets the filter recorded for a sink once it is no longer in the logging core, called when the sink is destroyed
+    static void resetSinkFilter(const boost::shared_ptr<LogSinkBackend>& sink);
+
    private:
 
     /// private constructor
@@ -34,6 +34,10 @@
 
 #include <resources.hxx>
 
+#include <boost/crc.hpp>
+
+#include <algorithm>
+
 using openstudio::path;
 using openstudio::toPath;
 using openstudio::checksum;
@@ -93,6 +97,34 @@ TEST(Checksum, Streams)
   EXPECT_EQ("00000000", checksum(ss));
 }
 
+TEST(Checksum, LargeStrings)
+{
+  // compare against boost::crc_32_type on input with carriage returns removed, large enough to span several read blocks
+  string s;
+  for (unsigned i = 0; i < 300000; ++i) {
+    s += static_cast<char>('A' + (i * 7) % 26);
+    if (i % 13 == 0) {
+      s += '\r';
+    }
+    if (i % 17 == 0) {
+      s += '\n';
+    }
+  }
+
+  string stripped(s);
+  stripped.erase(std::remove(stripped.begin(), stripped.end(), '\r'), stripped.end());
+  boost::crc_32_type crc;
+  crc.process_bytes(stripped.data(), stripped.size());
+  stringstream expected;
+  expected << std::hex << std::uppercase << crc.checksum();
+
+  EXPECT_EQ(expected.str(), checksum(s));
+  EXPECT_EQ(expected.str(), checksum(stripped));
+
+  stringstream ss(s);
+  EXPECT_EQ(expected.str(), checksum(ss));
+}
+
 TEST(Checksum, Paths)
 {
   // read a file, contents are "Hi there"
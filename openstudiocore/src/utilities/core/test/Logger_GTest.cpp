@@ -82,6 +82,14 @@ namespace
     LOG_FREE(Error, "free.channel", "Free Error");
   }
 
+  unsigned numFormatted = 0;
+
+  std::string countFormatted(const std::string& message)
+  {
+    ++numFormatted;
+    return message;
+  }
+
   void classLogging()
   {
     Hello h;
@@ -342,4 +350,87 @@ namespace
 
     EXPECT_NO_THROW(openstudio::filesystem::remove(path));
   }
+
+  TEST(LoggerTest, LogLevel_Gate)
+  {
+    openstudio::Logger::instance().standardOutLogger().disable();
+
+    StringStreamLogSink sink;
+    sink.setLogLevel(Error);
+    EXPECT_TRUE(openstudio::logLevelEnabled(Error));
+    EXPECT_TRUE(openstudio::logLevelEnabled(Fatal));
+
+    // other tests may leave sinks enabled, message is only formatted if some sink accepts it
+    bool traceEnabled = openstudio::logLevelEnabled(Trace);
+    numFormatted = 0;
+    LOG_FREE(Trace, "gate.channel", countFormatted("Gate Trace"));
+    EXPECT_EQ(traceEnabled ? 1u : 0u, numFormatted);
+    EXPECT_TRUE(sink.logMessages().empty());
+
+    sink.setLogLevel(Trace);
+    EXPECT_TRUE(openstudio::logLevelEnabled(Trace));
+    numFormatted = 0;
+    LOG_FREE(Trace, "gate.channel", countFormatted("Gate Trace"));
+    EXPECT_EQ(1u, numFormatted);
+    ASSERT_EQ(1u, sink.logMessages().size());
+    EXPECT_EQ("Gate Trace", sink.logMessages()[0].logMessage());
+
+    sink.resetStringStream();
+    sink.disable();
+    EXPECT_EQ(traceEnabled, openstudio::logLevelEnabled(Trace));
+    LOG_FREE(Trace, "gate.channel", countFormatted("Gate Trace"));
+    EXPECT_TRUE(sink.logMessages().empty());
+
+    sink.enable();
+    EXPECT_TRUE(openstudio::logLevelEnabled(Trace));
+  }
+
+  class GateTraced{
+    public:
+      void logTrace(){LOG(Trace, countFormatted("Traced Trace"));}
+      REGISTER_LOGGER("gate.traced");
+  };
+
+  class GateOther{
+    public:
+      void logTrace(){LOG(Trace, countFormatted("Other Trace"));}
+      REGISTER_LOGGER("gate.other");
+  };
+
+  TEST(LoggerTest, LogLevel_ChannelGate)
+  {
+    openstudio::Logger::instance().standardOutLogger().disable();
+
+    // other tests may leave sinks enabled, a sink for one channel must not enable the other
+    bool otherEnabled = openstudio::logLevelEnabled(Trace, "gate.other");
+
+    StringStreamLogSink sink;
+    sink.setChannelRegex(boost::regex("gate\\.traced"));
+    sink.setLogLevel(Trace);
+    EXPECT_TRUE(openstudio::logLevelEnabled(Trace, "gate.traced"));
+    EXPECT_EQ(otherEnabled, openstudio::logLevelEnabled(Trace, "gate.other"));
+
+    GateTraced traced;
+    GateOther other;
+    numFormatted = 0;
+    traced.logTrace();
+    EXPECT_EQ(1u, numFormatted);
+    numFormatted = 0;
+    other.logTrace();
+    EXPECT_EQ(otherEnabled ? 1u : 0u, numFormatted);
+    ASSERT_EQ(1u, sink.logMessages().size());
+    EXPECT_EQ("Traced Trace", sink.logMessages()[0].logMessage());
+
+    // cached class thresholds follow changes to the sink
+    sink.setLogLevel(Error);
+    numFormatted = 0;
+    traced.logTrace();
+    EXPECT_EQ(openstudio::logLevelEnabled(Trace, "gate.traced") ? 1u : 0u, numFormatted);
+
+    sink.setChannelRegex(boost::regex("gate\\..*"));
+    sink.setLogLevel(Trace);
+    numFormatted = 0;
+    other.logTrace();
+    EXPECT_EQ(1u, numFormatted);
+  }
 }
@@ -214,6 +214,38 @@ OPENSTUDIO_ENUM(BuildingSector,
   ((Commercial)(NonResidential))
   ((Residential)));
 
+/** \class TimeSeriesBucket
+ *  \brief Calendar period used to aggregate a TimeSeries.
+ *  \details Each value is assigned to the period containing the end of its reporting interval.
+ *  See the OPENSTUDIO_ENUM documentation in utilities/core/Enum.hpp. The actual macro call is: 
+ *  \code
+OPENSTUDIO_ENUM(TimeSeriesBucket,
+  ((Hourly))
+  ((Daily))
+  ((Monthly)));
+ *  \endcode */
+OPENSTUDIO_ENUM(TimeSeriesBucket,
+  ((Hourly))
+  ((Daily))
+  ((Monthly)));
+
+/** \class TimeSeriesAggregation
+ *  \brief Statistic computed over the values in each TimeSeriesBucket.
+ *  \details Mean is the unweighted mean of the values reported in the bucket.
+ *  See the OPENSTUDIO_ENUM documentation in utilities/core/Enum.hpp. The actual macro call is: 
+ *  \code
+OPENSTUDIO_ENUM(TimeSeriesAggregation,
+  ((Sum))
+  ((Mean))
+  ((Minimum))
+  ((Maximum)));
+ *  \endcode */
+OPENSTUDIO_ENUM(TimeSeriesAggregation,
+  ((Sum))
+  ((Mean))
+  ((Minimum))
+  ((Maximum)));
+
 } // openstudio
 
 #endif // UTILITIES_DATA_DATAENUMS_HPP
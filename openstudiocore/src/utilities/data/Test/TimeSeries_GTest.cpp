@@ -1129,6 +1129,221 @@ TEST_F(DataFixture,TimeSeries_AddSubtractSameTimePeriod)
   EXPECT_DOUBLE_EQ(6.75, ans.value(Time(0,1,30,0)));*/
 }
 
+TEST_F(DataFixture, TimeSeries_AddSubtractAligned)
+{
+  std::string units = "W";
+
+  Time interval = Time(0, 1);
+  Vector values = linspace(1, 8760, 8760);
+
+  DateTime firstReportDateTime(Date(MonthOfYear(MonthOfYear::Jan), 1), Time(0, 1, 0, 0));
+  std::vector<DateTime> dateTimes;
+  for (unsigned i = 0; i < 8760; ++i) {
+    dateTimes.push_back(firstReportDateTime + Time(0, i, 0, 0));
+  }
+
+  TimeSeries intervalTimeSeries(firstReportDateTime, interval, values, units);
+  TimeSeries detailedTimeSeries(dateTimes, values, units);
+
+  // interval series keep their interval
+  TimeSeries intervalSum = intervalTimeSeries + intervalTimeSeries;
+  ASSERT_EQ(8760u, intervalSum.values().size());
+  ASSERT_TRUE(intervalSum.intervalLength());
+  EXPECT_EQ(interval, intervalSum.intervalLength().get());
+  EXPECT_EQ(firstReportDateTime, intervalSum.firstReportDateTime());
+
+  // interval and detailed series reporting at the same times
+  TimeSeries mixedSum = intervalTimeSeries + detailedTimeSeries;
+  TimeSeries mixedDiff = detailedTimeSeries - intervalTimeSeries;
+  ASSERT_EQ(8760u, mixedSum.values().size());
+  ASSERT_EQ(8760u, mixedDiff.values().size());
+  for (unsigned i = 0; i < 8760; ++i) {
+    EXPECT_EQ(2 * values[i], intervalSum.values(i));
+    EXPECT_EQ(2 * values[i], mixedSum.values(i));
+    EXPECT_EQ(0, mixedDiff.values(i));
+    EXPECT_EQ(2 * values[i], mixedSum.value(dateTimes[i]));
+  }
+
+  // out of range value is not carried over
+  intervalTimeSeries.setOutOfRangeValue(-99);
+  EXPECT_EQ(0, (intervalTimeSeries + intervalTimeSeries).outOfRangeValue());
+
+  // sum of many aligned series
+  TimeSeriesVector timeSeriesVector(50, intervalTimeSeries);
+  timeSeriesVector.push_back(detailedTimeSeries);
+  TimeSeries total = openstudio::sum(timeSeriesVector);
+  ASSERT_EQ(8760u, total.values().size());
+  ASSERT_TRUE(total.intervalLength());
+  for (unsigned i = 0; i < 8760; ++i) {
+    EXPECT_EQ(51 * values[i], total.values(i));
+  }
+
+  // different units
+  timeSeriesVector.push_back(TimeSeries(firstReportDateTime, interval, values, "C"));
+  EXPECT_TRUE(openstudio::sum(timeSeriesVector).values().empty());
+}
+
+TEST_F(DataFixture, TimeSeries_SumNotAligned)
+{
+  std::string units = "W";
+
+  DateTime firstReportDateTime(Date(MonthOfYear(MonthOfYear::Feb), 21), Time(0, 1, 0, 0));
+
+  // hourly and half hourly series over the same period, and an hourly series starting an hour later
+  Vector hourlyValues = linspace(1, 24, 24);
+  Vector halfHourlyValues = linspace(1, 47, 47);
+  TimeSeries hourly(firstReportDateTime, Time(0, 1, 0, 0), hourlyValues, units);
+  TimeSeries halfHourly(firstReportDateTime, Time(0, 0, 30, 0), halfHourlyValues, units);
+  TimeSeries later(firstReportDateTime + Time(0, 1, 0, 0), Time(0, 1, 0, 0), hourlyValues, units);
+
+  TimeSeriesVector timeSeriesVector;
+  timeSeriesVector.push_back(hourly);
+  timeSeriesVector.push_back(halfHourly);
+  timeSeriesVector.push_back(later);
+
+  TimeSeries total = openstudio::sum(timeSeriesVector);
+  TimeSeries pairwise = (hourly + halfHourly) + later;
+  ASSERT_EQ(pairwise.values().size(), total.values().size());
+  EXPECT_EQ(pairwise.firstReportDateTime(), total.firstReportDateTime());
+  for (const DateTime& dateTime : total.dateTimes()) {
+    EXPECT_DOUBLE_EQ(hourly.value(dateTime) + halfHourly.value(dateTime) + later.value(dateTime), total.value(dateTime));
+    EXPECT_DOUBLE_EQ(pairwise.value(dateTime), total.value(dateTime));
+  }
+}
+
+TEST_F(DataFixture, TimeSeries_Aggregate)
+{
+  Vector values = linspace(1, 8760, 8760);
+  DateTime firstReportDateTime(Date(MonthOfYear(MonthOfYear::Jan), 1), Time(0, 1, 0, 0));
+  TimeSeries timeSeries(firstReportDateTime, Time(0, 1), values, "kW");
+
+  // last value is reported at midnight on January 1 and belongs to December 31
+  TimeSeries dailySum = timeSeries.aggregate(TimeSeriesBucket::Daily, TimeSeriesAggregation::Sum);
+  ASSERT_EQ(365u, dailySum.values().size());
+  EXPECT_EQ("kW", dailySum.units());
+  EXPECT_EQ(MonthOfYear::Jan, dailySum.firstReportDateTime().date().monthOfYear().value());
+  EXPECT_EQ(2u, dailySum.firstReportDateTime().date().dayOfMonth());
+  EXPECT_EQ(0, dailySum.firstReportDateTime().time().totalSeconds());
+  EXPECT_DOUBLE_EQ(300, dailySum.values(0));
+  EXPECT_DOUBLE_EQ(300 + 364 * 24 * 24, dailySum.values(364));
+  EXPECT_DOUBLE_EQ(300, dailySum.value(DateTime(Date(MonthOfYear(MonthOfYear::Jan), 2), Time(0))));
+  EXPECT_DOUBLE_EQ(300 + 24 * 24, dailySum.value(DateTime(Date(MonthOfYear(MonthOfYear::Jan), 2), Time(0, 1))));
+
+  TimeSeries dailyMin = timeSeries.aggregate(TimeSeriesBucket::Daily, TimeSeriesAggregation::Minimum);
+  TimeSeries dailyMax = timeSeries.aggregate(TimeSeriesBucket::Daily, TimeSeriesAggregation::Maximum);
+  TimeSeries dailyMean = timeSeries.aggregate(TimeSeriesBucket::Daily, TimeSeriesAggregation::Mean);
+  ASSERT_EQ(365u, dailyMin.values().size());
+  ASSERT_EQ(365u, dailyMax.values().size());
+  ASSERT_EQ(365u, dailyMean.values().size());
+  for (unsigned i = 0; i < 365; ++i) {
+    EXPECT_DOUBLE_EQ(24 * i + 1, dailyMin.values(i));
+    EXPECT_DOUBLE_EQ(24 * i + 24, dailyMax.values(i));
+    EXPECT_DOUBLE_EQ(24 * i + 12.5, dailyMean.values(i));
+  }
+
+  TimeSeries monthlySum = timeSeries.aggregate(TimeSeriesBucket::Monthly, TimeSeriesAggregation::Sum);
+  ASSERT_EQ(12u, monthlySum.values().size());
+  EXPECT_DOUBLE_EQ(744.0 * 745.0 / 2.0, monthlySum.values(0));
+  EXPECT_DOUBLE_EQ(8760.0 * 8761.0 / 2.0, sum(monthlySum.values()));
+
+  TimeSeries hourlyMax = timeSeries.aggregate(TimeSeriesBucket::Hourly, TimeSeriesAggregation::Maximum);
+  ASSERT_EQ(8760u, hourlyMax.values().size());
+  for (unsigned i = 0; i < 8760; ++i) {
+    EXPECT_EQ(values[i], hourlyMax.values(i));
+  }
+
+  // sub hourly data
+  TimeSeries quarterHourly(firstReportDateTime - Time(0, 0, 45), Time(0, 0, 15), linspace(1, 8, 8), "kW");
+  TimeSeries hourlyMean = quarterHourly.aggregate(TimeSeriesBucket::Hourly, TimeSeriesAggregation::Mean);
+  ASSERT_EQ(2u, hourlyMean.values().size());
+  EXPECT_DOUBLE_EQ(2.5, hourlyMean.values(0));
+  EXPECT_DOUBLE_EQ(6.5, hourlyMean.values(1));
+
+  // percentiles
+  TimeSeries median = timeSeries.percentile(TimeSeriesBucket::Daily, 50);
+  TimeSeries lowest = timeSeries.percentile(TimeSeriesBucket::Daily, 0);
+  TimeSeries highest = timeSeries.percentile(TimeSeriesBucket::Daily, 100);
+  ASSERT_EQ(365u, median.values().size());
+  EXPECT_DOUBLE_EQ(12.5, median.values(0));
+  EXPECT_DOUBLE_EQ(1, lowest.values(0));
+  EXPECT_DOUBLE_EQ(24, highest.values(0));
+  EXPECT_DOUBLE_EQ(1.0 + 0.9 * 23.0, timeSeries.percentile(TimeSeriesBucket::Daily, 90).values(0));
+  EXPECT_THROW(timeSeries.percentile(TimeSeriesBucket::Daily, 101), std::exception);
+
+  // load duration
+  Vector loadDuration = timeSeries.loadDurationCurve();
+  ASSERT_EQ(8760u, loadDuration.size());
+  EXPECT_EQ(8760, loadDuration[0]);
+  EXPECT_EQ(1, loadDuration[8759]);
+
+  // empty
+  EXPECT_TRUE(TimeSeries().aggregate(TimeSeriesBucket::Monthly, TimeSeriesAggregation::Sum).values().empty());
+}
+
+TEST_F(DataFixture, TimeSeries_CoincidentPeak)
+{
+  DateTime firstReportDateTime(Date(MonthOfYear(MonthOfYear::Jul), 1), Time(0, 1, 0, 0));
+
+  Vector values1(24, 1.0);
+  values1[9] = 10.0;
+  Vector values2(24, 1.0);
+  values2[19] = 8.0;
+  values2[9] = 2.0;
+
+  TimeSeriesVector timeSeriesVector;
+  timeSeriesVector.push_back(TimeSeries(firstReportDateTime, Time(0, 1), values1, "kW"));
+  timeSeriesVector.push_back(TimeSeries(firstReportDateTime, Time(0, 1), values2, "kW"));
+
+  boost::optional<DateTime> peak = coincidentPeakDateTime(timeSeriesVector);
+  ASSERT_TRUE(peak);
+  EXPECT_EQ(firstReportDateTime + Time(0, 9), *peak);
+  EXPECT_DOUBLE_EQ(10, timeSeriesVector[0].value(*peak));
+  EXPECT_DOUBLE_EQ(2, timeSeriesVector[1].value(*peak));
+
+  EXPECT_FALSE(coincidentPeakDateTime(TimeSeriesVector()));
+}
+
+TEST_F(DataFixture, TimeSeries_IntervalMatchesDetailed)
+{
+  DateTime firstReportDateTime(Date(MonthOfYear(MonthOfYear::Jan), 1), Time(0, 0, 15, 0));
+
+  Vector values(96);
+  std::vector<long> secondsFromStart(96);
+  for (unsigned i = 0; i < values.size(); ++i) {
+    values[i] = i % 7;
+    secondsFromStart[i] = (i + 1) * 900;
+  }
+
+  // report times derived from the interval versus stored explicitly
+  TimeSeries interval(firstReportDateTime, Time(0, 0, 15), values, "W");
+  TimeSeries detailed(firstReportDateTime, secondsFromStart, values, "W");
+  ASSERT_TRUE(interval.intervalLength());
+  ASSERT_FALSE(detailed.intervalLength());
+
+  EXPECT_EQ(detailed.secondsFromFirstReport(), interval.secondsFromFirstReport());
+  EXPECT_EQ(detailed.dateTimes(), interval.dateTimes());
+  ASSERT_EQ(detailed.daysFromFirstReport().size(), interval.daysFromFirstReport().size());
+  for (unsigned i = 0; i < values.size(); ++i) {
+    EXPECT_DOUBLE_EQ(detailed.daysFromFirstReport(i), interval.daysFromFirstReport(i));
+    EXPECT_EQ(detailed.secondsFromFirstReport(i), interval.secondsFromFirstReport(i));
+  }
+  EXPECT_EQ(0, interval.secondsFromFirstReport(96));
+
+  for (long seconds = 0; seconds <= 95 * 900; seconds += 450) {
+    EXPECT_DOUBLE_EQ(detailed.value(Time(0, 0, 0, seconds)), interval.value(Time(0, 0, 0, seconds)));
+  }
+  EXPECT_DOUBLE_EQ(0.0, detailed.value(Time(0, 0, 0, 95 * 900 + 1)));
+
+  EXPECT_DOUBLE_EQ(detailed.integrate(), interval.integrate());
+  EXPECT_DOUBLE_EQ(detailed.averageValue(), interval.averageValue());
+
+  TimeSeries difference = interval - detailed;
+  ASSERT_EQ(values.size(), difference.values().size());
+  for (unsigned i = 0; i < values.size(); ++i) {
+    EXPECT_DOUBLE_EQ(0.0, difference.values()[i]);
+  }
+}
+
 TEST_F(DataFixture, TimeSeries_Multiply8760)
 {
   // Test out mulitplication on a detailed series and an iterval series
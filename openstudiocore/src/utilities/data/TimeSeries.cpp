@@ -29,7 +29,10 @@
 #include "TimeSeries.hpp"
 #include "../core/Assert.hpp"
 
+#include <algorithm>
+#include <cmath>
 #include <exception>
+#include <functional>
 #include <set>
 
 using namespace std;
@@ -39,11 +42,11 @@ namespace openstudio{
 
 namespace detail{
 
-TimeSeries_Impl::TimeSeries_Impl() :m_outOfRangeValue(0.0)
+TimeSeries_Impl::TimeSeries_Impl() :m_firstIntervalSeconds(0), m_outOfRangeValue(0.0)
 {}
 
 TimeSeries_Impl::TimeSeries_Impl(const Date& startDate, const Time& intervalLength, const Vector& values, const std::string& units)
-  : m_secondsFromFirstReport(values.size()), m_secondsFromStart(values.size()), m_values(values), m_units(units), m_intervalLength(intervalLength), m_outOfRangeValue(0.0), m_wrapAround(false)
+  : m_firstIntervalSeconds(0), m_values(values), m_units(units), m_intervalLength(intervalLength), m_outOfRangeValue(0.0), m_wrapAround(false)
 {
   if (values.empty()) {
     LOG(Warn, "Creating empty timeseries");
@@ -58,15 +61,11 @@ TimeSeries_Impl::TimeSeries_Impl(const Date& startDate, const Time& intervalLeng
 
   m_startDateTime = DateTime(startDate, Time(0));
 
-  for (unsigned i = 0; i < values.size(); ++i) {
-    m_secondsFromFirstReport[i] = i*secondsPerInterval;
-    m_secondsFromStart[i] = (i + 1)*secondsPerInterval;
-  }
-  m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
-
+  // report times are derived from the interval length rather than stored
   long durationSeconds = 0;
-  if (!m_secondsFromFirstReport.empty()) {
-    durationSeconds = m_secondsFromFirstReport.back();
+  if (!values.empty()) {
+    m_firstIntervalSeconds = secondsPerInterval;
+    durationSeconds = (values.size() - 1)*secondsPerInterval;
   }
 
   // check for wrap around
@@ -81,7 +80,7 @@ TimeSeries_Impl::TimeSeries_Impl(const Date& startDate, const Time& intervalLeng
 }
 
 TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const Time& intervalLength, const Vector& values, const std::string& units)
-  : m_secondsFromFirstReport(values.size()), m_secondsFromStart(values.size()), m_values(values), m_units(units), m_intervalLength(intervalLength), m_outOfRangeValue(0.0), m_wrapAround(false)
+  : m_firstIntervalSeconds(0), m_values(values), m_units(units), m_intervalLength(intervalLength), m_outOfRangeValue(0.0), m_wrapAround(false)
 {
   if (values.empty()) {
     LOG(Warn, "Creating empty timeseries");
@@ -95,15 +94,11 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const Time
 
   m_startDateTime = m_firstReportDateTime - intervalLength;
 
-  for (unsigned i = 0; i < values.size(); ++i) {
-    m_secondsFromFirstReport[i] = i*secondsPerInterval;
-    m_secondsFromStart[i] = (i + 1)*secondsPerInterval;
-  }
-  m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
-
+  // report times are derived from the interval length rather than stored
   long durationSeconds = 0;
-  if (!m_secondsFromFirstReport.empty()) {
-    durationSeconds = m_secondsFromFirstReport.back();
+  if (!values.empty()) {
+    m_firstIntervalSeconds = secondsPerInterval;
+    durationSeconds = (values.size() - 1)*secondsPerInterval;
   }
 
   // check for wrap around
@@ -118,7 +113,7 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const Time
 }
 
 TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const Vector& timeInDays, const Vector& values, const std::string& units)
-  : m_secondsFromFirstReport(values.size()), m_secondsFromStart(values.size()), m_values(values), m_units(units), m_outOfRangeValue(0.0), m_wrapAround(false)
+  : m_secondsFromFirstReport(values.size()), m_firstIntervalSeconds(0), m_values(values), m_units(units), m_outOfRangeValue(0.0), m_wrapAround(false)
 {
   if (timeInDays.size() != values.size()) {
     LOG_AND_THROW("Length of values (" << values.size() << ") must match length of times (" << timeInDays.size() << ")");
@@ -142,10 +137,10 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const Vect
       }
       LOG(Warn, "Assuming time series begins at the start of the day of first report. This behavior is deprecated and will instead be an error in the future.");
       m_startDateTime = DateTime(m_firstReportDateTime.date());
+      m_firstIntervalSeconds = firstIntervalSeconds;
 
       for (unsigned i = 0; i < values.size(); ++i) {
         m_secondsFromFirstReport[i] = Time(timeInDays[i]).totalSeconds();
-        m_secondsFromStart[i] = m_secondsFromFirstReport[i] + firstIntervalSeconds;
         if (i > 0) {
           if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
             LOG_AND_THROW("Days from first report must be monotonically increasing");
@@ -154,9 +149,9 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const Vect
       }
     } else { // This is the new way
       m_startDateTime = m_firstReportDateTime - Time(timeInDays[0]);
+      m_firstIntervalSeconds = Time(timeInDays[0]).totalSeconds();
       for (unsigned i = 0; i < values.size(); ++i) {
-        m_secondsFromStart[i] = Time(timeInDays[i]).totalSeconds();
-        m_secondsFromFirstReport[i] = m_secondsFromStart[i] - m_secondsFromStart[0];
+        m_secondsFromFirstReport[i] = Time(timeInDays[i]).totalSeconds() - m_firstIntervalSeconds;
         if (i > 0) {
           if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
             LOG_AND_THROW("Days from first report must be monotonically increasing");
@@ -165,8 +160,6 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const Vect
       }
     }
 
-    m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
-
     long durationSeconds = 0;
     if (!m_secondsFromFirstReport.empty()) {
       durationSeconds = m_secondsFromFirstReport.back();
@@ -185,7 +178,7 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const Vect
 }
 
 TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const std::vector<double>& timeInDays, const std::vector<double>& values, const std::string& units)
-  : m_secondsFromFirstReport(timeInDays.size()), m_secondsFromStart(values.size()), m_values(values.size()), m_units(units), m_outOfRangeValue(0.0), m_wrapAround(false)
+  : m_secondsFromFirstReport(timeInDays.size()), m_firstIntervalSeconds(0), m_values(values.size()), m_units(units), m_outOfRangeValue(0.0), m_wrapAround(false)
 {
 
   if (timeInDays.size() != values.size()) {
@@ -210,10 +203,10 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const std:
       }
       LOG(Warn, "Assuming time series begins at the start of the day of first report. This behavior is deprecated and will instead be an error in the future.");
       m_startDateTime = DateTime(m_firstReportDateTime.date());
+      m_firstIntervalSeconds = firstIntervalSeconds;
 
       for (unsigned i = 0; i < values.size(); ++i) {
         m_secondsFromFirstReport[i] = Time(timeInDays[i]).totalSeconds();
-        m_secondsFromStart[i] = m_secondsFromFirstReport[i] + firstIntervalSeconds;
         if (i > 0) {
           if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
             LOG_AND_THROW("Days from first report must be monotonically increasing");
@@ -222,9 +215,9 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const std:
       }
     } else { // This is the new way
       m_startDateTime = m_firstReportDateTime - Time(timeInDays[0]);
+      m_firstIntervalSeconds = Time(timeInDays[0]).totalSeconds();
       for (unsigned i = 0; i < values.size(); ++i) {
-        m_secondsFromStart[i] = Time(timeInDays[i]).totalSeconds();
-        m_secondsFromFirstReport[i] = m_secondsFromStart[i] - m_secondsFromStart[0];
+        m_secondsFromFirstReport[i] = Time(timeInDays[i]).totalSeconds() - m_firstIntervalSeconds;
         if (i > 0) {
           if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
             LOG_AND_THROW("Days from first report must be monotonically increasing");
@@ -233,8 +226,6 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const std:
       }
     }
 
-    m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
-
     long durationSeconds = 0;
     if (!m_secondsFromFirstReport.empty()) {
       durationSeconds = m_secondsFromFirstReport.back();
@@ -253,7 +244,7 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const std:
 }
 
 TimeSeries_Impl::TimeSeries_Impl(const DateTimeVector& inDateTimes, const Vector& values, const std::string& units)
-  : m_secondsFromFirstReport(values.size()), m_secondsFromStart(values.size()), m_values(values), m_units(units), m_outOfRangeValue(0.0), m_wrapAround(false)
+  : m_secondsFromFirstReport(values.size()), m_firstIntervalSeconds(0), m_values(values), m_units(units), m_outOfRangeValue(0.0), m_wrapAround(false)
 {
   // DLM: this seems to be a pretty fragile constructor with a lot going on
 
@@ -292,7 +283,6 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTimeVector& inDateTimes, const Vector
     // Compute the seconds from first report
     if (m_wrapAround) {
       m_secondsFromFirstReport[0] = 0;
-      m_secondsFromStart[0] = 0;
       int delta = 0;
       DateTime firstReportDateTimeWithYear = DateTime(Date(m_firstReportDateTime.date().monthOfYear(),
         m_firstReportDateTime.date().dayOfMonth(), m_firstReportDateTime.date().year()), m_firstReportDateTime.time());
@@ -305,19 +295,16 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTimeVector& inDateTimes, const Vector
             m_firstReportDateTime.date().year() + delta), dateTimes[i].time());
         }
         m_secondsFromFirstReport[i] = (wrappedDateTime - firstReportDateTimeWithYear).totalSeconds();
-        m_secondsFromStart[i] = (wrappedDateTime - firstReportDateTimeWithYear).totalSeconds();
       }
     } else {
       m_secondsFromFirstReport[0] = 0;
-      m_secondsFromStart[0] = 0;
       for (unsigned i = 1; i < dateTimes.size(); i++) {
         m_secondsFromFirstReport[i] = (dateTimes[i] - m_firstReportDateTime).totalSeconds();
-        m_secondsFromStart[i] = (dateTimes[i] - m_firstReportDateTime).totalSeconds();
       }
     }
 
     for (unsigned i = 1; i < dateTimes.size(); i++) {
-      if (m_secondsFromStart[i] < m_secondsFromStart[i - 1]) {
+      if (m_secondsFromFirstReport[i] < m_secondsFromFirstReport[i - 1]) {
         LOG_AND_THROW("Dates from first report must be monotonically increasing");
       }
     }
@@ -326,12 +313,12 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTimeVector& inDateTimes, const Vector
     if (!extraTime) {
       int delta;
       bool foundInterval = false;
-      if (m_secondsFromStart.size() > 1) {
+      if (m_secondsFromFirstReport.size() > 1) {
         // check if all data is reported at a constant interval
-        delta = m_secondsFromStart[1] - m_secondsFromStart[0];
+        delta = m_secondsFromFirstReport[1] - m_secondsFromFirstReport[0];
         foundInterval = true;
-        for (unsigned i = 2; i < m_secondsFromStart.size(); i++) {
-          if (delta != m_secondsFromStart[i] - m_secondsFromStart[i - 1])
+        for (unsigned i = 2; i < m_secondsFromFirstReport.size(); i++) {
+          if (delta != m_secondsFromFirstReport[i] - m_secondsFromFirstReport[i - 1])
             foundInterval = false;
           break;
         }
@@ -350,20 +337,12 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTimeVector& inDateTimes, const Vector
       }
     }
 
-    int firstIntervalSeconds = (m_firstReportDateTime - m_startDateTime).totalSeconds();
-
-    // Compute the seconds from start
-    m_secondsFromStart[0] = firstIntervalSeconds;
-    for (unsigned i = 1; i < dateTimes.size(); i++) {
-      m_secondsFromStart[i] = m_secondsFromStart[i] + firstIntervalSeconds;
-    }
-
-    m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
+    m_firstIntervalSeconds = (m_firstReportDateTime - m_startDateTime).totalSeconds();
   }
 }
 
 TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const std::vector<long>& timeInSeconds, const Vector& values, const std::string& units)
-  : m_secondsFromFirstReport(values.size()), m_secondsFromStart(values.size()), m_values(values), m_units(units), m_outOfRangeValue(0.0), m_wrapAround(false)
+  : m_secondsFromFirstReport(values.size()), m_firstIntervalSeconds(0), m_values(values), m_units(units), m_outOfRangeValue(0.0), m_wrapAround(false)
 {
   if (timeInSeconds.size() != values.size()) {
     LOG_AND_THROW("Length of values (" << values.size() << ") must match length of times (" << timeInSeconds.size() << ")");
@@ -387,19 +366,14 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const std:
       LOG(Warn, "Assuming time series begins at the start of the day of first report. This behavior is deprecated and will instead be an error in the future.");
       m_startDateTime = DateTime(firstReportDateTime.date());
       m_firstReportDateTime = firstReportDateTime;
-      int firstIntervalSeconds = m_firstReportDateTime.time().totalSeconds();
-      m_secondsFromStart = timeInSeconds;
-      for (unsigned i = 0; i < m_secondsFromStart.size(); i++) {
-        m_secondsFromStart[i] += firstIntervalSeconds;
-      }
+      m_firstIntervalSeconds = m_firstReportDateTime.time().totalSeconds();
       m_secondsFromFirstReport = timeInSeconds;
 
     } else { // This is the new behavior
       m_startDateTime = firstReportDateTime - Time(0, 0, 0, timeInSeconds[0]);
       m_firstReportDateTime = firstReportDateTime;
-      m_secondsFromStart = timeInSeconds;
+      m_firstIntervalSeconds = timeInSeconds[0];
 
-      // Get rid of this later
       m_secondsFromFirstReport[0] = 0;
       for (unsigned i = 1; i < values.size(); ++i) {
         m_secondsFromFirstReport[i] = timeInSeconds[i] - timeInSeconds[0];
@@ -407,8 +381,6 @@ TimeSeries_Impl::TimeSeries_Impl(const DateTime& firstReportDateTime, const std:
     }
   }
 
-  m_secondsFromFirstReportAsVector = createVector(m_secondsFromFirstReport);
-
   long durationSeconds = 0;
   if (!m_secondsFromFirstReport.empty()) {
     durationSeconds = m_secondsFromFirstReport.back();
@@ -431,11 +403,19 @@ OptionalTime TimeSeries_Impl::intervalLength() const
   return m_intervalLength;
 }
 
+long TimeSeries_Impl::reportSeconds(unsigned i) const
+{
+  if (m_intervalLength) {
+    return i*static_cast<long>(m_intervalLength->totalSeconds());
+  }
+  return m_secondsFromFirstReport[i];
+}
+
 DateTimeVector TimeSeries_Impl::dateTimes() const
 {
-  DateTimeVector dateTimeObjs(m_secondsFromFirstReport.size());
-  for (unsigned i = 0; i < m_secondsFromFirstReport.size(); i++) {
-    dateTimeObjs[i] = m_firstReportDateTime + openstudio::Time(0, 0, 0, m_secondsFromFirstReport[i]);
+  DateTimeVector dateTimeObjs(m_values.size());
+  for (unsigned i = 0; i < m_values.size(); i++) {
+    dateTimeObjs[i] = m_firstReportDateTime + openstudio::Time(0, 0, 0, reportSeconds(i));
   }
   return dateTimeObjs;
 }
@@ -443,9 +423,9 @@ DateTimeVector TimeSeries_Impl::dateTimes() const
 /// time in days from end of the first reporting interval
 Vector TimeSeries_Impl::daysFromFirstReport() const
 {
-  Vector daysFromFirstReport(m_secondsFromFirstReport.size());
-  for (unsigned i = 0; i < m_secondsFromFirstReport.size(); i++) {
-    daysFromFirstReport[i] = Time(0, 0, 0, m_secondsFromFirstReport[i]).totalDays();
+  Vector daysFromFirstReport(m_values.size());
+  for (unsigned i = 0; i < m_values.size(); i++) {
+    daysFromFirstReport[i] = Time(0, 0, 0, reportSeconds(i)).totalDays();
   }
   return daysFromFirstReport;
 }
@@ -454,8 +434,8 @@ Vector TimeSeries_Impl::daysFromFirstReport() const
 double TimeSeries_Impl::daysFromFirstReport(const unsigned& i) const
 {
   double value = m_outOfRangeValue;
-  if (i < m_secondsFromFirstReport.size()) {
-    value = Time(0, 0, 0, m_secondsFromFirstReport[i]).totalDays();
+  if (i < m_values.size()) {
+    value = Time(0, 0, 0, reportSeconds(i)).totalDays();
   }
   return value;
 }
@@ -463,6 +443,13 @@ double TimeSeries_Impl::daysFromFirstReport(const unsigned& i) const
 /// time in seconds from end of the first reporting interval
 std::vector<long> TimeSeries_Impl::secondsFromFirstReport() const
 {
+  if (m_intervalLength) {
+    std::vector<long> result(m_values.size());
+    for (unsigned i = 0; i < m_values.size(); i++) {
+      result[i] = reportSeconds(i);
+    }
+    return result;
+  }
   return m_secondsFromFirstReport;
 }
 
@@ -471,8 +458,8 @@ long TimeSeries_Impl::secondsFromFirstReport(const unsigned& i) const
 {
   //double value = m_outOfRangeValue; // JWD: Shouldn't the out of range value be for values only?
   long value = 0;
-  if (i < m_secondsFromFirstReport.size()) {
-    value = m_secondsFromFirstReport[i];
+  if (i < m_values.size()) {
+    value = reportSeconds(i);
   }
   return value;
 }
@@ -510,12 +497,12 @@ double TimeSeries_Impl::valueAtSecondsFromFirstReport(long secondsFromFirstRepor
 {
   double result = m_outOfRangeValue;
 
-  if (m_secondsFromFirstReport.empty()) {
+  if (m_values.empty()) {
     LOG(Debug, "Cannot compute value because timeseries is empty");
     return result;
   }
 
-  long duration = m_secondsFromFirstReport.back();
+  long duration = reportSeconds(m_values.size() - 1);
 
   if (m_intervalLength) {
 
@@ -557,8 +544,13 @@ double TimeSeries_Impl::valueAtSecondsFromFirstReport(long secondsFromFirstRepor
       // after end of time series
       LOG(Debug, "Cannot compute value " << secondsFromFirstReport << " seconds after first reporting time when duration is " << duration << " seconds");
     } else {
-      // normal interpolation
-      result = interp(m_secondsFromFirstReportAsVector, m_values, secondsFromFirstReport, HoldNextInterp, NoneExtrap);
+      // hold the next reported value, first report at or after the requested time
+      unsigned index = m_values.size() - 1;
+      if (secondsFromFirstReport < duration) {
+        auto it = std::lower_bound(m_secondsFromFirstReport.begin(), m_secondsFromFirstReport.end(), secondsFromFirstReport);
+        index = it - m_secondsFromFirstReport.begin();
+      }
+      result = m_values(index);
     }
   }
 
@@ -653,13 +645,14 @@ Vector TimeSeries_Impl::values(const DateTime& startDateTime, const DateTime& en
   double endSecondsFromFirstReport = (endDateTimeWithYear - firstReportDateTimeWithYear).totalSeconds();
 
   unsigned numValues = m_values.size();
-  OS_ASSERT(numValues == m_secondsFromFirstReport.size());
+  OS_ASSERT(m_intervalLength || (numValues == m_secondsFromFirstReport.size()));
 
   Vector result(numValues);
   unsigned resultSize = 0;
   for (unsigned i = 0; i < numValues; ++i) {
-    if ((m_secondsFromFirstReport[i] >= startSecondsFromFirstReport) &&
-      (m_secondsFromFirstReport[i] <= endSecondsFromFirstReport)) {
+    long seconds = reportSeconds(i);
+    if ((seconds >= startSecondsFromFirstReport) &&
+      (seconds <= endSecondsFromFirstReport)) {
       result[resultSize] = m_values[i];
       ++resultSize;
     }
@@ -690,6 +683,11 @@ std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator+(const TimeSeries_Imp
   // if same units
   if (m_units == other.units()) {
 
+    // same report times, no need to look up values by date time
+    if (isAlignedWith(other)) {
+      return withValues(m_values + other.m_values);
+    }
+
     // make unique, ordered set of all date times
     std::set<DateTime> dateTimesSet;
     DateTimeVector dateTimes1 = dateTimes();
@@ -704,9 +702,11 @@ std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator+(const TimeSeries_Imp
     Vector values(dateTimesSet.size());
     unsigned valueIndex = 0;
     for (const DateTime& dt : dateTimes) {
-      values[valueIndex] = value(dt) + other.value(dt);
+      double value1 = value(dt);
+      double value2 = other.value(dt);
+      values[valueIndex] = value1 + value2;
 
-      LOG(Debug, "At '" << dt << "' " << value(dt) << " + " << other.value(dt) << " = " << values[valueIndex]);
+      LOG(Debug, "At '" << dt << "' " << value1 << " + " << value2 << " = " << values[valueIndex]);
 
       ++valueIndex;
     }
@@ -729,6 +729,11 @@ std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator-(const TimeSeries_Imp
   // if same units
   if (m_units == other.units()) {
 
+    // same report times, no need to look up values by date time
+    if (isAlignedWith(other)) {
+      return withValues(m_values - other.m_values);
+    }
+
     // make unique, ordered set of all date times
     std::set<DateTime> dateTimesSet;
     DateTimeVector dateTimes1 = dateTimes();
@@ -743,9 +748,11 @@ std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator-(const TimeSeries_Imp
     Vector values(dateTimesSet.size());
     unsigned valueIndex = 0;
     for (const DateTime& dt : dateTimes) {
-      values[valueIndex] = value(dt) - other.value(dt);
+      double value1 = value(dt);
+      double value2 = other.value(dt);
+      values[valueIndex] = value1 - value2;
 
-      LOG(Debug, "At '" << dt << "' " << value(dt) << " - " << other.value(dt) << " = " << values[valueIndex]);
+      LOG(Debug, "At '" << dt << "' " << value1 << " - " << value2 << " = " << values[valueIndex]);
 
       ++valueIndex;
     }
@@ -760,6 +767,98 @@ std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator-(const TimeSeries_Imp
   return result;
 }
 
+bool TimeSeries_Impl::isAlignedWith(const TimeSeries_Impl& other) const
+{
+  if (m_values.empty() || (m_values.size() != other.m_values.size())) {
+    return false;
+  }
+
+  if ((m_wrapAround != other.m_wrapAround) || !(m_firstReportDateTime == other.m_firstReportDateTime)) {
+    return false;
+  }
+
+  // fixed interval series only need to agree on the interval
+  if (m_intervalLength && other.m_intervalLength) {
+    return (m_intervalLength->totalSeconds() > 0) && (m_intervalLength->totalSeconds() == other.m_intervalLength->totalSeconds());
+  }
+
+  for (unsigned i = 0; i < m_values.size(); ++i) {
+    if (reportSeconds(i) != other.reportSeconds(i)) {
+      return false;
+    }
+
+    // repeated report times are merged when combining by date time
+    if ((i > 0) && (reportSeconds(i) <= reportSeconds(i - 1))) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::withValues(const Vector& values) const
+{
+  OS_ASSERT(values.size() == m_values.size());
+
+  std::shared_ptr<TimeSeries_Impl> result(new TimeSeries_Impl(*this));
+  result->m_values = values;
+  result->m_outOfRangeValue = 0.0;
+  return result;
+}
+
+std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::withValues(const Vector& values, const std::string& units) const
+{
+  std::shared_ptr<TimeSeries_Impl> result = withValues(values);
+  result->m_units = units;
+  return result;
+}
+
+std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::sum(const std::vector<std::shared_ptr<TimeSeries_Impl> >& timeSeries)
+{
+  OS_ASSERT(!timeSeries.empty());
+
+  const TimeSeries_Impl& first = *timeSeries.front();
+
+  bool aligned = true;
+  for (const auto& ts : timeSeries) {
+    if (ts->units() != first.units()) {
+      LOG(Warn, "Adding timeseries with different units returns an empty timeseries");
+      return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl());
+    }
+    aligned = aligned && first.isAlignedWith(*ts);
+  }
+
+  // all report at the same times, add the values elementwise
+  if (aligned) {
+    Vector values = first.m_values;
+    for (unsigned i = 1; i < timeSeries.size(); ++i) {
+      values += timeSeries[i]->m_values;
+    }
+    return first.withValues(values);
+  }
+
+  // make unique, ordered set of all date times once rather than for each pair
+  std::set<DateTime> dateTimesSet;
+  for (const auto& ts : timeSeries) {
+    DateTimeVector tsDateTimes = ts->dateTimes();
+    dateTimesSet.insert(tsDateTimes.begin(), tsDateTimes.end());
+  }
+  DateTimeVector dateTimes(dateTimesSet.begin(), dateTimesSet.end());
+
+  Vector values(dateTimes.size());
+  unsigned valueIndex = 0;
+  for (const DateTime& dt : dateTimes) {
+    double value = 0.0;
+    for (const auto& ts : timeSeries) {
+      value += ts->value(dt);
+    }
+    values[valueIndex] = value;
+    ++valueIndex;
+  }
+
+  return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(dateTimes, values, first.units()));
+}
+
 std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::operator*(double d) const {
   if (m_intervalLength) {
     return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(m_firstReportDateTime,
@@ -786,8 +885,9 @@ double TimeSeries_Impl::integrate() const
     double lastTime = 0;
     // Use a Riemann sum to integrate under the curve
     for (unsigned i = 0; i < m_values.size(); i++) {
-      result += (m_secondsFromStart[i] - lastTime) * m_values[i];
-      lastTime = m_secondsFromStart[i];
+      double time = m_secondsFromFirstReport[i] + m_firstIntervalSeconds;
+      result += (time - lastTime) * m_values[i];
+      lastTime = time;
     }
   }
   return result;
@@ -795,12 +895,166 @@ double TimeSeries_Impl::integrate() const
 
 double TimeSeries_Impl::averageValue() const
 {
-  if (m_secondsFromStart.size() > 0) {
-    return integrate() / m_secondsFromStart.back();
+  if (!m_values.empty()) {
+    return integrate() / (reportSeconds(m_values.size() - 1) + m_firstIntervalSeconds);
   }
   return 0;
 }
 
+void TimeSeries_Impl::calendarBuckets(const TimeSeriesBucket& bucket, DateTimeVector& dateTimes, std::vector<unsigned>& ends) const
+{
+  dateTimes.clear();
+  ends.clear();
+
+  unsigned n = m_values.size();
+  if (n == 0) {
+    return;
+  }
+
+  // work with a calendar year so that buckets can cross the end of the year
+  boost::optional<int> calendarYear = m_firstReportDateTime.date().baseYear();
+  DateTime firstReportDateTimeWithYear = m_firstReportDateTime;
+  if (!calendarYear) {
+    firstReportDateTimeWithYear = DateTime(Date(m_firstReportDateTime.date().monthOfYear(), m_firstReportDateTime.date().dayOfMonth(), m_firstReportDateTime.date().year()), m_firstReportDateTime.time());
+  }
+
+  // start of the bucket containing the end of the reporting interval at dateTime
+  auto bucketStart = [&bucket](const DateTime& dateTime) {
+    DateTime t = dateTime - Time(0, 0, 0, 1);
+    if (bucket == TimeSeriesBucket::Hourly) {
+      return DateTime(t.date(), Time(0, t.time().hours()));
+    } else if (bucket == TimeSeriesBucket::Daily) {
+      return DateTime(t.date(), Time(0));
+    }
+    return DateTime(Date(t.date().monthOfYear(), 1, t.date().year()), Time(0));
+  };
+
+  auto bucketEnd = [&bucket](const DateTime& start) {
+    if (bucket == TimeSeriesBucket::Hourly) {
+      return start + Time(0, 1);
+    } else if (bucket == TimeSeriesBucket::Daily) {
+      return start + Time(1);
+    }
+    unsigned m = month(start.date().monthOfYear());
+    if (m == 12) {
+      return DateTime(Date(MonthOfYear::Jan, 1, start.date().year() + 1), Time(0));
+    }
+    return DateTime(Date(monthOfYear(m + 1), 1, start.date().year()), Time(0));
+  };
+
+  // report times are sorted, so each bucket is a contiguous range of values
+  DateTime start = bucketStart(firstReportDateTimeWithYear + Time(0, 0, 0, reportSeconds(0)));
+  DateTime end = bucketEnd(start);
+  long endSeconds = (end - firstReportDateTimeWithYear).totalSeconds();
+  dateTimes.push_back(start);
+  for (unsigned i = 0; i < n; ++i) {
+    long seconds = reportSeconds(i);
+    if (seconds > endSeconds) {
+      ends.push_back(i);
+      dateTimes.push_back(end);
+
+      // skip over any buckets without data
+      start = bucketStart(firstReportDateTimeWithYear + Time(0, 0, 0, seconds));
+      end = bucketEnd(start);
+      endSeconds = (end - firstReportDateTimeWithYear).totalSeconds();
+    }
+  }
+  ends.push_back(n);
+  dateTimes.push_back(end);
+
+  if (!calendarYear) {
+    for (DateTime& dateTime : dateTimes) {
+      dateTime = DateTime(Date(dateTime.date().monthOfYear(), dateTime.date().dayOfMonth()), dateTime.time());
+    }
+  }
+}
+
+std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::aggregate(const TimeSeriesBucket& bucket, const TimeSeriesAggregation& aggregation) const
+{
+  DateTimeVector dateTimes;
+  std::vector<unsigned> ends;
+  calendarBuckets(bucket, dateTimes, ends);
+  if (ends.empty()) {
+    return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl());
+  }
+
+  Vector values(ends.size());
+  unsigned begin = 0;
+  for (unsigned i = 0; i < ends.size(); ++i) {
+    unsigned end = ends[i];
+    OS_ASSERT(end > begin);
+
+    double result = m_values[begin];
+    if (aggregation == TimeSeriesAggregation::Minimum) {
+      for (unsigned j = begin + 1; j < end; ++j) {
+        result = std::min(result, m_values[j]);
+      }
+    } else if (aggregation == TimeSeriesAggregation::Maximum) {
+      for (unsigned j = begin + 1; j < end; ++j) {
+        result = std::max(result, m_values[j]);
+      }
+    } else {
+      for (unsigned j = begin + 1; j < end; ++j) {
+        result += m_values[j];
+      }
+      if (aggregation == TimeSeriesAggregation::Mean) {
+        result /= (end - begin);
+      }
+    }
+
+    values[i] = result;
+    begin = end;
+  }
+
+  return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(dateTimes, values, m_units));
+}
+
+std::shared_ptr<TimeSeries_Impl> TimeSeries_Impl::percentile(const TimeSeriesBucket& bucket, double percent) const
+{
+  if ((percent < 0.0) || (percent > 100.0)) {
+    LOG_AND_THROW("Percentile " << percent << " must be between 0 and 100");
+  }
+
+  DateTimeVector dateTimes;
+  std::vector<unsigned> ends;
+  calendarBuckets(bucket, dateTimes, ends);
+  if (ends.empty()) {
+    return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl());
+  }
+
+  Vector values(ends.size());
+  std::vector<double> bucketValues;
+  unsigned begin = 0;
+  for (unsigned i = 0; i < ends.size(); ++i) {
+    unsigned end = ends[i];
+    OS_ASSERT(end > begin);
+
+    bucketValues.assign(m_values.begin() + begin, m_values.begin() + end);
+
+    // linear interpolation between closest ranks
+    double rank = percent / 100.0 * (bucketValues.size() - 1);
+    unsigned lower = static_cast<unsigned>(std::floor(rank));
+    std::nth_element(bucketValues.begin(), bucketValues.begin() + lower, bucketValues.end());
+    double result = bucketValues[lower];
+    if (lower + 1 < bucketValues.size()) {
+      double upper = *std::min_element(bucketValues.begin() + lower + 1, bucketValues.end());
+      result += (rank - lower) * (upper - result);
+    }
+
+    values[i] = result;
+    begin = end;
+  }
+
+  return std::shared_ptr<TimeSeries_Impl>(new TimeSeries_Impl(dateTimes, values, m_units));
+}
+
+Vector TimeSeries_Impl::loadDurationCurve() const
+{
+  Vector result = m_values;
+  std::sort(result.begin(), result.end(), std::greater<double>());
+  return result;
+}
+
 } // detail
 
 TimeSeries::TimeSeries() :
@@ -945,6 +1199,21 @@ double TimeSeries::averageValue() const
   return m_impl->averageValue();
 }
 
+TimeSeries TimeSeries::aggregate(const TimeSeriesBucket& bucket, const TimeSeriesAggregation& aggregation) const
+{
+  return TimeSeries(m_impl->aggregate(bucket, aggregation));
+}
+
+TimeSeries TimeSeries::percentile(const TimeSeriesBucket& bucket, double percent) const
+{
+  return TimeSeries(m_impl->percentile(bucket, percent));
+}
+
+Vector TimeSeries::loadDurationCurve() const
+{
+  return m_impl->loadDurationCurve();
+}
+
 TimeSeries::TimeSeries(std::shared_ptr<detail::TimeSeries_Impl> impl)
   : m_impl(impl)
 {}
@@ -956,20 +1225,47 @@ TimeSeries operator*(double d, const TimeSeries& series)
 
 TimeSeries sum(const std::vector<TimeSeries>& timeSeriesVector)
 {
-  TimeSeries result;
-  bool first = true;
+  if (timeSeriesVector.empty()) {
+    return TimeSeries();
+  }
+
+  if (timeSeriesVector.size() == 1u) {
+    return timeSeriesVector.front();
+  }
+
+  if (timeSeriesVector.front().values().empty()) {
+    LOG_FREE(Info, "zero.sum", "Could not sum the timeSeriesVector. Either the first series is empty, or the "
+      << "units are incompatible.");
+    return timeSeriesVector.front();
+  }
+
+  std::vector<std::shared_ptr<detail::TimeSeries_Impl> > impls;
+  impls.reserve(timeSeriesVector.size());
   for (const TimeSeries& ts : timeSeriesVector) {
-    if (first) { result = ts; } else { result = result + ts; }
-    if (result.values().empty()) {
-      LOG_FREE(Info, "zero.sum", "Could not sum the timeSeriesVector. Either the first series is empty, or the "
-        << "units are incompatible.");
-      break;
-    }
-    first = false;
+    impls.push_back(ts.m_impl);
+  }
+
+  TimeSeries result(detail::TimeSeries_Impl::sum(impls));
+  if (result.values().empty()) {
+    LOG_FREE(Info, "zero.sum", "Could not sum the timeSeriesVector. Either the first series is empty, or the "
+      << "units are incompatible.");
   }
   return result;
 }
 
+boost::optional<DateTime> coincidentPeakDateTime(const std::vector<TimeSeries>& timeSeriesVector)
+{
+  TimeSeries total = sum(timeSeriesVector);
+
+  Vector values = total.values();
+  if (values.empty()) {
+    return boost::none;
+  }
+
+  unsigned peakIndex = std::max_element(values.begin(), values.end()) - values.begin();
+  return total.firstReportDateTime() + Time(0, 0, 0, total.secondsFromFirstReport(peakIndex));
+}
+
 boost::function1<TimeSeries, const std::vector<TimeSeries>&> sumTimeSeriesFunctor()
 {
   typedef TimeSeries(*functype)(const std::vector<TimeSeries>&);
@@ -31,6 +31,7 @@
 
 #include "../UtilitiesAPI.hpp"
 
+#include "DataEnums.hpp"
 #include "Vector.hpp"
 #include "../time/Date.hpp"
 #include "../time/Time.hpp"
@@ -105,12 +106,36 @@ public:
 
   std::shared_ptr<TimeSeries_Impl> operator*(double d) const;
 
+  /// true if other reports at exactly the same times, values can then be combined elementwise
+  bool isAlignedWith(const TimeSeries_Impl& other) const;
+
+  /// new time series reporting values at the same times as this one
+  std::shared_ptr<TimeSeries_Impl> withValues(const Vector& values) const;
+
+  /// new time series reporting values in units at the same times as this one
+  std::shared_ptr<TimeSeries_Impl> withValues(const Vector& values, const std::string& units) const;
+
+  /// sum all time series, evaluating each once at the union of their report times
+  static std::shared_ptr<TimeSeries_Impl> sum(const std::vector<std::shared_ptr<TimeSeries_Impl> >& timeSeries);
+
   double integrate() const;
 
   double averageValue() const;
 
+  std::shared_ptr<TimeSeries_Impl> aggregate(const TimeSeriesBucket& bucket, const TimeSeriesAggregation& aggregation) const;
+
+  std::shared_ptr<TimeSeries_Impl> percentile(const TimeSeriesBucket& bucket, double percent) const;
+
+  Vector loadDurationCurve() const;
+
 private:
 
+  // split values into calendar buckets, bucket i holds values [ends[i-1], ends[i]) and is reported at dateTimes[i+1], dateTimes[0] is the start of the first bucket
+  void calendarBuckets(const TimeSeriesBucket& bucket, DateTimeVector& dateTimes, std::vector<unsigned>& ends) const;
+
+  // seconds from first report of value i, no bounds checking
+  long reportSeconds(unsigned i) const;
+
   REGISTER_LOGGER("utilities.TimeSeries_Impl");
   // fully qualified first report date
   DateTime m_firstReportDateTime;
@@ -119,9 +144,11 @@ private:
   DateTime m_startDateTime;
 
   // integer seconds from first report date time, used for quick interpolation
+  // empty for fixed interval series, report i is then at i times the interval length
   std::vector<long> m_secondsFromFirstReport;
-  Vector m_secondsFromFirstReportAsVector; // same as m_secondsFromFirstReport but stored as Vector
-  std::vector<long> m_secondsFromStart;
+
+  // seconds from start of the series to the first report, seconds from start are derived by adding this to seconds from first report
+  long m_firstIntervalSeconds;
 
   // values reported at m_dateTimes
   Vector m_values;
@@ -298,10 +325,25 @@ public:
   /** Compute the time series average value */
   double averageValue() const;
 
+  /** Aggregate values over each calendar bucket, e.g. monthly totals or daily peaks.  The result
+   *  reports one value at the end of each bucket containing data. */
+  TimeSeries aggregate(const TimeSeriesBucket& bucket, const TimeSeriesAggregation& aggregation) const;
+
+  /** Percentile, between 0 and 100, of the values in each calendar bucket.  Interpolates linearly 
+   *  between the closest ranks. */
+  TimeSeries percentile(const TimeSeriesBucket& bucket, double percent) const;
+
+  /** Values sorted from largest to smallest. */
+  Vector loadDurationCurve() const;
+
   //@}
 private:
 
   REGISTER_LOGGER("utilities.TimeSeries");
+
+  friend UTILITIES_API TimeSeries sum(const std::vector<TimeSeries>& timeSeriesVector);
+  friend UTILITIES_API boost::optional<TimeSeries> convert(const TimeSeries& timeSeries, const std::string& finalUnits);
+
   // constructor from impl
   TimeSeries(std::shared_ptr<detail::TimeSeries_Impl> impl);
 
@@ -325,6 +367,9 @@ UTILITIES_API TimeSeries operator*(double d, const TimeSeries& series);
 // Helper function to add up all the TimeSeries in timeSeriesVector.
 UTILITIES_API TimeSeries sum(const std::vector<TimeSeries>& timeSeriesVector);
 
+/** Date and time at which the sum of all the TimeSeries in timeSeriesVector peaks. */
+UTILITIES_API boost::optional<DateTime> coincidentPeakDateTime(const std::vector<TimeSeries>& timeSeriesVector);
+
 /** Returns std::function pointer to sum(const std::vector<TimeSeries>&). */
 UTILITIES_API boost::function1<TimeSeries, const std::vector<TimeSeries>&> sumTimeSeriesFunctor();
 
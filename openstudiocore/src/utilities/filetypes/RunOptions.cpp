@@ -49,6 +49,12 @@ namespace detail{
   }
 
   std::string RunOptions_Impl::string() const 
+  {
+    Json::StyledWriter writer;
+    return writer.write(toJSON());
+  }
+
+  Json::Value RunOptions_Impl::toJSON() const
   {
     Json::Value result;
 
@@ -73,8 +79,7 @@ namespace detail{
       result["output_adapter"] = outputAdapter;
     }
 
-    Json::StyledWriter writer;
-    return writer.write(result);
+    return result;
   }
 
   bool RunOptions_Impl::debug() const
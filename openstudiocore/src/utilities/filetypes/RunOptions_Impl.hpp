@@ -52,6 +52,8 @@ namespace detail {
 
     std::string string() const;
 
+    Json::Value toJSON() const;
+
     bool debug() const;
     bool setDebug(bool debug);
     void resetDebug();
@@ -135,6 +135,14 @@ namespace detail{
   }
 
   std::string WorkflowJSON_Impl::string(bool includeHash) const
+  {
+    Json::StyledWriter writer;
+    std::string result = writer.write(toJSON(includeHash));
+
+    return result;
+  }
+
+  Json::Value WorkflowJSON_Impl::toJSON(bool includeHash) const
   {
     Json::Value clone(m_value);
     if (!includeHash){
@@ -143,27 +151,15 @@ namespace detail{
 
     Json::Value steps(Json::arrayValue);
     for (const auto& step : m_steps){
-
-      Json::Reader reader;
-      Json::Value stepValue;
-      bool parsingSuccessful = reader.parse(step.string(), stepValue);
-      if (parsingSuccessful){
-        steps.append(stepValue);
-      }
+      steps.append(step.getImpl<detail::WorkflowStep_Impl>()->toJSON());
     }
     clone["steps"] = steps;
 
     if (m_runOptions){
-      Json::Reader reader;
-      Json::Value options;
-      bool parsingSuccessful = reader.parse(m_runOptions->string(), options);
-      clone["run_options"] = options;
+      clone["run_options"] = m_runOptions->getImpl<detail::RunOptions_Impl>()->toJSON();
     }
 
-    Json::StyledWriter writer;
-    std::string result = writer.write(clone);
-
-    return result;
+    return clone;
   }
 
   std::string WorkflowJSON_Impl::hash() const
@@ -176,7 +172,24 @@ namespace detail{
 
   std::string WorkflowJSON_Impl::computeHash() const
   {
-    return checksum(string(false));
+    // hash the compact top level values followed by each step's cached digest,
+    // so only steps changed since the last hash are serialized again
+    Json::Value clone(m_value);
+    clone.removeMember("hash");
+    clone.removeMember("steps");
+
+    Json::FastWriter writer;
+    std::string s = writer.write(clone);
+
+    for (const auto& step : m_steps){
+      s += step.getImpl<detail::WorkflowStep_Impl>()->digest();
+    }
+
+    if (m_runOptions){
+      s += writer.write(m_runOptions->getImpl<detail::RunOptions_Impl>()->toJSON());
+    }
+
+    return checksum(s);
   }
 
   bool WorkflowJSON_Impl::checkForUpdates()
@@ -63,6 +63,8 @@ namespace detail {
 
       std::string string(bool includeHash = true) const;
 
+      Json::Value toJSON(bool includeHash = true) const;
+
       std::string hash() const;
 
       std::string computeHash() const;
@@ -28,8 +28,10 @@
 
 #include "WorkflowStep.hpp"
 #include "WorkflowStep_Impl.hpp"
+#include "WorkflowStepResult_Impl.hpp"
 
 #include "../core/Assert.hpp"
+#include "../core/Checksum.hpp"
 
 #include <jsoncpp/json.h>
 
@@ -37,11 +39,35 @@ namespace openstudio{
 namespace detail{
 
   WorkflowStep_Impl::WorkflowStep_Impl()
+    : m_digestResultRevision(0)
   {}
 
   WorkflowStep_Impl::~WorkflowStep_Impl()
   {}
 
+  std::string WorkflowStep_Impl::string() const
+  {
+    Json::StyledWriter writer;
+    return writer.write(toJSON());
+  }
+
+  std::string WorkflowStep_Impl::digest() const
+  {
+    // the result is shared and has no change signal, compare its revision to catch in place edits
+    unsigned long long resultRevision = 0;
+    if (m_result){
+      resultRevision = m_result->getImpl<WorkflowStepResult_Impl>()->revision();
+    }
+
+    if (!m_digest || (m_digestResultRevision != resultRevision)){
+      Json::FastWriter writer;
+      m_digest = checksum(writer.write(toJSON()));
+      m_digestResultRevision = resultRevision;
+    }
+
+    return m_digest.get();
+  }
+
   boost::optional<WorkflowStepResult> WorkflowStep_Impl::result() const
   {
     return m_result;
@@ -61,9 +87,17 @@ namespace detail{
 
   void WorkflowStep_Impl::onUpdate()
   {
+    m_digest.reset();
     this->onChange.nano_emit();
   }
 
+  void WorkflowStep_Impl::addResultJSON(Json::Value& value) const
+  {
+    if (m_result){
+      value["result"] = m_result->getImpl<WorkflowStepResult_Impl>()->toJSON();
+    }
+  }
+
   MeasureStep_Impl::MeasureStep_Impl(const std::string& measureDirName)
     : m_measureDirName(measureDirName)
   {}
@@ -116,7 +150,7 @@ namespace detail{
   }
   */
 
-  std::string MeasureStep_Impl::string() const 
+  Json::Value MeasureStep_Impl::toJSON() const
   {
     Json::Value result;
     result["measure_dir_name"] = m_measureDirName;
@@ -151,18 +185,9 @@ namespace detail{
     }
     result["arguments"] = arguments;
 
-    boost::optional<WorkflowStepResult> workflowStepResult = this->result();
-    if (workflowStepResult){
-      Json::Reader reader;
-      Json::Value v;
-      bool parsingSuccessful = reader.parse(workflowStepResult->string(), v);
-      if (parsingSuccessful){
-        result["result"] = v;
-      }
-    }
+    addResultJSON(result);
 
-    Json::StyledWriter writer;
-    return writer.write(result);
+    return result;
   }
 
 
@@ -174,6 +199,7 @@ namespace detail{
   bool MeasureStep_Impl::setMeasureDirName(const std::string& measureDirName)
   {
     m_measureDirName = measureDirName;
+    onUpdate();
     return true;
   }
 
@@ -35,14 +35,31 @@
 
 #include <jsoncpp/json.h>
 
+#include <algorithm>
+#include <atomic>
+
 namespace openstudio {
 namespace detail {
 
+  // revision stamps are drawn from one counter so a newer stamp is always larger than any older one,
+  // this lets a result combine its own stamp with those of its step values by taking the maximum
+  static unsigned long long nextRevision()
+  {
+    static std::atomic<unsigned long long> revision(0);
+    return ++revision;
+  }
+
   WorkflowStepValue_Impl::WorkflowStepValue_Impl(const std::string& name, const Variant& value)
-    : m_name(name), m_value(value)
+    : m_name(name), m_value(value), m_revision(nextRevision())
   {}
 
   std::string WorkflowStepValue_Impl::string() const
+  {
+    Json::StyledWriter writer;
+    return writer.write(toJSON());
+  }
+
+  Json::Value WorkflowStepValue_Impl::toJSON() const
   {
     Json::Value value(Json::objectValue);
     value["name"] = m_name;
@@ -65,10 +82,18 @@ namespace detail {
       value["value"] = m_value.valueAsBoolean();
     }
 
-    Json::StyledWriter writer;
-    std::string result = writer.write(value);
+    return value;
+  }
 
-    return result;  }
+  unsigned long long WorkflowStepValue_Impl::revision() const
+  {
+    return m_revision;
+  }
+
+  void WorkflowStepValue_Impl::onUpdate()
+  {
+    m_revision = nextRevision();
+  }
 
   std::string WorkflowStepValue_Impl::name() const
   {
@@ -121,32 +146,44 @@ namespace detail {
   void WorkflowStepValue_Impl::setName(const std::string& name)
   {
     m_name = name;
+    onUpdate();
   }
 
   void WorkflowStepValue_Impl::setDisplayName(const std::string& displayName)
   {
     m_displayName = displayName;
+    onUpdate();
   }
 
   void WorkflowStepValue_Impl::resetDisplayName()
   {
     m_displayName.reset();
+    onUpdate();
   }
 
   void WorkflowStepValue_Impl::setUnits(const std::string& units)
   {
     m_units = units;
+    onUpdate();
   }
 
   void WorkflowStepValue_Impl::resetUnits()
   {
     m_units.reset();
+    onUpdate();
   }
 
   WorkflowStepResult_Impl::WorkflowStepResult_Impl()
+    : m_revision(nextRevision())
   {}
 
   std::string WorkflowStepResult_Impl::string() const
+  {
+    Json::StyledWriter writer;
+    return writer.write(toJSON());
+  }
+
+  Json::Value WorkflowStepResult_Impl::toJSON() const
   {
     Json::Value value(Json::objectValue);
     bool complete = false;
@@ -238,14 +275,8 @@ namespace detail {
 
     if (complete || (stepValues().size() > 0)){
       Json::Value values(Json::arrayValue);
-      for (const auto& stepValue : stepValues()){
-        
-        Json::Value v;
-        Json::Reader reader;
-        bool parsingSuccessful = reader.parse(stepValue.string(), v);
-        if (parsingSuccessful){
-          values.append(v);
-        }
+      for (const auto& stepValue : m_stepValues){
+        values.append(stepValue.getImpl<WorkflowStepValue_Impl>()->toJSON());
       }
       value["step_values"] = values;
     }
@@ -266,12 +297,23 @@ namespace detail {
       value["stderr"] = stdErr().get();
     }
 
-    Json::StyledWriter writer;
-    std::string result = writer.write(value);
+    return value;
+  }
 
+  unsigned long long WorkflowStepResult_Impl::revision() const
+  {
+    unsigned long long result = m_revision;
+    for (const auto& stepValue : m_stepValues){
+      result = std::max(result, stepValue.getImpl<WorkflowStepValue_Impl>()->revision());
+    }
     return result;
   }
 
+  void WorkflowStepResult_Impl::onUpdate()
+  {
+    m_revision = nextRevision();
+  }
+
   boost::optional<DateTime> WorkflowStepResult_Impl::startedAt() const
   {
     return m_startedAt;
@@ -495,242 +537,288 @@ namespace detail {
   void WorkflowStepResult_Impl::setStartedAt(const DateTime& dateTime)
   {
     m_startedAt = dateTime;
+    onUpdate();
   }
 
   void WorkflowStepResult_Impl::resetStartedAt()
   {
     m_startedAt.reset();
+    onUpdate();
   }
 
   void WorkflowStepResult_Impl::setCompletedAt(const DateTime& dateTime)
   {
     m_completedAt = dateTime;
+    onUpdate();
   }
 
   void WorkflowStepResult_Impl::resetCompletedAt()
   {
     m_completedAt.reset();
+    onUpdate();
   }
     
   bool WorkflowStepResult_Impl::setMeasureType(const MeasureType& measureType)
   {
     m_measureType = measureType;
+    onUpdate();
     return true;
   }
 
   void WorkflowStepResult_Impl::resetMeasureType()
   {
     m_measureType.reset();
+    onUpdate();
   }
 
   bool WorkflowStepResult_Impl::setMeasureName(const std::string& name)
   {
     m_measureName = name;
+    onUpdate();
     return true;
   }
 
   void WorkflowStepResult_Impl::resetMeasureName()
   {
     m_measureName.reset();
+    onUpdate();
   }
 
   bool WorkflowStepResult_Impl::setMeasureId(const std::string& id)
   {
     m_measureId = id;
+    onUpdate();
     return true;
   }
 
   void WorkflowStepResult_Impl::resetMeasureId()
   {
     m_measureId.reset();
+    onUpdate();
   }
   
   bool WorkflowStepResult_Impl::setMeasureUUID(const UUID& uuid)
   {
     m_measureId = removeBraces(uuid);
+    onUpdate();
     return true;
   }
 
   void WorkflowStepResult_Impl::resetMeasureUUID()
   {
     m_measureId.reset();
+    onUpdate();
   }
 
   bool WorkflowStepResult_Impl::setMeasureVersionId(const std::string& id)
   {
     m_measureVersionId = id;
+    onUpdate();
     return true;
   }
 
   void WorkflowStepResult_Impl::resetMeasureVersionId()
   {
     m_measureVersionId.reset();
+    onUpdate();
   }
   
   bool WorkflowStepResult_Impl::setMeasureVersionUUID(const UUID& uuid)
   {
     m_measureVersionId = removeBraces(uuid);
+    onUpdate();
     return true;
   }
 
   void WorkflowStepResult_Impl::resetMeasureVersionUUID()
   {
     m_measureVersionId.reset();
+    onUpdate();
   }
 
   bool WorkflowStepResult_Impl::setMeasureVersionModified(const DateTime& versionModified)
   {
     m_measureVersionModified = versionModified.toISO8601();
+    onUpdate();
     return true;
   }
 
   void WorkflowStepResult_Impl::resetMeasureVersionModified()
   {
     m_measureVersionModified.reset();
+    onUpdate();
   }
 
   bool WorkflowStepResult_Impl::setMeasureXmlChecksum(const std::string& checksum)
   {
     m_measureXmlChecksum = checksum;
+    onUpdate();
     return true;
   }
 
   void WorkflowStepResult_Impl::resetMeasureXmlChecksum()
   {
     m_measureXmlChecksum.reset();
+    onUpdate();
   }
 
   bool WorkflowStepResult_Impl::setMeasureClassName(const std::string& className)
   {
     m_measureClassName = className;
+    onUpdate();
     return true;
   }
 
   void WorkflowStepResult_Impl::resetMeasureClassName()
   {
     m_measureClassName.reset();
+    onUpdate();
   }
 
   bool WorkflowStepResult_Impl::setMeasureDisplayName(const std::string& displayName)
   {
     m_measureDisplayName = displayName;
+    onUpdate();
     return true;
   }
 
   void WorkflowStepResult_Impl::resetMeasureDisplayName()
   {
     m_measureDisplayName.reset();
+    onUpdate();
   }
 
   bool WorkflowStepResult_Impl::setMeasureTaxonomy(const std::string& taxonomy)
   {
     m_measureTaxonomy = taxonomy;
+    onUpdate();
     return true;
   }
 
   void WorkflowStepResult_Impl::resetMeasureTaxonomy()
   {
     m_measureTaxonomy.reset();
+    onUpdate();
   }
 
   void WorkflowStepResult_Impl::setStepResult(const StepResult& result)
   {
     m_stepResult = result;
+    onUpdate();
   }
 
   void WorkflowStepResult_Impl::resetStepResult()
   {
     m_stepResult.reset();
+    onUpdate();
   }
 
   void WorkflowStepResult_Impl::setStepInitialCondition(const std::string& initialCondition)
   {
     m_stepInitialCondition = initialCondition;
+    onUpdate();
   }
 
   void WorkflowStepResult_Impl::resetStepInitialCondition()
   {
     m_stepInitialCondition.reset();
+    onUpdate();
   }
 
   void WorkflowStepResult_Impl::setStepFinalCondition(const std::string& finalCondition)
   {
     m_stepFinalCondition = finalCondition;
+    onUpdate();
   }
 
   void WorkflowStepResult_Impl::resetStepFinalCondition()
   {
     m_stepFinalCondition.reset();
+    onUpdate();
   }
 
   void WorkflowStepResult_Impl::addStepError(const std::string& error)
   {
     m_stepErrors.push_back(error);
+    onUpdate();
   }
 
   void WorkflowStepResult_Impl::resetStepErrors()
   {
     m_stepErrors.clear();
+    onUpdate();
   }
 
   void WorkflowStepResult_Impl::addStepWarning(const std::string& warning)
   {
     m_stepWarnings.push_back(warning);
+    onUpdate();
   }
 
   void WorkflowStepResult_Impl::resetStepWarnings()
   {
     m_stepWarnings.clear();
+    onUpdate();
   }
 
   void WorkflowStepResult_Impl::addStepInfo(const std::string& info)
   {
     m_stepInfo.push_back(info);
+    onUpdate();
   }
 
   void WorkflowStepResult_Impl::resetStepInfo()
   {
     m_stepInfo.clear();
+    onUpdate();
   }
 
   void WorkflowStepResult_Impl::addStepValue(const WorkflowStepValue& value)
   {
     m_stepValues.push_back(value);
+    onUpdate();
   }
 
   void WorkflowStepResult_Impl::resetStepValues()
   {
     m_stepValues.clear();
+    onUpdate();
   }
 
   void WorkflowStepResult_Impl::addStepFile(const openstudio::path& path)
   {
     m_stepFiles.push_back(path);
+    onUpdate();
   }
 
   void WorkflowStepResult_Impl::resetStepFiles()
   {
     m_stepFiles.clear();
+    onUpdate();
   }
 
   void WorkflowStepResult_Impl::setStdOut(const std::string& stdOut)
   {
     m_stdOut = stdOut;
+    onUpdate();
   }
 
   void WorkflowStepResult_Impl::resetStdOut()
   {
     m_stdOut.reset();
+    onUpdate();
   }
 
   void WorkflowStepResult_Impl::setStdErr(const std::string& stdErr)
   {
     m_stdErr = stdErr;
+    onUpdate();
   }
 
   void WorkflowStepResult_Impl::resetStdErr()
   {
     m_stdErr.reset();
+    onUpdate();
   }
 
 } // detail
@@ -41,6 +41,7 @@ namespace openstudio {
 namespace detail{
   class WorkflowStepValue_Impl;
   class WorkflowStepResult_Impl;
+  class WorkflowStep_Impl;
 }
 class DateTime;
 class Variant;
@@ -139,6 +140,7 @@ class UTILITIES_API WorkflowStepValue {
   }
 
   friend class detail::WorkflowStepValue_Impl;
+  friend class detail::WorkflowStepResult_Impl;
 
   /** Protected constructor from impl. */
   WorkflowStepValue(std::shared_ptr<detail::WorkflowStepValue_Impl> impl);
@@ -326,6 +328,7 @@ class UTILITIES_API WorkflowStepResult {
   }
 
   friend class detail::WorkflowStepResult_Impl;
+  friend class detail::WorkflowStep_Impl;
 
   /** Protected constructor from impl. */
   WorkflowStepResult(std::shared_ptr<detail::WorkflowStepResult_Impl> impl);
@@ -38,6 +38,8 @@
 #include "../utilities/time/DateTime.hpp"
 #include "../utilities/bcl/BCLMeasure.hpp"
 
+#include <jsoncpp/json.h>
+
 namespace openstudio {
 namespace detail {
 
@@ -48,6 +50,11 @@ class UTILITIES_API WorkflowStepValue_Impl {
 
   std::string string() const;
 
+  Json::Value toJSON() const;
+
+  // stamp of the last change to this value, increases on every change
+  unsigned long long revision() const;
+
   //@}
   /** @name Getters */
   //@{
@@ -88,10 +95,13 @@ class UTILITIES_API WorkflowStepValue_Impl {
 
    REGISTER_LOGGER("openstudio.WorkflowStepValue");
 
+   void onUpdate();
+
    std::string m_name;
    Variant m_value;
    boost::optional<std::string> m_displayName;
    boost::optional<std::string> m_units;
+   unsigned long long m_revision;
 };
 
 class UTILITIES_API WorkflowStepResult_Impl {
@@ -101,6 +111,11 @@ class UTILITIES_API WorkflowStepResult_Impl {
 
   std::string string() const;
 
+  Json::Value toJSON() const;
+
+  // stamp of the last change to this result or any of its step values, increases on every change
+  unsigned long long revision() const;
+
   boost::optional<DateTime> startedAt() const;
 
   boost::optional<DateTime> completedAt() const;
@@ -228,6 +243,8 @@ class UTILITIES_API WorkflowStepResult_Impl {
  private:
    REGISTER_LOGGER("openstudio.WorkflowStepResult");
 
+   void onUpdate();
+
    boost::optional<DateTime> m_startedAt;
    boost::optional<DateTime> m_completedAt;
    boost::optional<MeasureType> m_measureType;
@@ -249,6 +266,7 @@ class UTILITIES_API WorkflowStepResult_Impl {
    std::vector<openstudio::path> m_stepFiles;
    boost::optional<std::string> m_stdOut;
    boost::optional<std::string> m_stdErr;
+   unsigned long long m_revision;
 };
 
 
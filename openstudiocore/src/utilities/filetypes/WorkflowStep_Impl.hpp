@@ -53,7 +53,12 @@ namespace detail {
 
     virtual ~WorkflowStep_Impl();
 
-    virtual std::string string() const = 0;
+    virtual std::string string() const;
+
+    virtual Json::Value toJSON() const = 0;
+
+    // checksum of the compact serialization of this step and its result, cached until either changes
+    std::string digest() const;
 
     boost::optional<WorkflowStepResult> result() const;
 
@@ -68,6 +73,9 @@ namespace detail {
     
     void onUpdate();
 
+    // adds the result subtree, if any, to a step's JSON value
+    void addResultJSON(Json::Value& value) const;
+
   private:
 
     // configure logging
@@ -75,6 +83,9 @@ namespace detail {
 
     boost::optional<WorkflowStepResult> m_result;
 
+    mutable boost::optional<std::string> m_digest;
+    mutable unsigned long long m_digestResultRevision;
+
   };
 
   class UTILITIES_API MeasureStep_Impl : public WorkflowStep_Impl
@@ -83,7 +94,7 @@ namespace detail {
 
     MeasureStep_Impl(const std::string& measureDirName);
 
-    virtual std::string string() const;
+    virtual Json::Value toJSON() const;
 
     std::string measureDirName() const;
     bool setMeasureDirName(const std::string& measureDirName);
@@ -35,6 +35,7 @@
 #include "../WorkflowStepResult.hpp"
 
 #include "../../time/DateTime.hpp"
+#include "../../time/Time.hpp"
 
 #include "../../core/Exception.hpp"
 #include "../../core/System.hpp"
@@ -234,8 +235,6 @@ TEST(Filetypes, WorkflowJSON_Load)
   EXPECT_EQ(workflow1.computeHash(), workflow2.computeHash());
   EXPECT_EQ(checksum(s1), checksum(s2));
   EXPECT_EQ(workflow2.hash(), workflow2.computeHash());
-  EXPECT_EQ(workflow2.hash(), checksum(s2));
-  EXPECT_EQ(workflow2.computeHash(), checksum(s2));
 
   EXPECT_FALSE(workflow2.checkForUpdates());
 
@@ -1070,4 +1069,73 @@ TEST(Filetypes, RunOptions)
   ASSERT_TRUE(workflow2->runOptions()->customOutputAdapter());
   EXPECT_EQ("my_ruby_file.rb", workflow2->runOptions()->customOutputAdapter()->customFileName());
   EXPECT_EQ("MyOutputAdapter", workflow2->runOptions()->customOutputAdapter()->className());
-}
\ No newline at end of file
+}
+
+TEST(Filetypes, WorkflowJSON_LargeWorkflow)
+{
+  unsigned numSteps = 50;
+  unsigned numValues = 2000;
+
+  WorkflowJSON workflow;
+
+  std::vector<WorkflowStep> steps;
+  for (unsigned i = 0; i < numSteps; ++i){
+    MeasureStep step("Measure " + std::to_string(i));
+    step.setArgument("index", static_cast<int>(i));
+
+    WorkflowStepResult result = getWorkflowStepResult(step, boost::none);
+    for (unsigned j = 0; j < numValues; ++j){
+      result.addStepValue(WorkflowStepValue("value_" + std::to_string(j), 0.5 * j));
+    }
+    step.setResult(result);
+    steps.push_back(step);
+  }
+  workflow.setWorkflowSteps(steps);
+
+  openstudio::Time start = openstudio::Time::currentTime();
+  std::string s = workflow.string();
+  openstudio::Time stringTime = openstudio::Time::currentTime() - start;
+
+  start = openstudio::Time::currentTime();
+  EXPECT_TRUE(workflow.checkForUpdates());
+  openstudio::Time firstHashTime = openstudio::Time::currentTime() - start;
+
+  start = openstudio::Time::currentTime();
+  EXPECT_FALSE(workflow.checkForUpdates());
+  openstudio::Time cachedHashTime = openstudio::Time::currentTime() - start;
+
+  LOG_FREE(Info, "WorkflowJSON", numSteps << " steps with " << numValues << " values each: string in " << stringTime
+    << "s, first checkForUpdates in " << firstHashTime << "s, unchanged checkForUpdates in " << cachedHashTime << "s.");
+
+  // serialized subtrees round trip
+  boost::optional<WorkflowJSON> workflow2 = WorkflowJSON::load(workflow.string());
+  ASSERT_TRUE(workflow2);
+  EXPECT_EQ(workflow.string(), workflow2->string());
+  EXPECT_EQ(workflow.hash(), workflow2->computeHash());
+  ASSERT_EQ(numSteps, workflow2->workflowSteps().size());
+  ASSERT_TRUE(workflow2->workflowSteps()[0].result());
+  EXPECT_EQ(numValues + 4, workflow2->workflowSteps()[0].result()->stepValues().size());
+
+  // edits made in place on a shared result or step value invalidate that step's digest
+  std::string hash = workflow.hash();
+  WorkflowStepResult result = steps[numSteps / 2].result().get();
+  result.addStepValue(WorkflowStepValue("added", "value"));
+
+  start = openstudio::Time::currentTime();
+  EXPECT_TRUE(workflow.checkForUpdates());
+  openstudio::Time changedHashTime = openstudio::Time::currentTime() - start;
+  EXPECT_NE(hash, workflow.hash());
+  LOG_FREE(Info, "WorkflowJSON", "checkForUpdates after changing one step in " << changedHashTime << "s.");
+
+  hash = workflow.hash();
+  WorkflowStepValue value = result.stepValues().back();
+  value.setDisplayName("Added");
+  EXPECT_TRUE(workflow.checkForUpdates());
+  EXPECT_NE(hash, workflow.hash());
+
+  hash = workflow.hash();
+  steps[0].cast<MeasureStep>().setArgument("index", 100);
+  EXPECT_TRUE(workflow.checkForUpdates());
+  EXPECT_NE(hash, workflow.hash());
+  EXPECT_FALSE(workflow.checkForUpdates());
+}
@@ -38,6 +38,8 @@
 #include <jsoncpp/json.h>
 
 #include <iostream>
+#include <map>
+#include <set>
 #include <string>
 
 namespace openstudio{
@@ -171,9 +173,7 @@ namespace openstudio{
     }
   }
 
-  void makeGeometries(const Json::Value& story, const Json::Value& space, const std::string& spaceNamePostFix, double minZ, double maxZ,
-    const Json::Value& vertices, const Json::Value& edges, const Json::Value& faces, const std::string& faceId,
-    bool openstudioFormat, std::vector<ThreeGeometry>& geometries, std::vector<ThreeSceneChild>& sceneChildren)
+  Point3dVector getFaceVertices(const Json::Value& vertices, const Json::Value& edges, const Json::Value& faces, const std::string& faceId)
   {
     std::vector<Point3d> faceVertices;
 
@@ -219,6 +219,12 @@ namespace openstudio{
       }
     }
 
+    return faceVertices;
+  }
+
+  void makeGeometries(const Json::Value& story, const Json::Value& space, const std::string& spaceNamePostFix, double minZ, double maxZ,
+    Point3dVector faceVertices, bool openstudioFormat, std::vector<ThreeGeometry>& geometries, std::vector<ThreeSceneChild>& sceneChildren)
+  {
     // correct the floor vertices
 
     unsigned numPoints = faceVertices.size();
@@ -276,7 +282,103 @@ namespace openstudio{
     
   }
 
-  ThreeScene FloorplanJS::toThreeScene(bool openstudioFormat) const
+  void getStoryHeights(const Json::Value& story, double& belowFloorPlenumHeight, double& floorToCeilingHeight, double& aboveCeilingPlenumHeight)
+  {
+    belowFloorPlenumHeight = 0;
+    if (checkKeyAndType(story, "below_floor_plenum_height", Json::realValue)){
+      belowFloorPlenumHeight = story.get("below_floor_plenum_height", belowFloorPlenumHeight).asDouble();
+    }
+
+    floorToCeilingHeight = 3;
+    if (checkKeyAndType(story, "floor_to_ceiling_height", Json::realValue)){
+      floorToCeilingHeight = story.get("floor_to_ceiling_height", floorToCeilingHeight).asDouble();
+    }
+    // DLM: temp code
+    if (floorToCeilingHeight < 0.1){
+      floorToCeilingHeight = 3;
+    }
+
+    aboveCeilingPlenumHeight = 0;
+    if (checkKeyAndType(story, "above_ceiling_plenum_height", Json::realValue)){
+      aboveCeilingPlenumHeight = story.get("above_ceiling_plenum_height", aboveCeilingPlenumHeight).asDouble();
+    }
+  }
+
+  // everything that goes into the geometry generated for one space
+  struct FloorplanSpaceState
+  {
+    std::string name;
+    std::string storyName;
+    double currentZ;
+    double belowFloorPlenumHeight;
+    double floorToCeilingHeight;
+    double aboveCeilingPlenumHeight;
+    Json::Value space;
+    Point3dVector faceVertices;
+
+    bool operator==(const FloorplanSpaceState& other) const
+    {
+      return (name == other.name) && (storyName == other.storyName) && (currentZ == other.currentZ) &&
+        (belowFloorPlenumHeight == other.belowFloorPlenumHeight) && (floorToCeilingHeight == other.floorToCeilingHeight) &&
+        (aboveCeilingPlenumHeight == other.aboveCeilingPlenumHeight) && (space == other.space) && (faceVertices == other.faceVertices);
+    }
+  };
+
+  // spaces without an id cannot be matched between floorplans and are not included
+  std::map<std::string, FloorplanSpaceState> getSpaceStates(const Json::Value& value)
+  {
+    std::map<std::string, FloorplanSpaceState> result;
+
+    double currentZ = 0;
+
+    Json::Value stories = value.get("stories", Json::arrayValue);
+    Json::ArrayIndex storyN = stories.size();
+    for (Json::ArrayIndex storyIdx = 0; storyIdx < storyN; ++storyIdx){
+
+      assertKeyAndType(stories[storyIdx], "name", Json::stringValue);
+      std::string storyName = stories[storyIdx].get("name", "").asString();
+
+      double belowFloorPlenumHeight;
+      double floorToCeilingHeight;
+      double aboveCeilingPlenumHeight;
+      getStoryHeights(stories[storyIdx], belowFloorPlenumHeight, floorToCeilingHeight, aboveCeilingPlenumHeight);
+
+      assertKeyAndType(stories[storyIdx], "geometry", Json::objectValue);
+      Json::Value geometry = stories[storyIdx].get("geometry", Json::arrayValue);
+      Json::Value vertices = geometry.get("vertices", Json::arrayValue);
+      Json::Value edges = geometry.get("edges", Json::arrayValue);
+      Json::Value faces = geometry.get("faces", Json::arrayValue);
+
+      Json::Value spaces = stories[storyIdx].get("spaces", Json::arrayValue);
+      Json::ArrayIndex spaceN = spaces.size();
+      for (Json::ArrayIndex spaceIdx = 0; spaceIdx < spaceN; ++spaceIdx){
+        if (!checkKeyAndType(spaces[spaceIdx], "id", Json::stringValue)){
+          continue;
+        }
+
+        FloorplanSpaceState state;
+        state.name = spaces[spaceIdx].get("name", "").asString();
+        state.storyName = storyName;
+        state.currentZ = currentZ;
+        state.belowFloorPlenumHeight = belowFloorPlenumHeight;
+        state.floorToCeilingHeight = floorToCeilingHeight;
+        state.aboveCeilingPlenumHeight = aboveCeilingPlenumHeight;
+        state.space = spaces[spaceIdx];
+        if (checkKeyAndType(spaces[spaceIdx], "face_id", Json::stringValue)){
+          state.faceVertices = getFaceVertices(vertices, edges, faces, spaces[spaceIdx].get("face_id", "").asString());
+        }
+
+        result.insert(std::make_pair(spaces[spaceIdx].get("id", "").asString(), state));
+      }
+
+      currentZ += belowFloorPlenumHeight + floorToCeilingHeight + aboveCeilingPlenumHeight;
+    }
+
+    return result;
+  }
+
+  // convert the spaces in spaceIds, or all spaces if spaceIds is null
+  ThreeScene makeThreeScene(const Json::Value& value, bool openstudioFormat, const std::set<std::string>* spaceIds)
   {
     std::vector<ThreeGeometry> geometries;
     std::vector<ThreeMaterial> materials;
@@ -286,7 +388,7 @@ namespace openstudio{
     double currentZ = 0;
 
     // loop over stories
-    Json::Value stories = m_value.get("stories", Json::arrayValue);
+    Json::Value stories = value.get("stories", Json::arrayValue);
     Json::ArrayIndex storyN = stories.size();
     for (Json::ArrayIndex storyIdx = 0; storyIdx < storyN; ++storyIdx){
 
@@ -295,24 +397,10 @@ namespace openstudio{
       std::string storyName = stories[storyIdx].get("name", "").asString();
       buildingStoryNames.push_back(storyName);
 
-      double belowFloorPlenumHeight = 0;
-      if (checkKeyAndType(stories[storyIdx], "below_floor_plenum_height", Json::realValue)){
-        belowFloorPlenumHeight = stories[storyIdx].get("below_floor_plenum_height", belowFloorPlenumHeight).asDouble();
-      }
-       
-      double floorToCeilingHeight = 3;
-      if (checkKeyAndType(stories[storyIdx], "floor_to_ceiling_height", Json::realValue)){
-        floorToCeilingHeight = stories[storyIdx].get("floor_to_ceiling_height", floorToCeilingHeight).asDouble();
-      }
-      // DLM: temp code
-      if (floorToCeilingHeight < 0.1){
-        floorToCeilingHeight = 3;
-      }
-
-      double aboveCeilingPlenumHeight = 0;
-      if (checkKeyAndType(stories[storyIdx], "above_ceiling_plenum_height", Json::realValue)){
-        aboveCeilingPlenumHeight = stories[storyIdx].get("above_ceiling_plenum_height", aboveCeilingPlenumHeight).asDouble();
-      }
+      double belowFloorPlenumHeight;
+      double floorToCeilingHeight;
+      double aboveCeilingPlenumHeight;
+      getStoryHeights(stories[storyIdx], belowFloorPlenumHeight, floorToCeilingHeight, aboveCeilingPlenumHeight);
 
       // get the geometry
       assertKeyAndType(stories[storyIdx], "geometry", Json::objectValue);
@@ -326,26 +414,34 @@ namespace openstudio{
       Json::ArrayIndex spaceN = spaces.size();
       for (Json::ArrayIndex spaceIdx = 0; spaceIdx < spaceN; ++spaceIdx){
 
+        if (spaceIds){
+          std::string spaceId = spaces[spaceIdx].get("id", "").asString();
+          if (spaceIds->find(spaceId) == spaceIds->end()){
+            continue;
+          }
+        }
+
         // each space should have one face
         if (checkKeyAndType(spaces[spaceIdx], "face_id", Json::stringValue)){
           std::string faceId = spaces[spaceIdx].get("face_id", "").asString(); 
+          Point3dVector faceVertices = getFaceVertices(vertices, edges, faces, faceId);
 
           double minZ = currentZ;
           double maxZ = currentZ + belowFloorPlenumHeight;
           if (belowFloorPlenumHeight > 0){
-            makeGeometries(stories[storyIdx], spaces[spaceIdx], " Floor Plenum", minZ, maxZ, vertices, edges, faces, faceId, openstudioFormat, geometries, children);
+            makeGeometries(stories[storyIdx], spaces[spaceIdx], " Floor Plenum", minZ, maxZ, faceVertices, openstudioFormat, geometries, children);
           }
 
           minZ = maxZ;
           maxZ += floorToCeilingHeight;
           if (floorToCeilingHeight > 0){
-            makeGeometries(stories[storyIdx], spaces[spaceIdx], "", minZ, maxZ, vertices, edges, faces, faceId, openstudioFormat, geometries, children);
+            makeGeometries(stories[storyIdx], spaces[spaceIdx], "", minZ, maxZ, faceVertices, openstudioFormat, geometries, children);
           }
 
           minZ = maxZ;
           maxZ += aboveCeilingPlenumHeight;
           if (aboveCeilingPlenumHeight > 0){
-            makeGeometries(stories[storyIdx], spaces[spaceIdx], " Plenum", minZ, maxZ, vertices, edges, faces, faceId, openstudioFormat, geometries, children);
+            makeGeometries(stories[storyIdx], spaces[spaceIdx], " Plenum", minZ, maxZ, faceVertices, openstudioFormat, geometries, children);
           }
         } 
 
@@ -366,5 +462,72 @@ namespace openstudio{
     return result;
   }
 
+  FloorplanJSDiff::FloorplanJSDiff()
+  {}
+
+  std::vector<std::string> FloorplanJSDiff::addedSpaceIds() const
+  {
+    return m_addedSpaceIds;
+  }
+
+  std::vector<std::string> FloorplanJSDiff::changedSpaceIds() const
+  {
+    return m_changedSpaceIds;
+  }
+
+  std::vector<std::string> FloorplanJSDiff::removedSpaceIds() const
+  {
+    return m_removedSpaceIds;
+  }
+
+  std::vector<std::string> FloorplanJSDiff::previousSpaceNames() const
+  {
+    return m_previousSpaceNames;
+  }
+
+  bool FloorplanJSDiff::empty() const
+  {
+    return m_addedSpaceIds.empty() && m_changedSpaceIds.empty() && m_removedSpaceIds.empty();
+  }
+
+  ThreeScene FloorplanJS::toThreeScene(bool openstudioFormat) const
+  {
+    return makeThreeScene(m_value, openstudioFormat, nullptr);
+  }
+
+  ThreeScene FloorplanJS::toThreeScene(bool openstudioFormat, const FloorplanJSDiff& diff) const
+  {
+    std::set<std::string> spaceIds;
+    spaceIds.insert(diff.m_addedSpaceIds.begin(), diff.m_addedSpaceIds.end());
+    spaceIds.insert(diff.m_changedSpaceIds.begin(), diff.m_changedSpaceIds.end());
+    return makeThreeScene(m_value, openstudioFormat, &spaceIds);
+  }
+
+  FloorplanJSDiff FloorplanJS::diff(const FloorplanJS& previous) const
+  {
+    FloorplanJSDiff result;
+
+    std::map<std::string, FloorplanSpaceState> currentStates = getSpaceStates(m_value);
+    std::map<std::string, FloorplanSpaceState> previousStates = getSpaceStates(previous.m_value);
+
+    for (const auto& current : currentStates){
+      auto it = previousStates.find(current.first);
+      if (it == previousStates.end()){
+        result.m_addedSpaceIds.push_back(current.first);
+      } else if (!(it->second == current.second)){
+        result.m_changedSpaceIds.push_back(current.first);
+        result.m_previousSpaceNames.push_back(it->second.name);
+      }
+    }
+
+    for (const auto& prev : previousStates){
+      if (currentStates.find(prev.first) == currentStates.end()){
+        result.m_removedSpaceIds.push_back(prev.first);
+        result.m_previousSpaceNames.push_back(prev.second.name);
+      }
+    }
+
+    return result;
+  }
 
 } // openstudio
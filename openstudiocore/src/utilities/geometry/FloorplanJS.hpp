@@ -44,6 +44,40 @@
 namespace openstudio{
 
   class ThreeScene;
+  class FloorplanJS;
+
+  /** FloorplanJSDiff lists the spaces that differ between two versions of a floorplan, spaces are matched by id
+  *
+  *  A space is changed if anything used to generate its geometry differs, including the heights of stories below it
+  */
+  class UTILITIES_API FloorplanJSDiff{
+  public:
+
+    /// ids of spaces only in the current floorplan
+    std::vector<std::string> addedSpaceIds() const;
+
+    /// ids of spaces in both floorplans whose geometry or properties differ
+    std::vector<std::string> changedSpaceIds() const;
+
+    /// ids of spaces only in the previous floorplan
+    std::vector<std::string> removedSpaceIds() const;
+
+    /// names in the previous floorplan of the changed and removed spaces, these are the spaces to replace in a model
+    std::vector<std::string> previousSpaceNames() const;
+
+    /// true if no space was added, changed, or removed
+    bool empty() const;
+
+  private:
+    friend class FloorplanJS;
+
+    FloorplanJSDiff();
+
+    std::vector<std::string> m_addedSpaceIds;
+    std::vector<std::string> m_changedSpaceIds;
+    std::vector<std::string> m_removedSpaceIds;
+    std::vector<std::string> m_previousSpaceNames;
+  };
 
   /** FloorplanJS is an adapter for the Geometry Editor JSON format
   *
@@ -64,6 +98,12 @@ namespace openstudio{
     /// convert to ThreeJS, will throw if error
     ThreeScene toThreeScene(bool breakSurfaces) const;
 
+    /// convert only the spaces added or changed in diff to ThreeJS, will throw if error
+    ThreeScene toThreeScene(bool breakSurfaces, const FloorplanJSDiff& diff) const;
+
+    /// compare to a previous version of this floorplan, spaces without an id are not compared
+    FloorplanJSDiff diff(const FloorplanJS& previous) const;
+
   private:
     REGISTER_LOGGER("FloorplanJS");
 
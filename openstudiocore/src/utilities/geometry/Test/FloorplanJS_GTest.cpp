@@ -76,3 +76,74 @@ TEST_F(GeometryFixture, FloorplanJS)
   }
 
 }
+
+TEST_F(GeometryFixture, FloorplanJS_Diff)
+{
+  openstudio::path p = resourcesPath() / toPath("utilities/Geometry/floorplan.json");
+  ASSERT_TRUE(exists(p));
+
+  boost::optional<FloorplanJS> floorplan = FloorplanJS::load(toString(p));
+  ASSERT_TRUE(floorplan);
+
+  Json::Value value;
+  Json::Reader reader;
+  ASSERT_TRUE(reader.parse(floorplan->toJSON(), value));
+
+  // same floorplan
+  FloorplanJSDiff diff = floorplan->diff(*floorplan);
+  EXPECT_TRUE(diff.empty());
+  EXPECT_TRUE(floorplan->toThreeScene(true, diff).object().children().empty());
+
+  // move a vertex on the second story
+  Json::Value moved = value;
+  moved["stories"][1]["geometry"]["vertices"][0]["x"] = 1.5;
+  boost::optional<FloorplanJS> movedFloorplan = FloorplanJS::load(Json::FastWriter().write(moved));
+  ASSERT_TRUE(movedFloorplan);
+
+  diff = movedFloorplan->diff(*floorplan);
+  EXPECT_FALSE(diff.empty());
+  EXPECT_TRUE(diff.addedSpaceIds().empty());
+  EXPECT_TRUE(diff.removedSpaceIds().empty());
+  ASSERT_FALSE(diff.changedSpaceIds().empty());
+  EXPECT_EQ(diff.changedSpaceIds().size(), diff.previousSpaceNames().size());
+  for (const auto& name : diff.previousSpaceNames()){
+    EXPECT_TRUE(name == "Space 3" || name == "Space 4") << name;
+  }
+
+  // only the changed spaces are converted
+  ThreeScene scene = movedFloorplan->toThreeScene(true, diff);
+  EXPECT_FALSE(scene.object().children().empty());
+  for (const auto& child : scene.object().children()){
+    EXPECT_EQ("Story 2", child.userData().buildingStoryName());
+  }
+  EXPECT_LT(scene.object().children().size(), movedFloorplan->toThreeScene(true).object().children().size());
+
+  // raising the first story moves every space above it
+  Json::Value raised = value;
+  raised["stories"][0]["floor_to_ceiling_height"] = 4.5;
+  boost::optional<FloorplanJS> raisedFloorplan = FloorplanJS::load(Json::FastWriter().write(raised));
+  ASSERT_TRUE(raisedFloorplan);
+
+  diff = raisedFloorplan->diff(*floorplan);
+  EXPECT_EQ(4u, diff.changedSpaceIds().size());
+
+  // remove a space
+  Json::Value removed = value;
+  Json::Value spaces(Json::arrayValue);
+  spaces.append(value["stories"][0]["spaces"][0]);
+  removed["stories"][0]["spaces"] = spaces;
+  boost::optional<FloorplanJS> removedFloorplan = FloorplanJS::load(Json::FastWriter().write(removed));
+  ASSERT_TRUE(removedFloorplan);
+
+  diff = removedFloorplan->diff(*floorplan);
+  EXPECT_TRUE(diff.addedSpaceIds().empty());
+  EXPECT_TRUE(diff.changedSpaceIds().empty());
+  ASSERT_EQ(1u, diff.removedSpaceIds().size());
+  ASSERT_EQ(1u, diff.previousSpaceNames().size());
+  EXPECT_EQ("Space 2", diff.previousSpaceNames()[0]);
+
+  // and add it back
+  diff = floorplan->diff(*removedFloorplan);
+  ASSERT_EQ(1u, diff.addedSpaceIds().size());
+  EXPECT_TRUE(diff.previousSpaceNames().empty());
+}
@@ -59,3 +59,36 @@ TEST_F(GeometryFixture, ThreeJS)
   scene = ThreeScene::load(toString(p));
   ASSERT_TRUE(scene);
 }
+
+TEST_F(GeometryFixture, ThreeBinaryGeometry_VertexMerging)
+{
+  // two triangles sharing an edge, the second copy of the shared points is off by less than the grid spacing
+  Point3dVector wall;
+  wall.push_back(Point3d(0, 0, 0));
+  wall.push_back(Point3d(1, 0, 0));
+  wall.push_back(Point3d(1, 0, 1));
+  wall.push_back(Point3d(0, 0, 0));
+  wall.push_back(Point3d(1, 0, 1.0001));
+  wall.push_back(Point3d(0, 0, 1));
+
+  ThreeBinaryGeometry geometry;
+  geometry.addTriangles("Wall", wall);
+  EXPECT_EQ(2u, geometry.numTriangles());
+  EXPECT_EQ(4u, geometry.numVertices());
+
+  // a floor sharing an edge with the wall keeps its own vertices
+  Point3dVector floor;
+  floor.push_back(Point3d(0, 0, 0));
+  floor.push_back(Point3d(1, 1, 0));
+  floor.push_back(Point3d(1, 0, 0));
+  geometry.addTriangles("Floor", floor);
+  EXPECT_EQ(3u, geometry.numTriangles());
+  EXPECT_EQ(7u, geometry.numVertices());
+
+  std::vector<unsigned> indices = geometry.indices();
+  ASSERT_EQ(9u, indices.size());
+  EXPECT_EQ(indices[0], indices[3]);
+  EXPECT_EQ(indices[2], indices[4]);
+  EXPECT_NE(indices[0], indices[6]);
+  EXPECT_NE(indices[1], indices[8]);
+}
@@ -34,6 +34,9 @@
 
 #include <jsoncpp/json.h>
 
+#include <cmath>
+#include <cstdint>
+#include <cstring>
 #include <iostream>
 #include <string>
 
@@ -1126,4 +1129,222 @@ namespace openstudio{
     return m_boundingBox;
   }
 
+  ThreeMaterialBatch::ThreeMaterialBatch(const std::string& materialId, unsigned indexOffset, unsigned indexCount)
+    : m_materialId(materialId), m_indexOffset(indexOffset), m_indexCount(indexCount)
+  {}
+
+  std::string ThreeMaterialBatch::materialId() const
+  {
+    return m_materialId;
+  }
+
+  unsigned ThreeMaterialBatch::indexOffset() const
+  {
+    return m_indexOffset;
+  }
+
+  unsigned ThreeMaterialBatch::indexCount() const
+  {
+    return m_indexCount;
+  }
+
+  size_t ThreeBinaryGeometry::VertexKeyHash::operator()(const std::array<long long, 3>& key) const
+  {
+    std::hash<long long> hasher;
+    size_t result = hasher(key[0]);
+    result ^= hasher(key[1]) + 0x9e3779b9 + (result << 6) + (result >> 2);
+    result ^= hasher(key[2]) + 0x9e3779b9 + (result << 6) + (result >> 2);
+    return result;
+  }
+
+  ThreeBinaryGeometry::ThreeBinaryGeometry(double tol)
+    : m_tol(tol)
+  {}
+
+  void ThreeBinaryGeometry::addTriangles(const std::string& materialId, const Point3dVector& triangles)
+  {
+    OS_ASSERT(triangles.size() % 3 == 0);
+    if (triangles.empty()){
+      return;
+    }
+
+    auto materialIt = m_materialIndices.find(materialId);
+    if (materialIt == m_materialIndices.end()){
+      m_materialIds.push_back(materialId);
+      materialIt = m_materialIndices.insert(std::make_pair(materialId, std::vector<unsigned>())).first;
+    }
+    std::vector<unsigned>& indices = materialIt->second;
+    indices.reserve(indices.size() + triangles.size());
+
+    // only vertices of this surface are merged, sharing with other surfaces would smooth their edges
+    std::unordered_map<std::array<long long, 3>, unsigned, VertexKeyHash> vertexIndices;
+    for (const Point3d& point : triangles){
+      // points in the same tol sized grid cell are merged
+      std::array<long long, 3> key = {{ std::llround(point.x() / m_tol), std::llround(point.y() / m_tol), std::llround(point.z() / m_tol) }};
+      auto vertexIt = vertexIndices.find(key);
+      if (vertexIt == vertexIndices.end()){
+        unsigned index = static_cast<unsigned>(m_positions.size() / 3);
+        m_positions.push_back(static_cast<float>(point.x()));
+        m_positions.push_back(static_cast<float>(point.y()));
+        m_positions.push_back(static_cast<float>(point.z()));
+        vertexIt = vertexIndices.insert(std::make_pair(key, index)).first;
+      }
+      indices.push_back(vertexIt->second);
+    }
+  }
+
+  std::vector<float> ThreeBinaryGeometry::positions() const
+  {
+    return m_positions;
+  }
+
+  std::vector<unsigned> ThreeBinaryGeometry::indices() const
+  {
+    std::vector<unsigned> result;
+    result.reserve(3 * numTriangles());
+    for (const auto& materialId : m_materialIds){
+      const std::vector<unsigned>& indices = m_materialIndices.find(materialId)->second;
+      result.insert(result.end(), indices.begin(), indices.end());
+    }
+    return result;
+  }
+
+  std::vector<ThreeMaterialBatch> ThreeBinaryGeometry::batches() const
+  {
+    std::vector<ThreeMaterialBatch> result;
+    unsigned indexOffset = 0;
+    for (const auto& materialId : m_materialIds){
+      unsigned indexCount = static_cast<unsigned>(m_materialIndices.find(materialId)->second.size());
+      result.push_back(ThreeMaterialBatch(materialId, indexOffset, indexCount));
+      indexOffset += indexCount;
+    }
+    return result;
+  }
+
+  unsigned ThreeBinaryGeometry::numVertices() const
+  {
+    return static_cast<unsigned>(m_positions.size() / 3);
+  }
+
+  unsigned ThreeBinaryGeometry::numTriangles() const
+  {
+    size_t result = 0;
+    for (const auto& p : m_materialIndices){
+      result += p.second.size();
+    }
+    return static_cast<unsigned>(result / 3);
+  }
+
+  std::vector<char> ThreeBinaryGeometry::toBinary() const
+  {
+    std::vector<unsigned> indices = this->indices();
+
+    std::vector<char> result;
+    result.reserve(4 * (m_positions.size() + indices.size()));
+
+    auto appendLittleEndian = [&result](uint32_t value){
+      result.push_back(static_cast<char>(value & 0xFF));
+      result.push_back(static_cast<char>((value >> 8) & 0xFF));
+      result.push_back(static_cast<char>((value >> 16) & 0xFF));
+      result.push_back(static_cast<char>((value >> 24) & 0xFF));
+    };
+
+    static_assert(sizeof(float) == sizeof(uint32_t), "float must be 32 bit");
+    for (float position : m_positions){
+      uint32_t bits;
+      std::memcpy(&bits, &position, sizeof(bits));
+      appendLittleEndian(bits);
+    }
+    for (unsigned index : indices){
+      appendLittleEndian(static_cast<uint32_t>(index));
+    }
+
+    return result;
+  }
+
+  ThreeBinaryScene::ThreeBinaryScene(const ThreeSceneMetadata& metadata, const ThreeBinaryGeometry& geometry, const std::vector<ThreeMaterial>& materials)
+    : m_metadata(metadata), m_geometry(geometry), m_materials(materials)
+  {}
+
+  std::string ThreeBinaryScene::toJSON(bool prettyPrint) const
+  {
+    Json::Value scene(Json::objectValue);
+
+    // metadata
+    scene["metadata"] = m_metadata.toJsonValue();
+
+    // materials
+    Json::Value materials(Json::arrayValue);
+    for (const auto& m : m_materials){
+      materials.append(m.toJsonValue());
+    }
+    scene["materials"] = materials;
+
+    // buffer layout
+    unsigned numVertices = m_geometry.numVertices();
+    unsigned numIndices = 3 * m_geometry.numTriangles();
+
+    Json::Value positions(Json::objectValue);
+    positions["byteOffset"] = 0;
+    positions["count"] = numVertices;
+    positions["itemSize"] = 3;
+    positions["componentType"] = "float32";
+
+    Json::Value indices(Json::objectValue);
+    indices["byteOffset"] = 12 * numVertices;
+    indices["count"] = numIndices;
+    indices["itemSize"] = 1;
+    indices["componentType"] = "uint32";
+
+    Json::Value buffer(Json::objectValue);
+    buffer["byteLength"] = 12 * numVertices + 4 * numIndices;
+    buffer["littleEndian"] = true;
+    buffer["positions"] = positions;
+    buffer["indices"] = indices;
+    scene["buffer"] = buffer;
+
+    // batches
+    Json::Value batches(Json::arrayValue);
+    for (const auto& b : m_geometry.batches()){
+      Json::Value batch(Json::objectValue);
+      batch["material"] = b.materialId();
+      batch["indexOffset"] = b.indexOffset();
+      batch["indexCount"] = b.indexCount();
+      batches.append(batch);
+    }
+    scene["batches"] = batches;
+
+    // write to string
+    std::string result;
+    if (prettyPrint){
+      Json::StyledWriter writer;
+      result = writer.write(scene);
+    } else{
+      Json::FastWriter writer;
+      result = writer.write(scene);
+    }
+
+    return result;
+  }
+
+  std::vector<char> ThreeBinaryScene::toBinary() const
+  {
+    return m_geometry.toBinary();
+  }
+
+  ThreeSceneMetadata ThreeBinaryScene::metadata() const
+  {
+    return m_metadata;
+  }
+
+  ThreeBinaryGeometry ThreeBinaryScene::geometry() const
+  {
+    return m_geometry;
+  }
+
+  std::vector<ThreeMaterial> ThreeBinaryScene::materials() const
+  {
+    return m_materials;
+  }
+
 } // openstudio
@@ -36,6 +36,9 @@
 
 #include "../core/Logger.hpp"
 
+#include <array>
+#include <map>
+#include <unordered_map>
 #include <vector>
 #include <boost/optional.hpp>
 
@@ -137,6 +140,7 @@ namespace openstudio{
 
   private:
     friend class ThreeScene;
+    friend class ThreeBinaryScene;
     ThreeMaterial(const Json::Value& json);
     Json::Value toJsonValue() const;
 
@@ -326,6 +330,7 @@ namespace openstudio{
 
   private:
     friend class ThreeScene;
+    friend class ThreeBinaryScene;
     ThreeSceneMetadata(const Json::Value& json);
     Json::Value toJsonValue() const;
 
@@ -372,6 +377,84 @@ namespace openstudio{
     ThreeSceneObject m_sceneObject;
   };
 
+  /// ThreeMaterialBatch is a range of triangle indices in a ThreeBinaryGeometry drawn with one material
+  class UTILITIES_API ThreeMaterialBatch{
+  public:
+    ThreeMaterialBatch(const std::string& materialId, unsigned indexOffset, unsigned indexCount);
+    std::string materialId() const;
+    unsigned indexOffset() const;
+    unsigned indexCount() const;
+
+  private:
+    std::string m_materialId;
+    unsigned m_indexOffset;
+    unsigned m_indexCount;
+  };
+
+  /** ThreeBinaryGeometry holds triangles in packed float32 position and uint32 index buffers, in the
+  *   style of glTF, as a compact alternative to the per surface JSON geometries of a ThreeScene.
+  *   Points are snapped to a grid with spacing tol, points of one addTriangles call that fall in the
+  *   same grid cell are stored once. Vertices are not shared between calls, so surfaces added separately
+  *   keep their own vertices and hard edges between them are not smoothed. Triangles are batched by
+  *   material so that each batch can be drawn with a single call.
+  */
+  class UTILITIES_API ThreeBinaryGeometry{
+  public:
+    ThreeBinaryGeometry(double tol = 0.001);
+
+    /// add the triangles of one surface drawn with materialId, each three consecutive points form one triangle
+    void addTriangles(const std::string& materialId, const Point3dVector& triangles);
+
+    /// x, y, z of each vertex
+    std::vector<float> positions() const;
+
+    /// vertex indices of each triangle, ordered by batch
+    std::vector<unsigned> indices() const;
+
+    /// batches in order of first use of each material
+    std::vector<ThreeMaterialBatch> batches() const;
+
+    unsigned numVertices() const;
+
+    unsigned numTriangles() const;
+
+    /// positions followed by indices, both little endian
+    std::vector<char> toBinary() const;
+
+  private:
+    struct VertexKeyHash{
+      size_t operator()(const std::array<long long, 3>& key) const;
+    };
+
+    double m_tol;
+    std::vector<float> m_positions;
+    std::vector<std::string> m_materialIds;
+    std::map<std::string, std::vector<unsigned> > m_materialIndices;
+  };
+
+  /** ThreeBinaryScene pairs a ThreeBinaryGeometry with the materials and metadata of a ThreeScene.
+  *   toJSON describes the materials, batches and buffer layout, toBinary returns the buffer itself.
+  */
+  class UTILITIES_API ThreeBinaryScene{
+  public:
+    ThreeBinaryScene(const ThreeSceneMetadata& metadata, const ThreeBinaryGeometry& geometry, const std::vector<ThreeMaterial>& materials);
+
+    /// print the header describing the binary buffer to JSON
+    std::string toJSON(bool prettyPrint = false) const;
+
+    /// the binary buffer described by toJSON
+    std::vector<char> toBinary() const;
+
+    ThreeSceneMetadata metadata() const;
+    ThreeBinaryGeometry geometry() const;
+    std::vector<ThreeMaterial> materials() const;
+
+  private:
+    ThreeSceneMetadata m_metadata;
+    ThreeBinaryGeometry m_geometry;
+    std::vector<ThreeMaterial> m_materials;
+  };
+
 } // openstudio
 
 #endif //UTILITIES_GEOMETRY_THREEJS_HPP
@@ -74,6 +74,7 @@ namespace detail {
                             m_name);
     OS_ASSERT(oField);
     m_extensibleFields.push_back(*oField);
+    cacheNameField();
   }
 
   // GETTERS
@@ -198,6 +199,7 @@ namespace detail {
         unsigned newMaxFields = m_properties.maxFields.get() + 1;
         m_properties.maxFields = newMaxFields;
       }
+      cacheNameField();
     }
   }
 
@@ -248,24 +250,17 @@ namespace detail {
   }
 
   bool IddObject_Impl::hasNameField() const {
-    if (m_nameFieldCache) {
-      return m_nameFieldCache->first;
-    }
-
-    unsigned index = 0;
-    if (hasHandleField()) {
-      index = 1;
-    }
-    bool result = ((m_fields.size() > index) && (m_fields[index].isNameField()));
-    m_nameFieldCache = std::pair<bool,unsigned>(result,index);
-    return result;
+    return nameFieldIndex().is_initialized();
   }
 
   boost::optional<unsigned> IddObject_Impl::nameFieldIndex() const {
-    if (hasNameField()) {
-      return m_nameFieldCache->second;
+    if (m_nameFieldCache) {
+      if (m_nameFieldCache->first) {
+        return m_nameFieldCache->second;
+      }
+      return boost::none;
     }
-    return boost::none;
+    return computeNameFieldIndex();
   }
 
   bool IddObject_Impl::isRequiredField(unsigned index) const {
@@ -489,6 +484,25 @@ namespace detail {
       makeExtensible();
     }
 
+    cacheNameField();
+  }
+
+  boost::optional<unsigned> IddObject_Impl::computeNameFieldIndex() const
+  {
+    unsigned index = 0;
+    if (hasHandleField()) {
+      index = 1;
+    }
+    if ((m_fields.size() > index) && (m_fields[index].isNameField())) {
+      return index;
+    }
+    return boost::none;
+  }
+
+  void IddObject_Impl::cacheNameField()
+  {
+    boost::optional<unsigned> index = computeNameFieldIndex();
+    m_nameFieldCache = std::pair<bool,unsigned>(index.is_initialized(),index.get_value_or(0u));
   }
 
   void IddObject_Impl::makeExtensible()
@@ -193,8 +193,9 @@ namespace detail {
     IddFieldVector m_extensibleFields; // vector of extensible fields, forms single
                                        // extensible field group
     std::vector<unsigned> m_urlIdx;
-    // .first = hasNameField(); .second = nameFieldIndex
-    mutable boost::optional< std::pair<bool,unsigned> > m_nameFieldCache;
+    // .first = hasNameField(); .second = nameFieldIndex. Filled whenever m_fields changes, not
+    // lazily, so that getters never write to objects shared by every workspace.
+    boost::optional< std::pair<bool,unsigned> > m_nameFieldCache;
 
     // partial constructor used by load
     IddObject_Impl(const std::string& name, const std::string& group, IddObjectType type);
@@ -207,6 +208,9 @@ namespace detail {
     void parseFields(const std::string& text);
     void makeExtensible();
 
+    boost::optional<unsigned> computeNameFieldIndex() const;
+    void cacheNameField();
+
     // configure logging
     REGISTER_LOGGER("utilities.idd.IddObject");
   };
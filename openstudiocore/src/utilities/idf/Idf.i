@@ -101,6 +101,10 @@
 %ignore openstudio::IdfFile::load(std::istream&);
 %ignore openstudio::IdfFile::load(std::istream&, IddFileType);
 %ignore openstudio::IdfFile::load(std::istream&, const IddFile&);
+%ignore openstudio::IdfFile::print(std::ostream&, unsigned) const;
+
+// scoped batches do not map to the bindings, use Workspace::beginChangeBatch and endChangeBatch
+%ignore openstudio::WorkspaceChangeBatch;
 
 #if defined(SWIGRUBY)
   // add mixins
@@ -122,6 +126,7 @@
 
 #if defined(SWIGJAVA)
   %ignore openstudio::Workspace::load;
+  %ignore openstudio::Workspace::loadSnapshot;
 #endif
 
 %include <utilities/idf/Handle.hpp>
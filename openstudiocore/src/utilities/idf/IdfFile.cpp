@@ -54,7 +54,18 @@
 #include <boost/iostreams/filter/newline.hpp>
 #include <boost/iostreams/filtering_stream.hpp>
 
+#include <zlib/zconf.h>
+#include <zlib/zlib.h>
+
 #include <sstream>
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+#include <iterator>
+#include <map>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
 
 namespace openstudio {
 
@@ -457,12 +468,64 @@ boost::optional<VersionString> IdfFile::loadVersionOnly(const path& p) {
 }
 
 std::ostream& IdfFile::print(std::ostream& os) const {
+  return print(os,0);
+}
+
+std::ostream& IdfFile::print(std::ostream& os, unsigned numThreads) const {
   if (!m_header.empty()) {
-    os << m_header << std::endl;
+    os << m_header << '\n';
+  }
+  os << '\n';
+
+  if (m_objects.empty()) {
+    return os;
   }
-  os << std::endl;
-  for (const IdfObject& object : m_objects){
-    object.print(os);
+
+  // objects are formatted into one buffer per chunk, then chunks are written in order
+  const unsigned objectsPerChunk = 256;
+  unsigned numChunks = static_cast<unsigned>((m_objects.size() + objectsPerChunk - 1) / objectsPerChunk);
+  std::vector<std::string> chunks(numChunks);
+
+  auto printChunk = [&](unsigned chunk) {
+    std::ostringstream ss;
+    unsigned begin = chunk * objectsPerChunk;
+    unsigned end = std::min<unsigned>(begin + objectsPerChunk, static_cast<unsigned>(m_objects.size()));
+    for (unsigned i = begin; i < end; ++i) {
+      m_objects[i].print(ss);
+    }
+    chunks[chunk] = ss.str();
+  };
+
+  if (numThreads == 0) {
+    numThreads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  numThreads = std::min(numThreads, numChunks);
+
+  if (numThreads < 2) {
+    for (unsigned chunk = 0; chunk < numChunks; ++chunk) {
+      printChunk(chunk);
+    }
+  }
+  else {
+    std::atomic<unsigned> nextChunk(0);
+    auto worker = [&]() {
+      for (unsigned chunk = nextChunk++; chunk < numChunks; chunk = nextChunk++) {
+        printChunk(chunk);
+      }
+    };
+
+    std::vector<std::thread> threads;
+    for (unsigned t = 1; t < numThreads; ++t) {
+      threads.emplace_back(worker);
+    }
+    worker();
+    for (auto& thread : threads) {
+      thread.join();
+    }
+  }
+
+  for (const std::string& chunk : chunks) {
+    os.write(chunk.data(), chunk.size());
   }
   return os;
 }
@@ -511,7 +574,11 @@ bool IdfFile::save(const openstudio::path& p, bool overwrite) {
     openstudio::filesystem::ofstream outFile(wp);
     if (outFile) {
       try {
-        print(outFile);
+        // format the whole file in memory so it goes to disk in a single write
+        std::ostringstream ss;
+        print(ss);
+        std::string text = ss.str();
+        outFile.write(text.data(), text.size());
         outFile.close();
         return true;
       }
@@ -527,6 +594,417 @@ bool IdfFile::save(const openstudio::path& p, bool overwrite) {
   return false;
 }
 
+namespace {
+
+  // Snapshot layout, all integers little endian:
+  //
+  //   magic "OSSNAP", uint16 format version, uint8 compressed flag, uint64 payload size
+  //   payload, zlib compressed if flagged:
+  //     string iddFileType, string header
+  //     uint32 number of object types, then each type name
+  //     uint32 number of objects, then each handle as 16 raw bytes
+  //     per object: uint32 type index, string comment, uint32 number of fields, fields,
+  //                 uint32 number of field comments, field comments
+  //
+  // A string is a uint32 length followed by its bytes. A field whose text is the handle of an
+  // object in the file is stored as uint32 (pointerFlag | object index) instead of as a string.
+
+  const char snapshotMagic[] = {'O','S','S','N','A','P'};
+  const uint16_t snapshotVersion = 1;
+  const uint32_t snapshotPointerFlag = 0x80000000u;
+
+  class SnapshotWriter {
+   public:
+    void writeUInt8(uint8_t value) {
+      m_buffer.push_back(static_cast<char>(value));
+    }
+
+    void writeUInt32(uint32_t value) {
+      for (unsigned i = 0; i < 4; ++i) {
+        m_buffer.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+      }
+    }
+
+    void writeUInt64(uint64_t value) {
+      for (unsigned i = 0; i < 8; ++i) {
+        m_buffer.push_back(static_cast<char>((value >> (8 * i)) & 0xFF));
+      }
+    }
+
+    void writeString(const std::string& value) {
+      writeUInt32(static_cast<uint32_t>(value.size()));
+      m_buffer.append(value);
+    }
+
+    void writeHandle(const Handle& handle) {
+      for (unsigned char byte : handle) {
+        m_buffer.push_back(static_cast<char>(byte));
+      }
+    }
+
+    std::string& buffer() {
+      return m_buffer;
+    }
+
+   private:
+    std::string m_buffer;
+  };
+
+  // throws on reading past the end of the buffer
+  class SnapshotReader {
+   public:
+    SnapshotReader(const char* data, size_t size)
+      : m_data(data), m_size(size), m_pos(0)
+    {}
+
+    uint8_t readUInt8() {
+      require(1);
+      return static_cast<uint8_t>(m_data[m_pos++]);
+    }
+
+    uint32_t readUInt32() {
+      require(4);
+      uint32_t result = 0;
+      for (unsigned i = 0; i < 4; ++i) {
+        result |= static_cast<uint32_t>(static_cast<unsigned char>(m_data[m_pos++])) << (8 * i);
+      }
+      return result;
+    }
+
+    uint64_t readUInt64() {
+      require(8);
+      uint64_t result = 0;
+      for (unsigned i = 0; i < 8; ++i) {
+        result |= static_cast<uint64_t>(static_cast<unsigned char>(m_data[m_pos++])) << (8 * i);
+      }
+      return result;
+    }
+
+    std::string readString() {
+      return readString(readUInt32());
+    }
+
+    std::string readString(uint32_t size) {
+      require(size);
+      std::string result(m_data + m_pos, size);
+      m_pos += size;
+      return result;
+    }
+
+    Handle readHandle() {
+      require(16);
+      Handle result;
+      for (unsigned char& byte : result) {
+        byte = static_cast<unsigned char>(m_data[m_pos++]);
+      }
+      return result;
+    }
+
+    bool atEnd() const {
+      return m_pos == m_size;
+    }
+
+   private:
+    void require(size_t n) const {
+      if (m_size - m_pos < n) {
+        throw std::runtime_error("Unexpected end of snapshot data.");
+      }
+    }
+
+    const char* m_data;
+    size_t m_size;
+    size_t m_pos;
+  };
+
+}
+
+boost::optional<IdfFile> IdfFile::loadSnapshot(const path& p) {
+  return m_loadSnapshot(p, nullptr);
+}
+
+boost::optional<IdfFile> IdfFile::loadSnapshot(const path& p, std::vector<UHPointer>& pointers) {
+  pointers.clear();
+  return m_loadSnapshot(p, &pointers);
+}
+
+boost::optional<IdfFile> IdfFile::m_loadSnapshot(const path& p, std::vector<UHPointer>* pointers) {
+  openstudio::filesystem::ifstream inFile(p, std::ios_base::binary);
+  if (!inFile) {
+    LOG(Error,"Unable to open snapshot file '" << toString(p) << "'.");
+    return boost::none;
+  }
+  std::string data((std::istreambuf_iterator<char>(inFile)), std::istreambuf_iterator<char>());
+  inFile.close();
+
+  try {
+    SnapshotReader preamble(data.data(), data.size());
+    if (preamble.readString(sizeof(snapshotMagic)) != std::string(snapshotMagic, sizeof(snapshotMagic))) {
+      LOG(Error,"File '" << toString(p) << "' is not an IdfFile snapshot.");
+      return boost::none;
+    }
+    uint16_t version = static_cast<uint16_t>(preamble.readUInt8());
+    version |= static_cast<uint16_t>(preamble.readUInt8()) << 8;
+    if (version != snapshotVersion) {
+      LOG(Error,"Snapshot file '" << toString(p) << "' has unsupported format version " << version << ".");
+      return boost::none;
+    }
+    bool compressed = (preamble.readUInt8() != 0);
+    uint64_t payloadSize = preamble.readUInt64();
+    size_t offset = sizeof(snapshotMagic) + 2 + 1 + 8;
+
+    std::string uncompressed;
+    const char* payload = data.data() + offset;
+    if (compressed) {
+      uncompressed.resize(payloadSize);
+      uLongf destLen = static_cast<uLongf>(payloadSize);
+      int rc = uncompress(reinterpret_cast<Bytef*>(&uncompressed[0]), &destLen,
+                          reinterpret_cast<const Bytef*>(payload), static_cast<uLong>(data.size() - offset));
+      if ((rc != Z_OK) || (destLen != payloadSize)) {
+        LOG(Error,"Unable to decompress snapshot file '" << toString(p) << "'.");
+        return boost::none;
+      }
+      payload = uncompressed.data();
+    }
+    else if (data.size() - offset != payloadSize) {
+      LOG(Error,"Snapshot file '" << toString(p) << "' is truncated.");
+      return boost::none;
+    }
+
+    SnapshotReader reader(payload, payloadSize);
+
+    IdfFile result(IddFileType(reader.readString()));
+    if (OptionalIdfObject vo = result.versionObject()) {
+      result.removeObject(*vo);
+    }
+    result.m_header = reader.readString();
+
+    // resolve each object type once
+    std::vector<IddObject> iddObjects;
+    for (uint32_t i = 0, n = reader.readUInt32(); i < n; ++i) {
+      std::string name = reader.readString();
+      if (OptionalIddObject iddObject = result.m_iddFileAndFactoryWrapper.getObject(name)) {
+        iddObjects.push_back(*iddObject);
+      }
+      else if (name == IddObject().name()) {
+        iddObjects.push_back(IddObject());
+      }
+      else {
+        LOG(Error,"Snapshot file '" << toString(p) << "' contains object type '" << name
+            << "', which is not in the IddFile.");
+        return boost::none;
+      }
+    }
+
+    uint32_t numObjects = reader.readUInt32();
+    std::vector<Handle> handles;
+    handles.reserve(numObjects);
+    for (uint32_t i = 0; i < numObjects; ++i) {
+      handles.push_back(reader.readHandle());
+    }
+    std::vector<std::string> handleStrings(numObjects);
+
+    // object-list fields per object type, only needed when returning pointers
+    std::vector<std::vector<bool> > isObjectListField;
+    if (pointers) {
+      for (const IddObject& iddObject : iddObjects) {
+        std::vector<bool> flags;
+        for (unsigned index : iddObject.objectListFields()) {
+          if (index >= flags.size()) {
+            flags.resize(index + 1, false);
+          }
+          flags[index] = true;
+        }
+        isObjectListField.push_back(flags);
+      }
+    }
+    // pointers by position in the file, renumbered to the Workspace order below
+    std::vector<UHPointer> filePointers;
+
+    result.m_objects.reserve(numObjects);
+    for (uint32_t i = 0; i < numObjects; ++i) {
+      uint32_t typeIndex = reader.readUInt32();
+      if (typeIndex >= iddObjects.size()) {
+        throw std::runtime_error("Invalid object type index.");
+      }
+      std::string comment = reader.readString();
+
+      StringVector fields(reader.readUInt32());
+      for (unsigned index = 0, n = static_cast<unsigned>(fields.size()); index < n; ++index) {
+        std::string& field = fields[index];
+        uint32_t tag = reader.readUInt32();
+        if (tag & snapshotPointerFlag) {
+          uint32_t target = tag & ~snapshotPointerFlag;
+          if (target >= numObjects) {
+            throw std::runtime_error("Invalid pointer index.");
+          }
+          if (pointers && (index < isObjectListField[typeIndex].size()) && isObjectListField[typeIndex][index]) {
+            filePointers.push_back(UHPointer(i, index, handles[target]));
+            continue;
+          }
+          if (handleStrings[target].empty()) {
+            handleStrings[target] = toString(handles[target]);
+          }
+          field = handleStrings[target];
+        }
+        else {
+          field = reader.readString(tag);
+        }
+      }
+
+      StringVector fieldComments(reader.readUInt32());
+      for (std::string& fieldComment : fieldComments) {
+        fieldComment = reader.readString();
+      }
+
+      std::shared_ptr<detail::IdfObject_Impl> impl(new detail::IdfObject_Impl(
+          handles[i], comment, iddObjects[typeIndex], fields, fieldComments));
+      result.addObject(IdfObject(impl));
+    }
+
+    if (!reader.atEnd()) {
+      LOG(Error,"Snapshot file '" << toString(p) << "' has unexpected trailing data.");
+      return boost::none;
+    }
+
+    if (pointers) {
+      // Workspace(IdfFile) adds the version object first, then the other objects in order
+      std::vector<int> workspaceIndices(numObjects, -1);
+      int n = 0;
+      if (result.m_versionObjectIndices.size() == 1u) {
+        workspaceIndices[*(result.m_versionObjectIndices.begin())] = n++;
+      }
+      for (uint32_t i = 0; i < numObjects; ++i) {
+        if (result.m_versionObjectIndices.find(i) == result.m_versionObjectIndices.end()) {
+          workspaceIndices[i] = n++;
+        }
+      }
+      pointers->reserve(filePointers.size());
+      for (const UHPointer& filePointer : filePointers) {
+        if (workspaceIndices[filePointer.source] >= 0) {
+          pointers->push_back(UHPointer(static_cast<unsigned>(workspaceIndices[filePointer.source]),
+                                        filePointer.fieldIndex,
+                                        filePointer.target));
+        }
+      }
+    }
+
+    return result;
+  }
+  catch (const std::exception& e) {
+    LOG(Error,"Unable to read snapshot file '" << toString(p) << "': " << e.what());
+  }
+  return boost::none;
+}
+
+bool IdfFile::saveSnapshot(const openstudio::path& p, bool overwrite, bool compress) const {
+  IddFileType iddFileType = m_iddFileAndFactoryWrapper.iddFileType();
+  if (iddFileType == IddFileType::UserCustom) {
+    LOG(Error,"Snapshots can only be saved for IdfFiles that use an IddFactory IddFile.");
+    return false;
+  }
+
+  if (!overwrite && openstudio::filesystem::exists(p)) {
+    LOG(Info,"SaveSnapshot method failed because instructed not to overwrite path '"
+      << toString(p) << "'.");
+    return false;
+  }
+
+  SnapshotWriter writer;
+  writer.writeString(iddFileType.valueName());
+  writer.writeString(m_header);
+
+  // intern object types by name so snapshots do not depend on IddObjectType values
+  std::vector<uint32_t> typeIndices;
+  typeIndices.reserve(m_objects.size());
+  std::map<std::string, uint32_t> typeMap;
+  std::vector<std::string> typeNames;
+  for (const IdfObject& object : m_objects) {
+    std::string name = object.iddObject().name();
+    auto it = typeMap.find(name);
+    if (it == typeMap.end()) {
+      it = typeMap.insert(std::make_pair(name, static_cast<uint32_t>(typeNames.size()))).first;
+      typeNames.push_back(name);
+    }
+    typeIndices.push_back(it->second);
+  }
+  writer.writeUInt32(static_cast<uint32_t>(typeNames.size()));
+  for (const std::string& name : typeNames) {
+    writer.writeString(name);
+  }
+
+  // handle table, fields that hold a handle are written as an index into it
+  std::unordered_map<std::string, uint32_t> handleIndices;
+  writer.writeUInt32(static_cast<uint32_t>(m_objects.size()));
+  for (uint32_t i = 0, n = static_cast<uint32_t>(m_objects.size()); i < n; ++i) {
+    Handle handle = m_objects[i].handle();
+    writer.writeHandle(handle);
+    handleIndices.insert(std::make_pair(toString(handle), i));
+  }
+
+  for (uint32_t i = 0, n = static_cast<uint32_t>(m_objects.size()); i < n; ++i) {
+    const IdfObject& object = m_objects[i];
+    writer.writeUInt32(typeIndices[i]);
+    writer.writeString(object.comment());
+
+    std::shared_ptr<detail::IdfObject_Impl> impl = object.getImpl<detail::IdfObject_Impl>();
+    const StringVector& fields = impl->m_fields;
+    writer.writeUInt32(static_cast<uint32_t>(fields.size()));
+    for (const std::string& field : fields) {
+      auto it = handleIndices.find(field);
+      if (it != handleIndices.end()) {
+        writer.writeUInt32(snapshotPointerFlag | it->second);
+      }
+      else {
+        writer.writeString(field);
+      }
+    }
+
+    const StringVector& fieldComments = impl->m_fieldComments;
+    writer.writeUInt32(static_cast<uint32_t>(fieldComments.size()));
+    for (const std::string& fieldComment : fieldComments) {
+      writer.writeString(fieldComment);
+    }
+  }
+
+  std::string& payload = writer.buffer();
+  std::string compressed;
+  if (compress) {
+    uLongf destLen = compressBound(static_cast<uLong>(payload.size()));
+    compressed.resize(destLen);
+    int rc = compress2(reinterpret_cast<Bytef*>(&compressed[0]), &destLen,
+                       reinterpret_cast<const Bytef*>(payload.data()), static_cast<uLong>(payload.size()),
+                       Z_BEST_SPEED);
+    if (rc != Z_OK) {
+      LOG(Error,"Unable to compress snapshot for path '" << toString(p) << "'.");
+      return false;
+    }
+    compressed.resize(destLen);
+  }
+
+  SnapshotWriter preamble;
+  preamble.buffer().append(snapshotMagic, sizeof(snapshotMagic));
+  preamble.writeUInt8(static_cast<uint8_t>(snapshotVersion & 0xFF));
+  preamble.writeUInt8(static_cast<uint8_t>(snapshotVersion >> 8));
+  preamble.writeUInt8(compress ? 1 : 0);
+  preamble.writeUInt64(payload.size());
+
+  if (makeParentFolder(p)) {
+    openstudio::filesystem::ofstream outFile(p, std::ios_base::binary);
+    if (outFile) {
+      const std::string& body = compress ? compressed : payload;
+      outFile.write(preamble.buffer().data(), preamble.buffer().size());
+      outFile.write(body.data(), body.size());
+      outFile.close();
+      if (outFile) {
+        return true;
+      }
+    }
+  }
+
+  LOG(Error,"Unable to write snapshot to path '" << toString(p) << "'.");
+  return false;
+}
+
 // PRIVATE
 
 // SERIALIZATION
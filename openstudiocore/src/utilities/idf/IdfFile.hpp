@@ -33,6 +33,7 @@
 
 #include "../idd/IddFileAndFactoryWrapper.hpp"
 #include "IdfObject.hpp"
+#include "ObjectPointer.hpp"
 
 #include "../core/Path.hpp"
 
@@ -212,12 +213,34 @@ class UTILITIES_API IdfFile {
   /** Print this file to std::ostream os. */
   std::ostream& print(std::ostream& os) const;
 
+  /** Print this file to std::ostream os, formatting objects on up to numThreads threads. Output
+   *  is identical to the single threaded case. If numThreads == 0, the number of hardware threads
+   *  is used. */
+  std::ostream& print(std::ostream& os, unsigned numThreads) const;
+
   /** Save this file to path p. Will construct the parent folder if necessary and if its parent
    *  folder already exists. Will only overwrite an existing file if overwrite==true. If no
    *  extension is provided will use modelFileExtension() for files using IddFileType::OpenStudio,
    *  and 'idf' otherwise. Returns true if the save operation is successful; false otherwise. */
   bool save(const openstudio::path& p, bool overwrite=false);
 
+  /** Load an IdfFile from a binary snapshot written by saveSnapshot. Snapshots skip text parsing
+   *  and are meant for passing files between steps of a workflow, not for long term storage. */
+  static boost::optional<IdfFile> loadSnapshot(const path& p);
+
+  /** Load an IdfFile from a binary snapshot, leaving its object-list pointer fields empty and
+   *  returning them in pointers instead, already resolved to target handles. Each source is the
+   *  index of an object in the order Workspace(IdfFile) adds them (version object first), so the
+   *  pointers can be set without parsing handle strings. Used by Workspace::loadSnapshot and
+   *  Model::loadSnapshot. */
+  static boost::optional<IdfFile> loadSnapshot(const path& p, std::vector<UHPointer>& pointers);
+
+  /** Save this file to path p as a binary snapshot, optionally zlib compressed. Loading the
+   *  snapshot gives back a file that prints exactly like this one. Only files that use an
+   *  IddFactory IddFile (not IddFileType::UserCustom) can be saved this way. Will only overwrite
+   *  an existing file if overwrite==true. */
+  bool saveSnapshot(const openstudio::path& p, bool overwrite=false, bool compress=true) const;
+
   //@}
 
  protected:
@@ -246,6 +269,9 @@ class UTILITIES_API IdfFile {
   /// private load function that uses m_iddFile and m_iddFileType initialized elsewhere
   bool m_load(std::istream& is, ProgressBar* progressBar=nullptr, bool versionOnly=false);
 
+  /// private snapshot load function, returns object-list pointers in pointers if not null
+  static boost::optional<IdfFile> m_loadSnapshot(const path& p, std::vector<UHPointer>* pointers);
+
   // configure logging
   REGISTER_LOGGER("utilities.idf.IdfFile");
 };
@@ -1315,7 +1315,7 @@ namespace detail {
       }
     }
 
-    os << std::endl;
+    os << '\n';
 
     return os;
   }
@@ -1323,22 +1323,24 @@ namespace detail {
   std::ostream& IdfObject_Impl::printName(std::ostream& os, bool hasFields) const {
     // print comment, if any
     if (!m_comment.empty()){
-      os << m_comment << std::endl;
+      os << m_comment << '\n';
     }
 
     // if this is a comment only object, return
     // todo, tighten up handling of comments with comment only object type
-    if (boost::iequals(m_iddObject.name(), iddRegex::commentOnlyObjectName()) ){
+    const std::string& objectName = m_iddObject.name();
+    const std::string& commentOnlyName = iddRegex::commentOnlyObjectName();
+    if ((objectName.size() == commentOnlyName.size()) && boost::iequals(objectName, commentOnlyName)){
       return os;
     }
 
-    os << m_iddObject.name();
+    os << objectName;
 
     if (hasFields) {
-      os << "," << std::endl;
+      os << ",\n";
     }
     else {
-      os << ";" << std::endl;
+      os << ";\n";
     }
       
     return os;
@@ -1352,10 +1354,8 @@ namespace detail {
       // different formatting for vertices
       if ((m_iddObject.properties().format == "vertices") && (m_iddObject.isExtensibleField(index))) {
         ExtensibleIndex eIndex = m_iddObject.extensibleIndex(index);
-        static int textWidth(0);
         if (eIndex.field == 0) {
           os << "  ";
-          textWidth = 0;
         }
         else {
           os << " ";
@@ -1369,9 +1369,13 @@ namespace detail {
         else {
           os << ",";
         }
-        textWidth += m_fields[index].size();
         // comment
         if (eIndex.field == m_iddObject.properties().numExtensible - 1) {
+          // width of all values in this vertex, computed here so printing keeps no state between calls
+          int textWidth = 0;
+          for (unsigned i = index - eIndex.field; i <= index; ++i) {
+            textWidth += m_fields[i].size();
+          }
           int numSpaces = IdfObject::printedFieldSpace() - textWidth - 4;
           if (numSpaces > 0) {
             os << std::setw(numSpaces) << " ";
@@ -1381,7 +1385,7 @@ namespace detail {
           if (OptionalString units = iddField.properties().units) {
             os << " {" << *units << "}";
           }
-          os << std::endl;
+          os << '\n';
         }
       }
       else {
@@ -1399,7 +1403,7 @@ namespace detail {
         if (numSpaces > 0) {
           os << std::setw(numSpaces) << " ";
         }
-        os << " " << fieldComment(index,true) << std::endl;
+        os << " " << fieldComment(index,true) << '\n';
       }
     } // if index < numFields()
     return os;
@@ -1433,6 +1437,8 @@ namespace detail {
       }
     }
 
+    this->onLocalChange.nano_emit();
+
     if (nameChange){
       this->onNameChange.nano_emit();
     }
@@ -48,6 +48,7 @@ namespace openstudio{
 class IddObject;
 struct IddObjectType;
 class IdfExtensibleGroup;
+class IdfFile;
 class ValidityReport;
 class DataError;
 class StrictnessLevel;
@@ -418,6 +419,7 @@ class UTILITIES_API IdfObject {
   friend class detail::Workspace_Impl;       // for finding IdfObjects in a workspace
   friend class WorkspaceObject;              // for WorkspaceObject::idfObject()
   friend class Workspace;                    // for toIdfFile completion (constructs IdfObject from impl)
+  friend class IdfFile;                      // for loadSnapshot (constructs IdfObject from impl)
 
   /** Protected constructor from impl. */
   IdfObject(std::shared_ptr<detail::IdfObject_Impl> impl);
@@ -50,6 +50,7 @@ namespace openstudio {
 
 // forward declarations
 class IdfObject;
+class IdfFile;
 class IdfExtensibleGroup;
 struct IdfObjectImplLess;
 class StrictnessLevel;
@@ -384,6 +385,10 @@ namespace detail {
     // Emitted on any change--any field, any comment.
     Nano::Signal<void()> onChange;
 
+    // Emitted on any change before the other change signals, and immediately even while a
+    // WorkspaceChangeBatch defers them. For clearing caches local to the object.
+    Nano::Signal<void()> onLocalChange;
+
     // Emitted if name field changed.
     Nano::Signal<void()> onNameChange;
 
@@ -394,6 +399,7 @@ namespace detail {
    protected:
 
     friend class openstudio::IdfObject;
+    friend class openstudio::IdfFile; // snapshots store raw fields and field comments
 
     // handle
     Handle m_handle;
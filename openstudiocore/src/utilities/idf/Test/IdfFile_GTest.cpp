@@ -84,6 +84,74 @@ TEST_F(IdfFixture, IdfFile_BasicTests_LoadedFile)
   LOG(Info, "IdfFile written to idf text in " << writeTime << "s. Please check diff by hand.");
 }
 
+TEST_F(IdfFixture, IdfFile_ParallelPrint)
+{
+  // reference text, printed object by object
+  std::stringstream expected;
+  if (!epIdfFile.header().empty()) {
+    expected << epIdfFile.header() << std::endl;
+  }
+  expected << std::endl;
+  // getObject indexes all objects, including the version object
+  for (unsigned i = 0; OptionalIdfObject object = epIdfFile.getObject(i); ++i) {
+    object->print(expected);
+  }
+
+  for (unsigned numThreads : {1u, 2u, 4u, 0u}) {
+    std::stringstream ss;
+    openstudio::Time start = openstudio::Time::currentTime();
+    epIdfFile.print(ss,numThreads);
+    openstudio::Time printTime = openstudio::Time::currentTime() - start;
+    LOG(Info, "IdfFile printed on " << numThreads << " threads in " << printTime << "s.");
+    EXPECT_EQ(expected.str(),ss.str());
+  }
+
+  std::stringstream ss;
+  ss << epIdfFile;
+  EXPECT_EQ(expected.str(),ss.str());
+}
+
+TEST_F(IdfFixture, IdfFile_Snapshot)
+{
+  std::stringstream expected;
+  epIdfFile.print(expected);
+
+  openstudio::path textPath = outDir/toPath("Snapshot.idf");
+  ASSERT_TRUE(epIdfFile.save(textPath,true));
+  openstudio::Time start = openstudio::Time::currentTime();
+  OptionalIdfFile textFile = IdfFile::load(textPath);
+  openstudio::Time textLoadTime = openstudio::Time::currentTime() - start;
+  ASSERT_TRUE(textFile);
+  LOG(Info, "IdfFile loaded from idf text in " << textLoadTime << "s.");
+
+  for (bool compress : {true, false}) {
+    openstudio::path snapshotPath = outDir/toPath(compress ? "Snapshot_compressed.snap" : "Snapshot.snap");
+    start = openstudio::Time::currentTime();
+    EXPECT_TRUE(epIdfFile.saveSnapshot(snapshotPath,true,compress));
+    openstudio::Time saveTime = openstudio::Time::currentTime() - start;
+    EXPECT_FALSE(epIdfFile.saveSnapshot(snapshotPath,false,compress));
+
+    start = openstudio::Time::currentTime();
+    OptionalIdfFile snapshotFile = IdfFile::loadSnapshot(snapshotPath);
+    openstudio::Time loadTime = openstudio::Time::currentTime() - start;
+    ASSERT_TRUE(snapshotFile);
+    LOG(Info, "IdfFile snapshot (compress = " << compress << ") saved in " << saveTime
+        << "s, loaded in " << loadTime << "s.");
+
+    EXPECT_EQ(epIdfFile.iddFileType(),snapshotFile->iddFileType());
+    EXPECT_EQ(epIdfFile.header(),snapshotFile->header());
+    ASSERT_EQ(epIdfFile.numObjects(),snapshotFile->numObjects());
+    EXPECT_EQ(epIdfFile.objects().front().handle(),snapshotFile->objects().front().handle());
+
+    std::stringstream ss;
+    snapshotFile->print(ss);
+    EXPECT_EQ(expected.str(),ss.str());
+  }
+
+  // text files are not snapshots
+  EXPECT_FALSE(IdfFile::loadSnapshot(textPath));
+}
+
 TEST_F(IdfFixture, IdfFile_Header) {
   std::stringstream ss;
   OptionalIdfFile oFile = IdfFile::load(ss,IddFileType(IddFileType::EnergyPlus));
@@ -37,6 +37,9 @@
 #include <utilities/idd/IddEnums.hxx>
 
 
+#include "../../time/Time.hpp"
+#include "../../core/String.hpp"
+
 #include <resources.hxx>
 
 using namespace std;
@@ -213,3 +216,104 @@ TEST_F(IdfFixture,WorkspaceObjectWatcher_RelationshipFieldChanges_TargetDeleted)
   EXPECT_FALSE(watcher.nameChanged());
   EXPECT_TRUE(watcher.relationshipChanged());
 }
+
+class CountingWorkspaceObjectWatcher : public WorkspaceObjectWatcher {
+ public:
+  CountingWorkspaceObjectWatcher(const WorkspaceObject& workspaceObject)
+    : WorkspaceObjectWatcher(workspaceObject), numChanges(0), numDataChanges(0), numRelationshipChanges(0)
+  {}
+
+  virtual void onChangeIdfObject() override { ++numChanges; }
+  virtual void onDataFieldChange() override { ++numDataChanges; }
+  virtual void onRelationshipChange(int index, Handle newHandle, Handle oldHandle) override {
+    ++numRelationshipChanges;
+    lastNewHandle = newHandle;
+    lastOldHandle = oldHandle;
+  }
+
+  unsigned numChanges;
+  unsigned numDataChanges;
+  unsigned numRelationshipChanges;
+  Handle lastNewHandle;
+  Handle lastOldHandle;
+};
+
+TEST_F(IdfFixture,WorkspaceObjectWatcher_ChangeBatch)
+{
+  Workspace workspace(StrictnessLevel::Draft, IddFileType::EnergyPlus);
+  OptionalWorkspaceObject owo = workspace.addObject(IdfObject(IddObjectType::Lights));
+  ASSERT_TRUE(owo);
+  WorkspaceObject lights = *owo;
+  OptionalWorkspaceObject zone1 = workspace.addObject(IdfObject(IddObjectType::Zone));
+  OptionalWorkspaceObject zone2 = workspace.addObject(IdfObject(IddObjectType::Zone));
+  ASSERT_TRUE(zone1);
+  ASSERT_TRUE(zone2);
+  CountingWorkspaceObjectWatcher watcher(lights);
+
+  {
+    WorkspaceChangeBatch batch(workspace);
+    EXPECT_TRUE(workspace.isBatchingChanges());
+    for (unsigned i = 0; i < 100; ++i) {
+      EXPECT_TRUE(lights.setString(LightsFields::LightingLevel, toString(double(i))));
+    }
+    EXPECT_TRUE(lights.setPointer(LightsFields::ZoneorZoneListName, zone1->handle()));
+    EXPECT_TRUE(lights.setPointer(LightsFields::ZoneorZoneListName, zone2->handle()));
+    lights.setComment("! Batched");
+
+    // nothing emitted yet
+    EXPECT_FALSE(watcher.dirty());
+    EXPECT_EQ(0u, watcher.numChanges);
+
+    // edits are visible immediately
+    EXPECT_EQ(zone2->handle(), lights.getTarget(LightsFields::ZoneorZoneListName)->handle());
+  }
+
+  EXPECT_FALSE(workspace.isBatchingChanges());
+  EXPECT_TRUE(watcher.dirty());
+  EXPECT_TRUE(watcher.dataChanged());
+  EXPECT_TRUE(watcher.relationshipChanged());
+  EXPECT_EQ(1u, watcher.numChanges);
+  EXPECT_EQ(1u, watcher.numDataChanges);
+  EXPECT_EQ(1u, watcher.numRelationshipChanges);
+  EXPECT_EQ(zone2->handle(), watcher.lastNewHandle);
+  EXPECT_TRUE(watcher.lastOldHandle.isNull());
+  watcher.clearState();
+  watcher.numChanges = 0;
+
+  // setting a field back to its original value emits nothing
+  std::string level = lights.getString(LightsFields::LightingLevel).get();
+  {
+    WorkspaceChangeBatch batch(workspace);
+    {
+      // nested batches emit when the outermost ends
+      WorkspaceChangeBatch nested(workspace);
+      EXPECT_TRUE(lights.setString(LightsFields::LightingLevel, "1000"));
+    }
+    EXPECT_EQ(0u, watcher.numChanges);
+    EXPECT_TRUE(lights.setString(LightsFields::LightingLevel, level));
+  }
+  EXPECT_FALSE(watcher.dirty());
+  EXPECT_EQ(0u, watcher.numChanges);
+
+  // timing of bulk edits with and without a batch
+  const unsigned n = 10000;
+  openstudio::Time start = openstudio::Time::currentTime();
+  for (unsigned i = 0; i < n; ++i) {
+    lights.setString(LightsFields::LightingLevel, toString(double(i)));
+  }
+  openstudio::Time unbatchedTime = openstudio::Time::currentTime() - start;
+  EXPECT_EQ(n, watcher.numChanges);
+
+  watcher.numChanges = 0;
+  start = openstudio::Time::currentTime();
+  {
+    WorkspaceChangeBatch batch(workspace);
+    for (unsigned i = 0; i < n; ++i) {
+      lights.setString(LightsFields::LightingLevel, toString(double(n + i)));
+    }
+  }
+  openstudio::Time batchedTime = openstudio::Time::currentTime() - start;
+  EXPECT_EQ(1u, watcher.numChanges);
+  LOG(Info, n << " edits under a watcher took " << unbatchedTime << "s, and " << batchedTime
+      << "s in a change batch.");
+}
@@ -284,6 +284,111 @@ TEST_F(IdfFixture, Workspace_FollowingPointers) {
   }
 }
 
+TEST_F(IdfFixture, Workspace_SourcesByType) {
+  Workspace workspace(epIdfFile);
+  Workspace clone = workspace.clone(true);
+
+  for (const Workspace& ws : {workspace, clone}) {
+    for (const WorkspaceObject& zone : ws.getObjectsByType(IddObjectType::Zone)) {
+      WorkspaceObjectVector sources = zone.sources();
+      EXPECT_LE(sources.size(), zone.numSources());
+
+      // each source appears once
+      HandleVector handles = getHandles(sources);
+      std::sort(handles.begin(), handles.end());
+      EXPECT_TRUE(std::unique(handles.begin(), handles.end()) == handles.end());
+
+      // typed query matches filtering sources
+      WorkspaceObjectVector lights = zone.getSources(IddObjectType::Lights);
+      WorkspaceObjectVector filtered;
+      for (const WorkspaceObject& source : sources) {
+        EXPECT_TRUE(source.workspace() == ws);
+        if (source.iddObject().type() == IddObjectType::Lights) {
+          filtered.push_back(source);
+        }
+      }
+      EXPECT_EQ(getHandles(filtered), getHandles(lights));
+    }
+  }
+
+  // removing a source updates the typed query
+  WorkspaceObject light = workspace.getObjectsByType(IddObjectType::Lights)[0];
+  WorkspaceObject zone = light.getTarget(LightsFields::ZoneorZoneListName).get();
+  unsigned numLights = zone.getSources(IddObjectType::Lights).size();
+  ASSERT_GT(numLights, 0u);
+  EXPECT_TRUE(workspace.removeObject(light.handle()));
+  EXPECT_EQ(numLights - 1, zone.getSources(IddObjectType::Lights).size());
+
+  // clone is unaffected
+  OptionalWorkspaceObject clonedZone = clone.getObject(zone.handle());
+  ASSERT_TRUE(clonedZone);
+  EXPECT_EQ(numLights, clonedZone->getSources(IddObjectType::Lights).size());
+
+  // timing of typed source queries
+  WorkspaceObjectVector zones = workspace.getObjectsByType(IddObjectType::Zone);
+  openstudio::Time start = openstudio::Time::currentTime();
+  unsigned n = 0;
+  for (unsigned i = 0; i < 1000; ++i) {
+    for (const WorkspaceObject& z : zones) {
+      n += z.getSources(IddObjectType::Lights).size();
+      n += z.sources().size();
+    }
+  }
+  openstudio::Time queryTime = openstudio::Time::currentTime() - start;
+  EXPECT_GT(n, 0u);
+  LOG(Info, "Queried sources of " << zones.size() << " zones 1000 times in " << queryTime << "s.");
+}
+
+TEST_F(IdfFixture, Workspace_Freeze) {
+  Workspace workspace(epIdfFile);
+  unsigned numObjects = workspace.numObjects();
+  WorkspaceObject light = workspace.getObjectsByType(IddObjectType::Lights)[0];
+  WorkspaceObject zone = light.getTarget(LightsFields::ZoneorZoneListName).get();
+  std::string lightName = light.name().get();
+  unsigned numLights = zone.getSources(IddObjectType::Lights).size();
+
+  EXPECT_FALSE(workspace.isFrozen());
+  EXPECT_TRUE(workspace.freeze());
+  EXPECT_TRUE(workspace.isFrozen());
+  EXPECT_TRUE(workspace.freeze());
+
+  // getters still work
+  EXPECT_EQ(numObjects, workspace.numObjects());
+  EXPECT_EQ(numLights, zone.getSources(IddObjectType::Lights).size());
+  EXPECT_EQ(zone.handle(), light.getTarget(LightsFields::ZoneorZoneListName)->handle());
+
+  // setters, additions and removals fail
+  EXPECT_FALSE(light.setName("Frozen Light"));
+  EXPECT_FALSE(light.setString(LightsFields::DesignLevelCalculationMethod, "Watts/Area"));
+  EXPECT_FALSE(light.setPointer(LightsFields::ZoneorZoneListName, Handle()));
+  EXPECT_FALSE(workspace.addObject(IdfObject(IddObjectType::Zone)));
+  EXPECT_FALSE(workspace.removeObject(light.handle()));
+  EXPECT_TRUE(light.remove().empty());
+  EXPECT_FALSE(workspace.setStrictnessLevel(StrictnessLevel::None));
+  EXPECT_EQ(lightName, light.name().get());
+  EXPECT_EQ(numObjects, workspace.numObjects());
+  EXPECT_EQ(zone.handle(), light.getTarget(LightsFields::ZoneorZoneListName)->handle());
+
+  // clones are not frozen
+  Workspace clone = workspace.clone();
+  EXPECT_FALSE(clone.isFrozen());
+  EXPECT_TRUE(clone.addObject(IdfObject(IddObjectType::Zone)));
+
+  // cannot freeze with an open change batch
+  workspace.unfreeze();
+  EXPECT_FALSE(workspace.isFrozen());
+  {
+    WorkspaceChangeBatch batch(workspace);
+    EXPECT_FALSE(workspace.freeze());
+    EXPECT_FALSE(workspace.isFrozen());
+  }
+
+  // writable again
+  EXPECT_TRUE(light.setName("Thawed Light"));
+  EXPECT_TRUE(workspace.removeObject(light.handle()));
+  EXPECT_EQ(numLights - 1, zone.getSources(IddObjectType::Lights).size());
+}
+
 // This test mimics the creation of a budget building. In particular, it blindly changes out
 // all lights objects and their schedules.
 //
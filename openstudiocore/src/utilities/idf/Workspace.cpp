@@ -68,6 +68,10 @@ namespace detail {
       m_strictnessLevel(level),
       m_iddFileAndFactoryWrapper(iddFileType),
       m_fastNaming(false),
+      m_changeBatchDepth(0),
+      m_emittingChangeBatch(false),
+      m_changedInBatch(false),
+      m_frozen(false),
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
           WorkspaceObjectOrder_Impl(HandleVector(),std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
   {}
@@ -78,6 +82,10 @@ namespace detail {
       m_header(idfFile.header()),
       m_iddFileAndFactoryWrapper(idfFile.iddFileAndFactoryWrapper()),
       m_fastNaming(false),
+      m_changeBatchDepth(0),
+      m_emittingChangeBatch(false),
+      m_changedInBatch(false),
+      m_frozen(false),
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
           WorkspaceObjectOrder_Impl(HandleVector(),std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
   {}
@@ -87,6 +95,10 @@ namespace detail {
     m_header(other.m_header),
     m_iddFileAndFactoryWrapper(other.m_iddFileAndFactoryWrapper),
     m_fastNaming(other.fastNaming()),
+    m_changeBatchDepth(0),
+    m_emittingChangeBatch(false),
+    m_changedInBatch(false),
+    m_frozen(false),
     m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
           WorkspaceObjectOrder_Impl(std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
   {
@@ -109,6 +121,10 @@ namespace detail {
       m_header(), // subset of original data--discard header
       m_iddFileAndFactoryWrapper(other.m_iddFileAndFactoryWrapper),
       m_fastNaming(other.fastNaming()),
+      m_changeBatchDepth(0),
+      m_emittingChangeBatch(false),
+      m_changedInBatch(false),
+      m_frozen(false),
       m_workspaceObjectOrder(std::shared_ptr<WorkspaceObjectOrder_Impl>(new
           WorkspaceObjectOrder_Impl(hs,std::bind(&Workspace_Impl::getObject,this,std::placeholders::_1))))
   {
@@ -154,6 +170,11 @@ namespace detail {
   void Workspace_Impl::swap(Workspace& other) {
     std::shared_ptr<Workspace_Impl> otherImpl = other.getImpl<Workspace_Impl>();
 
+    if (m_frozen || otherImpl->m_frozen) {
+      LOG(Warn,"Cannot swap the contents of a frozen Workspace.");
+      return;
+    }
+
     StrictnessLevel tsl = m_strictnessLevel;
     m_strictnessLevel = otherImpl->m_strictnessLevel;
     otherImpl->m_strictnessLevel = tsl;
@@ -376,6 +397,12 @@ namespace detail {
     return result;
   }
 
+  boost::optional<WorkspaceObject> Workspace_Impl::getAnyObjectOfType(IddObjectType objectType) const {
+    auto loc = m_iddObjectTypeMap.find(objectType);
+    if ((loc == m_iddObjectTypeMap.end()) || loc->second.empty()) { return boost::none; }
+    return WorkspaceObject(loc->second.begin()->second);
+  }
+
   std::vector<WorkspaceObject> Workspace_Impl::getObjectsByType(const IddObject& objectType) const {
     WorkspaceObjectVector result;
     for (const WorkspaceObject& object : objects()) {
@@ -386,6 +413,18 @@ namespace detail {
     return result;
   }
 
+  std::vector<IddObjectType> Workspace_Impl::objectTypes() const {
+    std::vector<IddObjectType> result;
+    OptionalIddObject versionIdd = m_iddFileAndFactoryWrapper.versionObject();
+    if (!versionIdd) { return result; }
+    for (const IddObjectTypeMap::value_type& p : m_iddObjectTypeMap) {
+      if (!p.second.empty() && (p.first != versionIdd->type())) {
+        result.push_back(p.first);
+      }
+    }
+    return result;
+  }
+
   boost::optional<WorkspaceObject> Workspace_Impl::getObjectByTypeAndName(
       IddObjectType objectType,const std::string& name) const
   {
@@ -463,9 +502,23 @@ namespace detail {
     return m_fastNaming;
   }
 
+  bool Workspace_Impl::isBatchingChanges() const
+  {
+    return (m_changeBatchDepth > 0);
+  }
+
+  bool Workspace_Impl::isFrozen() const
+  {
+    return m_frozen;
+  }
+
   // SETTERS
 
   bool Workspace_Impl::setStrictnessLevel(StrictnessLevel level) {
+    if (m_frozen) {
+      LOG(Warn,"Cannot change the strictness level of a frozen Workspace.");
+      return false;
+    }
     if (isValid(level)) {
       m_strictnessLevel = level;
       return true;
@@ -496,11 +549,17 @@ namespace detail {
       const std::vector<UHPointer>& pointersIntoWorkspace,
       const std::vector<HUPointer>& pointersFromWorkspace,
       bool driverMethod,
-      bool expectToLosePointers)
+      bool expectToLosePointers,
+      const std::vector<UHPointer>& resolvedPointers)
   {
     HandleVector newHandles;
     WorkspaceObjectVector newObjects;
 
+    if (m_frozen) {
+      LOG(Warn,"Cannot add objects to a frozen Workspace.");
+      return newObjects;
+    }
+
     int i = 0;
     int N = objectImplPtrs.size();
     this->progressRange.nano_emit(0, 3*N);
@@ -521,10 +580,19 @@ namespace detail {
       this->progressValue.nano_emit(++i);
     }
 
-    // step 2: replace string pointers
+    // step 2: replace string pointers, resolvedPointers (source is index into objectImplPtrs)
+    // are set directly
     if (ok){
-      for (WorkspaceObject_ImplPtr& ptr : objectImplPtrs) {
-        ptr->initializeOnAdd(expectToLosePointers);
+      std::vector<ForwardPointerSet> resolved(resolvedPointers.empty() ? 0u : objectImplPtrs.size());
+      for (const UHPointer& resolvedPointer : resolvedPointers) {
+        OS_ASSERT(resolvedPointer.source < resolved.size());
+        resolved[resolvedPointer.source].insert(ForwardPointer(resolvedPointer.fieldIndex,
+                                                               resolvedPointer.target));
+      }
+      const ForwardPointerSet noResolvedPointers;
+      for (int j = 0; j < N; ++j) {
+        objectImplPtrs[j]->initializeOnAdd(expectToLosePointers,
+                                           resolved.empty() ? noResolvedPointers : resolved[j]);
         this->progressValue.nano_emit(++i);
       }
     }
@@ -591,6 +659,11 @@ namespace detail {
       const std::vector<HUPointer>& pointersFromWorkspace,
       bool driverMethod)
   {
+    if (m_frozen) {
+      LOG(Warn,"Cannot add objects to a frozen Workspace.");
+      return WorkspaceObjectVector();
+    }
+
     int i = 0;
     int N = objectImplPtrs.size();
     if (oldNewHandleMap.empty()) {
@@ -1306,6 +1379,11 @@ namespace detail {
 
   bool Workspace_Impl::swap(WorkspaceObject& currentObject,IdfObject& newObject,bool keepTargets)
   {
+    if (m_frozen) {
+      LOG(Warn,"Cannot swap objects in a frozen Workspace.");
+      return false;
+    }
+
     // make sure currentObject is in workspace
     if (!isMember(currentObject.handle())) {
       LOG(Info,"Unable to swap objects because WorkspaceObject is not in this Workspace.");
@@ -1488,6 +1566,11 @@ namespace detail {
 
   bool Workspace_Impl::removeObject(const Handle& handle) {
 
+    if (m_frozen) {
+      LOG(Warn,"Cannot remove objects from a frozen Workspace.");
+      return false;
+    }
+
     OptionalSavedWorkspaceObject objectData = savedWorkspaceObject(handle);
     if (!objectData) {
       return true;
@@ -1518,6 +1601,11 @@ namespace detail {
 
     if (handles.empty()) { return true; }
 
+    if (m_frozen) {
+      LOG(Warn,"Cannot remove objects from a frozen Workspace.");
+      return false;
+    }
+
     SavedWorkspaceObjectVector objectData;
     for (const Handle& handle : handles) {
       OptionalSavedWorkspaceObject candidate = savedWorkspaceObject(handle);
@@ -1618,6 +1706,69 @@ namespace detail {
     m_fastNaming = fastNaming;
   }
 
+  void Workspace_Impl::beginChangeBatch()
+  {
+    ++m_changeBatchDepth;
+  }
+
+  void Workspace_Impl::endChangeBatch()
+  {
+    if (m_changeBatchDepth == 0) {
+      LOG(Warn,"endChangeBatch called without a matching beginChangeBatch.");
+      return;
+    }
+    if (--m_changeBatchDepth > 0) {
+      return;
+    }
+
+    // objects emit once each, the workspace once for all of them
+    std::vector<std::weak_ptr<WorkspaceObject_Impl> > objects;
+    objects.swap(m_changeBatchObjects);
+    m_emittingChangeBatch = true;
+    m_changedInBatch = false;
+    for (const std::weak_ptr<WorkspaceObject_Impl>& object : objects) {
+      if (std::shared_ptr<WorkspaceObject_Impl> ptr = object.lock()) {
+        ptr->emitChangeSignals();
+      }
+    }
+    m_emittingChangeBatch = false;
+    if (m_changedInBatch) {
+      m_changedInBatch = false;
+      this->onChange.nano_emit();
+    }
+  }
+
+  void Workspace_Impl::deferChangeSignals(const std::shared_ptr<WorkspaceObject_Impl>& object)
+  {
+    OS_ASSERT(m_changeBatchDepth > 0);
+    m_changeBatchObjects.push_back(object);
+  }
+
+  bool Workspace_Impl::freeze()
+  {
+    if (m_frozen) {
+      return true;
+    }
+    if (m_changeBatchDepth > 0) {
+      LOG(Warn,"Cannot freeze a Workspace while a change batch is open.");
+      return false;
+    }
+
+    // fill state that getters otherwise compute lazily, so concurrent readers only read
+    m_iddFileAndFactoryWrapper.versionObject();
+    for (const WorkspaceObjectMap::value_type& p : m_workspaceObjectMap) {
+      p.second->resolveSources();
+    }
+
+    m_frozen = true;
+    return true;
+  }
+
+  void Workspace_Impl::unfreeze()
+  {
+    m_frozen = false;
+  }
+
   // OBJECT ORDER
 
   WorkspaceObjectOrder Workspace_Impl::order() {
@@ -2648,6 +2799,10 @@ namespace detail {
   }
 
   void Workspace_Impl::change() {
+    if (m_emittingChangeBatch) {
+      m_changedInBatch = true;
+      return;
+    }
     this->onChange.nano_emit();
   }
 
@@ -2730,7 +2885,13 @@ Workspace::Workspace(StrictnessLevel level, IddFileType iddFileType) :
   addVersionObject();
 }
 
-Workspace::Workspace(const IdfFile& idfFile, StrictnessLevel level) :
+Workspace::Workspace(const IdfFile& idfFile, StrictnessLevel level)
+  : Workspace(idfFile,level,UHPointerVector())
+{}
+
+Workspace::Workspace(const IdfFile& idfFile,
+                     StrictnessLevel level,
+                     const std::vector<UHPointer>& resolvedPointers) :
     m_impl(new detail::Workspace_Impl(idfFile,level))
 {
   // construct WorkspaceObject_ImplPtrs
@@ -2742,7 +2903,7 @@ Workspace::Workspace(const IdfFile& idfFile, StrictnessLevel level) :
     objectImplPtrs.push_back(m_impl->createObject(idfObject,true));
   }
   // add Object_ImplPtrs to Workspace_Impl
-  m_impl->addObjects(objectImplPtrs);
+  m_impl->addObjects(objectImplPtrs,UHPointerVector(),HUPointerVector(),true,false,resolvedPointers);
   Workspace copyOfThis(m_impl);
   m_impl->resolvePotentialNameConflicts(copyOfThis);
 }
@@ -2875,6 +3036,16 @@ bool Workspace::fastNaming() const
   return m_impl->fastNaming();
 }
 
+bool Workspace::isBatchingChanges() const
+{
+  return m_impl->isBatchingChanges();
+}
+
+bool Workspace::isFrozen() const
+{
+  return m_impl->isFrozen();
+}
+
 // SETTERS
 
 bool Workspace::setStrictnessLevel(StrictnessLevel level) {
@@ -2942,6 +3113,26 @@ void Workspace::setFastNaming(bool fastNaming)
   m_impl->setFastNaming(fastNaming);
 }
 
+void Workspace::beginChangeBatch()
+{
+  m_impl->beginChangeBatch();
+}
+
+void Workspace::endChangeBatch()
+{
+  m_impl->endChangeBatch();
+}
+
+bool Workspace::freeze()
+{
+  return m_impl->freeze();
+}
+
+void Workspace::unfreeze()
+{
+  m_impl->unfreeze();
+}
+
 // ORDER
 
 WorkspaceObjectOrder Workspace::order() {
@@ -3049,6 +3240,20 @@ bool Workspace::save(const openstudio::path& p, bool overwrite) {
   return m_impl->save(p,overwrite);
 }
 
+bool Workspace::saveSnapshot(const openstudio::path& p, bool overwrite, bool compress) const {
+  return toIdfFile().saveSnapshot(p,overwrite,compress);
+}
+
+boost::optional<Workspace> Workspace::loadSnapshot(const openstudio::path& p) {
+  // pointers come back as handles from the snapshot's table, not as text to look up
+  UHPointerVector pointers;
+  OptionalIdfFile oIdfFile = IdfFile::loadSnapshot(p,pointers);
+  if (oIdfFile) {
+    return Workspace(*oIdfFile,StrictnessLevel::None,pointers);
+  }
+  return boost::none;
+}
+
 boost::optional<Workspace> Workspace::load(const openstudio::path& p) {
   OptionalIdfFile oIdfFile = IdfFile::load(p);
   if (oIdfFile) {
@@ -3110,6 +3315,17 @@ void Workspace::addVersionObject() {
   }
 }
 
+WorkspaceChangeBatch::WorkspaceChangeBatch(const Workspace& workspace)
+  : m_workspace(workspace)
+{
+  m_workspace.beginChangeBatch();
+}
+
+WorkspaceChangeBatch::~WorkspaceChangeBatch()
+{
+  m_workspace.endChangeBatch();
+}
+
 std::ostream& operator<<(std::ostream& os, const Workspace& workspace)
 {
   os << workspace.toIdfFile();
@@ -32,6 +32,7 @@
 #include "../UtilitiesAPI.hpp"
 #include "ValidityEnums.hpp"
 #include "Handle.hpp"
+#include "ObjectPointer.hpp"
 
 #include "../core/Logger.hpp"
 #include "../core/Path.hpp"
@@ -232,6 +233,12 @@ class UTILITIES_API Workspace {
    *  objects and does not do any name conflict checking. */
   bool fastNaming() const;
 
+  /** Returns true if a WorkspaceChangeBatch is active on this Workspace. */
+  bool isBatchingChanges() const;
+
+  /** Returns true if the Workspace is frozen. See freeze(). */
+  bool isFrozen() const;
+
   //@}
   /** @name Setters */
   //@{
@@ -341,6 +348,24 @@ class UTILITIES_API Workspace {
    *  handle. */
   void setFastNaming(bool fastNaming);
 
+  /** Start a change batch. Prefer WorkspaceChangeBatch, which ends the batch on scope exit. */
+  void beginChangeBatch();
+
+  /** End a change batch started with beginChangeBatch. */
+  void endChangeBatch();
+
+  /** Freeze the Workspace for concurrent reads. Lazily computed state (in a Model, for instance,
+   *  cached surface geometry, loop membership and unique object lookups) is filled up front, and
+   *  from then on adding, removing or swapping objects and setting fields, names or pointers fail
+   *  and log a warning. While frozen, const getters of the Workspace and its objects may be called
+   *  from any number of threads at once without locking. Comments, signal connections and getters
+   *  that create objects on demand (e.g. Model::getUniqueModelObject) are not covered. Returns
+   *  false, and does not freeze, if a change batch is open. */
+  bool freeze();
+
+  /** Make a frozen Workspace writable again. Only call this once all reader threads are done. */
+  void unfreeze();
+
   //@}
   /** @name Object Order */
   //@{
@@ -429,6 +454,12 @@ class UTILITIES_API Workspace {
   static boost::optional<Workspace> load(const openstudio::path& p,
                                          const IddFile& iddFile);
 
+  /** Save this Workspace to path p as a binary snapshot. See IdfFile::saveSnapshot. */
+  bool saveSnapshot(const openstudio::path& p, bool overwrite=false, bool compress=true) const;
+
+  /** Load a Workspace from a binary snapshot written by saveSnapshot. */
+  static boost::optional<Workspace> loadSnapshot(const openstudio::path& p);
+
   /** Returns an IdfFile equivalent to this Workspace. If the objects have handle fields (as in the
    *  OpenStudio IDD), pointers between objects are serialized as handles, otherwise they are
    *  serialized as names. */
@@ -496,6 +527,13 @@ class UTILITIES_API Workspace {
   /** Protected constructor from impl. */
   Workspace(std::shared_ptr<detail::Workspace_Impl> impl);
 
+  /** Construct from idfFile, setting resolvedPointers directly instead of looking up the text in
+   *  those fields. Sources index the objects in the order they are added (version object first).
+   *  See IdfFile::loadSnapshot. */
+  Workspace(const IdfFile& idfFile,
+            StrictnessLevel level,
+            const std::vector<UHPointer>& resolvedPointers);
+
   /** Returns all objects, including the versionObject. Protected in public class. */
   std::vector<WorkspaceObject> allObjects() const;
 
@@ -510,6 +548,28 @@ class UTILITIES_API Workspace {
   std::shared_ptr<detail::Workspace_Impl> m_impl;
 };
 
+/** WorkspaceChangeBatch defers object change signals in a Workspace for its lifetime. While a
+ *  batch is active, edits to WorkspaceObjects do not emit onChange, onDataChange, onNameChange or
+ *  onRelationshipChange. Instead, each object keeps a change log with one entry per edited field.
+ *  When the outermost batch ends, each edited object emits its signals once, with
+ *  onRelationshipChange giving the first old and last new target of each field. Fields set back
+ *  to their original value emit nothing. The Workspace emits onChange once for the whole batch.
+ *  Objects still emit onLocalChange on every edit, so caches local to an object stay current;
+ *  other listeners, such as watchers, are not told about changes until the batch ends. Batches
+ *  may be nested. */
+class UTILITIES_API WorkspaceChangeBatch {
+ public:
+  explicit WorkspaceChangeBatch(const Workspace& workspace);
+
+  ~WorkspaceChangeBatch();
+
+  WorkspaceChangeBatch(const WorkspaceChangeBatch& other) = delete;
+  WorkspaceChangeBatch& operator=(const WorkspaceChangeBatch& other) = delete;
+
+ private:
+  Workspace m_workspace;
+};
+
 /** \relates Workspace */
 typedef boost::optional<Workspace> OptionalWorkspace;
 
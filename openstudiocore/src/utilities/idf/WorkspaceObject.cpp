@@ -50,6 +50,7 @@
 #include <boost/lexical_cast.hpp>
 #include <boost/regex.hpp>
 
+#include <algorithm>
 #include <iostream>
 using namespace std;
 
@@ -67,7 +68,8 @@ namespace detail {
                                              bool keepHandle)
     : IdfObject_Impl(*(idfObject.getImpl<detail::IdfObject_Impl>()),keepHandle),  // clones idfObject data
       m_initialized(false),
-      m_workspace(workspace)
+      m_workspace(workspace),
+      m_changeSignalsDeferred(false)
   {
     if (!m_iddObject.objectLists().empty()) {
       // can nominally be source
@@ -85,22 +87,37 @@ namespace detail {
     IdfObject_Impl(other, keepHandle),
     m_initialized(false),
     m_workspace(workspace),
+    m_changeSignalsDeferred(false),
     m_sourceData(other.m_sourceData),
     m_targetData(other.m_targetData)
-  {}
+  {
+    // cached sources belong to other's workspace
+    if (m_targetData) {
+      for (auto& typeSources : m_targetData->sourcesByType) {
+        for (SourceReferenceMap::value_type& p : typeSources.second) {
+          p.second.source.reset();
+        }
+      }
+    }
+  }
 
   WorkspaceObject_Impl::~WorkspaceObject_Impl() {}
 
   std::vector<IdfObject> WorkspaceObject_Impl::remove()
   {
     std::vector<IdfObject> result;
+    if (refuseIfFrozen()) {
+      return result;
+    }
     result.push_back(this->idfObject());
     bool ok = this->workspace().removeObject(this->handle());
     OS_ASSERT(ok);
     return result;
   }
 
-  void WorkspaceObject_Impl::initializeOnAdd(bool expectToLosePointers) {
+  void WorkspaceObject_Impl::initializeOnAdd(bool expectToLosePointers,
+                                             const ForwardPointerSet& resolvedPointers)
+  {
     OS_ASSERT(m_workspace);
     bool ptrsAsHandles = iddObject().hasHandleField();
     // loop through object list fields
@@ -110,6 +127,15 @@ namespace detail {
       OptionalIddField iddField = iddObject().getField(index);
       OS_ASSERT(iddField);
 
+      // target already resolved, e.g. by a snapshot
+      if (!resolvedPointers.empty()) {
+        auto resolvedIt = resolvedPointers.find(ForwardPointer(index,Handle()));
+        if ((resolvedIt != resolvedPointers.end()) && workspace().isMember(resolvedIt->targetHandle)) {
+          setPointerImpl(index,resolvedIt->targetHandle);
+          continue;
+        }
+      }
+
       // for each one, try to match targetName
       std::string targetName = IdfObject_Impl::getString(index).get();
       if (targetName.empty()) { // set null pointer
@@ -160,7 +186,7 @@ namespace detail {
           OptionalWorkspaceObject target = workspace().getObject(fp.targetHandle);
           if (target) {
             // need to set reverse pointer
-            target->getImpl<WorkspaceObject_Impl>()->setReversePointer(handle(),fp.fieldIndex);
+            target->getImpl<WorkspaceObject_Impl>()->setReversePointer(*this,fp.fieldIndex);
             th = fp.targetHandle;
           }
         }
@@ -180,6 +206,17 @@ namespace detail {
         }
       }
       m_targetData->reversePointers = mappedPointers;
+
+      std::map<int,SourceReferenceMap> mappedSources;
+      for (const auto& typeSources : m_targetData->sourcesByType) {
+        for (const SourceReferenceMap::value_type& p : typeSources.second) {
+          Handle sh = openstudio::applyHandleMap(p.first,oldNewHandleMap);
+          if (!sh.isNull()) {
+            mappedSources[typeSources.first][sh].numPointers = p.second.numPointers;
+          }
+        }
+      }
+      m_targetData->sourcesByType = mappedSources;
     }
   }
 
@@ -275,14 +312,12 @@ namespace detail {
     WorkspaceObjectVector result;
     if (!initialized()) { return result; }
     if (m_targetData) {
-      for (const ReversePointer& ptr : m_targetData->reversePointers) {
-        OS_ASSERT(!ptr.sourceHandle.isNull());
-        OptionalWorkspaceObject owo = this->workspace().getObject(ptr.sourceHandle);
-        OS_ASSERT(owo);
-        result.push_back(*owo);
+      // each source appears once, however many of its fields point here
+      for (const auto& typeSources : m_targetData->sourcesByType) {
+        for (const SourceReferenceMap::value_type& p : typeSources.second) {
+          result.push_back(WorkspaceObject(getSource(p.first,p.second)));
+        }
       }
-      std::sort(result.begin(), result.end());
-      result.erase(std::unique(result.begin(), result.end()), result.end());
     }
     return result;
   }
@@ -291,14 +326,13 @@ namespace detail {
     WorkspaceObjectVector result;
     if (!initialized()) { return result; }
     if (m_targetData) {
-      for (const ReversePointer& ptr : m_targetData->reversePointers) {
-        OS_ASSERT(!ptr.sourceHandle.isNull());
-        OptionalWorkspaceObject owo = this->workspace().getObject(ptr.sourceHandle);
-        OS_ASSERT(owo);
-        if (owo->iddObject().type() == type) { result.push_back(*owo); }
+      auto it = m_targetData->sourcesByType.find(type.value());
+      if (it != m_targetData->sourcesByType.end()) {
+        result.reserve(it->second.size());
+        for (const SourceReferenceMap::value_type& p : it->second) {
+          result.push_back(WorkspaceObject(getSource(p.first,p.second)));
+        }
       }
-      std::sort(result.begin(), result.end());
-      result.erase(std::unique(result.begin(), result.end()), result.end());
     }
     return result;
   }
@@ -323,7 +357,7 @@ namespace detail {
   boost::optional<std::string> WorkspaceObject_Impl::setName(const std::string& newName,
                                                              bool checkValidity)
   {
-    if (m_handle.isNull()) {
+    if (m_handle.isNull() || refuseIfFrozen()) {
       return boost::none;
     }
     StrictnessLevel level = m_workspace->strictnessLevel();
@@ -395,7 +429,7 @@ namespace detail {
   // Pre-condition:  Object valid at Workspace's strictness level.
   bool WorkspaceObject_Impl::setString(unsigned index, const std::string& value, bool checkValidity)
   {
-    if (m_handle.isNull()) { return false; }
+    if (m_handle.isNull() || refuseIfFrozen()) { return false; }
     StrictnessLevel level = m_workspace->strictnessLevel();
 
     if (canBeSource(index)) {
@@ -479,7 +513,7 @@ namespace detail {
                                         const Handle& targetHandle,
                                         bool checkValidity)
   {
-    if (m_handle.isNull()) {
+    if (m_handle.isNull() || refuseIfFrozen()) {
       return false;
     }
 
@@ -580,7 +614,7 @@ namespace detail {
   }
 
   bool WorkspaceObject_Impl::pushString(const std::string& value, bool checkValidity) {
-    if (m_handle.isNull()) {
+    if (m_handle.isNull() || refuseIfFrozen()) {
       return false;
     }
 
@@ -623,7 +657,7 @@ namespace detail {
   }
 
   bool WorkspaceObject_Impl::pushPointer(const Handle& targetHandle, bool checkValidity) {
-    if (m_handle.isNull()) {
+    if (m_handle.isNull() || refuseIfFrozen()) {
       return false;
     }
 
@@ -661,6 +695,9 @@ namespace detail {
 
   std::vector<std::string> WorkspaceObject_Impl::popExtensibleGroup(bool checkValidity) {
     StringVector result;
+    if (refuseIfFrozen()) {
+      return result;
+    }
     if (!initialized()) {
       UnsignedVector olFields = iddObject().objectListFields();
       if (!olFields.empty() && iddObject().isExtensibleField(olFields.back())) {
@@ -916,6 +953,31 @@ namespace detail {
       return;
     }
 
+    if (m_workspace && m_workspace->isBatchingChanges()) {
+      // local caches are cleared now, only notification is deferred
+      this->onLocalChange.nano_emit();
+      if (!m_changeSignalsDeferred) {
+        m_changeSignalsDeferred = true;
+        m_workspace->deferChangeSignals(std::static_pointer_cast<WorkspaceObject_Impl>(shared_from_this()));
+      }
+      // keep the change log at about one diff per field
+      if (m_diffs.size() > 2 * numFields() + 8) {
+        compactDiffs();
+      }
+      return;
+    }
+
+    if (m_changeSignalsDeferred) {
+      // onLocalChange was emitted with each edit in the batch
+      m_changeSignalsDeferred = false;
+      compactDiffs();
+      if (m_diffs.empty()) {
+        return;
+      }
+    } else {
+      this->onLocalChange.nano_emit();
+    }
+
     bool nameChange = false;
     bool dataChange = false;
 
@@ -988,7 +1050,7 @@ namespace detail {
     OptionalWorkspaceObject oTarget = getTarget(index);
     if (oTarget) {
       WorkspaceObject target = *oTarget;
-      target.getImpl<WorkspaceObject_Impl>()->nullifyReversePointer(m_handle,index);
+      target.getImpl<WorkspaceObject_Impl>()->nullifyReversePointer(*this,index);
       // remove forwarded reference if no other source sets the same
       m_workspace->removeForwardedReferences(handle(),index,target);
     }
@@ -1005,24 +1067,39 @@ namespace detail {
   // Pre-condition:  Object sourceHandle points to this object from field index.
   // Post-condition: That information is removed from this object's m_targetData (in preparation for
   //                 a change to the source pointer).
-  void WorkspaceObject_Impl::nullifyReversePointer(const Handle& sourceHandle,unsigned index) {
+  void WorkspaceObject_Impl::nullifyReversePointer(const WorkspaceObject_Impl& source,unsigned index) {
     OS_ASSERT(!m_handle.isNull());
     OS_ASSERT(m_targetData);
-    auto it = m_targetData->reversePointers.find(ReversePointer(sourceHandle,index));
+    auto it = m_targetData->reversePointers.find(ReversePointer(source.m_handle,index));
     OS_ASSERT(it != m_targetData->reversePointers.end());
     m_targetData->reversePointers.erase(it);
+
+    auto typeIt = m_targetData->sourcesByType.find(source.m_iddObject.type().value());
+    OS_ASSERT(typeIt != m_targetData->sourcesByType.end());
+    auto sourceIt = typeIt->second.find(source.m_handle);
+    OS_ASSERT(sourceIt != typeIt->second.end());
+    if (--sourceIt->second.numPointers == 0) {
+      typeIt->second.erase(sourceIt);
+      if (typeIt->second.empty()) {
+        m_targetData->sourcesByType.erase(typeIt);
+      }
+    }
   }
 
   // Pre-condition:  ReversePointer(sourceHandle,index) is not in m_targetData.
   // Post-condition: m_targetData indicates that object sourceHandle points to this object from
   //                 field index.
-  void WorkspaceObject_Impl::setReversePointer(const Handle& sourceHandle, unsigned index) {
+  void WorkspaceObject_Impl::setReversePointer(WorkspaceObject_Impl& source, unsigned index) {
     OS_ASSERT(!m_handle.isNull());
     if (!m_targetData) { m_targetData = TargetData(); }
     // automatically maintains uniqueness
     std::pair<TargetData::pointer_set::iterator,bool> insertResult;
-    insertResult = m_targetData->reversePointers.insert(ReversePointer(sourceHandle,index));
+    insertResult = m_targetData->reversePointers.insert(ReversePointer(source.m_handle,index));
     OS_ASSERT(insertResult.second);
+
+    SourceReference& sourceReference = m_targetData->sourcesByType[source.m_iddObject.type().value()][source.m_handle];
+    sourceReference.source = std::static_pointer_cast<WorkspaceObject_Impl>(source.shared_from_this());
+    ++sourceReference.numPointers;
   }
 
   void WorkspaceObject_Impl::restorePointers() {
@@ -1035,7 +1112,7 @@ namespace detail {
             WorkspaceObjectVector sources = target->getSources(iddObject().type());
             HandleVector h = getHandles<WorkspaceObject>(sources);
             if (std::find(h.begin(),h.end(),m_handle) == h.end()) {
-              target->getImpl<WorkspaceObject_Impl>()->setReversePointer(m_handle,ptr.fieldIndex);
+              target->getImpl<WorkspaceObject_Impl>()->setReversePointer(*this,ptr.fieldIndex);
             }
           }
         }
@@ -1090,7 +1167,7 @@ namespace detail {
     if (!targetHandle.isNull()) {
       OptionalWorkspaceObject target = m_workspace->getObject(targetHandle);
       OS_ASSERT(target);
-      target->getImpl<WorkspaceObject_Impl>()->setReversePointer(m_handle,index);
+      target->getImpl<WorkspaceObject_Impl>()->setReversePointer(*this,index);
       // forward references if is object-list and defines references simultaneously
       m_workspace->forwardReferences(m_handle,index,targetHandle);
     }
@@ -1123,6 +1200,96 @@ namespace detail {
     return boost::none;
   }
 
+  std::shared_ptr<WorkspaceObject_Impl> WorkspaceObject_Impl::getSource(
+      const Handle& sourceHandle,
+      const SourceReference& sourceReference) const
+  {
+    std::shared_ptr<WorkspaceObject_Impl> result = sourceReference.source.lock();
+    if (!result) {
+      OptionalWorkspaceObject owo = m_workspace->getObject(sourceHandle);
+      OS_ASSERT(owo);
+      result = owo->getImpl<WorkspaceObject_Impl>();
+      sourceReference.source = result;
+    }
+    return result;
+  }
+
+  bool WorkspaceObject_Impl::refuseIfFrozen() const
+  {
+    if (m_workspace && m_workspace->isFrozen()) {
+      LOG(Warn,"Cannot modify " << briefDescription() << " because its Workspace is frozen.");
+      return true;
+    }
+    return false;
+  }
+
+  void WorkspaceObject_Impl::resolveSources() const
+  {
+    if (m_targetData) {
+      for (const auto& typeSources : m_targetData->sourcesByType) {
+        for (const SourceReferenceMap::value_type& p : typeSources.second) {
+          getSource(p.first,p.second);
+        }
+      }
+    }
+  }
+
+  void WorkspaceObject_Impl::compactDiffs() {
+    auto unchanged = [](const IdfObjectDiff& diff) {
+      if (!diff.isNull()) {
+        return false;
+      }
+      if (boost::optional<WorkspaceObjectDiff> pointerDiff = diff.optionalCast<WorkspaceObjectDiff>()) {
+        return (pointerDiff->oldHandle() == pointerDiff->newHandle());
+      }
+      return true;
+    };
+
+    std::vector<IdfObjectDiff> result;
+    std::map<unsigned, unsigned> fieldPositions;
+    bool objectChange = false;
+
+    for (const IdfObjectDiff& diff : m_diffs) {
+      boost::optional<unsigned> index = diff.index();
+      if (!index || unchanged(diff)) {
+        // comment or field comment change, only reported through onChange
+        objectChange = true;
+        continue;
+      }
+
+      auto it = fieldPositions.find(*index);
+      if (it == fieldPositions.end()) {
+        fieldPositions.insert(std::make_pair(*index, static_cast<unsigned>(result.size())));
+        result.push_back(diff);
+        continue;
+      }
+
+      // merge with the first diff of this field
+      IdfObjectDiff& first = result[it->second];
+      boost::optional<WorkspaceObjectDiff> firstPointerDiff = first.optionalCast<WorkspaceObjectDiff>();
+      boost::optional<WorkspaceObjectDiff> pointerDiff = diff.optionalCast<WorkspaceObjectDiff>();
+      if (firstPointerDiff || pointerDiff) {
+        boost::optional<UUID> oldHandle;
+        boost::optional<UUID> newHandle;
+        if (firstPointerDiff) { oldHandle = firstPointerDiff->oldHandle(); }
+        if (pointerDiff) { newHandle = pointerDiff->newHandle(); }
+        first = WorkspaceObjectDiff(*index, first.oldValue(), diff.newValue(), oldHandle, newHandle);
+      }
+      else {
+        first = IdfObjectDiff(*index, first.oldValue(), diff.newValue());
+      }
+    }
+
+    // drop fields that are back where they started
+    result.erase(std::remove_if(result.begin(), result.end(), unchanged), result.end());
+
+    if (objectChange) {
+      result.push_back(IdfObjectDiff(boost::none, boost::none, boost::none));
+    }
+
+    m_diffs = result;
+  }
+
   void WorkspaceObject_Impl::restoreOriginalNumFields(unsigned n) {
     bool popResult = true;
     while (popResult && (numFields() > n)) {
@@ -35,6 +35,9 @@
 #include <utilities/idf/IdfObject_Impl.hpp>
 #include <utilities/idf/ObjectPointer.hpp>
 
+#include <map>
+#include <memory>
+
 namespace openstudio {
 
 // forward declarations
@@ -85,11 +88,26 @@ namespace detail {
   };
   typedef std::set<ReversePointer,ReversePointerLess > ReversePointerSet;
 
+  class WorkspaceObject_Impl;
+
+  /** Reference from a target back to one of its sources. source is a cache that is filled in on
+   *  use and cleared when objects are cloned, the handle it is stored under is authoritative. */
+  struct UTILITIES_API SourceReference {
+    mutable std::weak_ptr<WorkspaceObject_Impl> source;
+    unsigned numPointers;
+
+    SourceReference() : numPointers(0) {}
+  };
+  typedef std::map<Handle,SourceReference> SourceReferenceMap;
+
   struct UTILITIES_API TargetData {
     typedef ReversePointer    pointer_type;
     typedef ReversePointerSet pointer_set;
 
     pointer_set reversePointers;
+
+    /// sources grouped by IddObjectType value, for getSources(IddObjectType)
+    std::map<int,SourceReferenceMap> sourcesByType;
   };
   typedef boost::optional<TargetData> OptionalTargetData;
 
@@ -126,8 +144,10 @@ namespace detail {
      *  handles. */
     WorkspaceObject_Impl(const WorkspaceObject_Impl& other, Workspace_Impl* workspace, bool keepHandle=false);
 
-    /** Complete construction process by pointing to workspace and replacing name pointers. */
-    virtual void initializeOnAdd(bool expectToLosePointers = false);
+    /** Complete construction process by pointing to workspace and replacing name pointers.
+     *  Fields in resolvedPointers already know their target and are set without a lookup. */
+    virtual void initializeOnAdd(bool expectToLosePointers = false,
+                                 const ForwardPointerSet& resolvedPointers = ForwardPointerSet());
 
     /** Complete copy construction process by updating pointer handles. */
     virtual void initializeOnClone(const HandleMap& oldNewHandleMap);
@@ -312,10 +332,10 @@ namespace detail {
     /** Mechanics only exposed to Workspace_Impl for use in object removal. */
     void nullifyPointer(unsigned index);
 
-    void nullifyReversePointer(const Handle& sourceHandle, unsigned index);
+    void nullifyReversePointer(const WorkspaceObject_Impl& source, unsigned index);
 
 
-    void setReversePointer(const Handle& sourceHandle, unsigned index);
+    void setReversePointer(WorkspaceObject_Impl& source, unsigned index);
 
     /** Called when restoring object because could not remove and retain validity. Double-checks
      *  that companion pointers are in place. May not be able to fix all if multiple objects are
@@ -323,6 +343,10 @@ namespace detail {
      *  objects. */
     void restorePointers();
 
+    /** Caches every source object so that later getSources calls only read. Called by
+     *  Workspace_Impl::freeze. */
+    void resolveSources() const;
+
     // QUERY HELPERS
 
     virtual void populateValidityReport(ValidityReport& report,bool checkNames) const override;
@@ -341,6 +365,7 @@ namespace detail {
 
     bool                m_initialized;
     Workspace_Impl*     m_workspace;
+    bool                m_changeSignalsDeferred;
     OptionalSourceData  m_sourceData;
     OptionalTargetData  m_targetData;
 
@@ -355,6 +380,17 @@ namespace detail {
 
     void restoreOriginalNumFields(unsigned n);
 
+    /** Merges m_diffs to one diff per field, from the first old value to the last new value.
+     *  Fields that end up unchanged are dropped. */
+    void compactDiffs();
+
+    /** Returns true, after logging a warning, if this object's workspace is frozen. */
+    bool refuseIfFrozen() const;
+
+    /** Returns the object stored in sourceReference, looking it up by handle if it is not cached. */
+    std::shared_ptr<WorkspaceObject_Impl> getSource(const Handle& sourceHandle,
+                                                    const SourceReference& sourceReference) const;
+
     bool popField();
 
     // configure logging
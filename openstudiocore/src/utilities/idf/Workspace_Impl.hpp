@@ -184,6 +184,10 @@ namespace detail {
     /// get all idf objects by full idd type
     std::vector<WorkspaceObject> getObjectsByType(const IddObject& objectType) const;
 
+    /** Returns the IddObjectTypes of the objects returned by objects(), i.e. every type with at
+     *  least one object other than the version object. */
+    std::vector<IddObjectType> objectTypes() const;
+
     /** Returns the first object found of type objectType and named name (case insensitive,
      *  exact match). */
     boost::optional<WorkspaceObject> getObjectByTypeAndName(IddObjectType objectType,
@@ -209,6 +213,12 @@ namespace detail {
     /** Returns true if fast naming is enabled. */
     bool fastNaming() const;
 
+    /** Returns true if object change signals are being deferred to the end of a change batch. */
+    bool isBatchingChanges() const;
+
+    /** Returns true if the workspace is frozen. */
+    bool isFrozen() const;
+
     //@}
     /** @name Setters */
     //@{
@@ -230,7 +240,8 @@ namespace detail {
         const std::vector<UHPointer>& pointersIntoWorkspace=UHPointerVector(),
         const std::vector<HUPointer>& pointersFromWorkspace=HUPointerVector(),
         bool driverMethod=true,
-        bool expectToLosePointers=false);
+        bool expectToLosePointers=false,
+        const std::vector<UHPointer>& resolvedPointers=UHPointerVector());
 
     /** Adds objectImplPtrs to the Workspace. As clones, the pointer handles may be incorrect. This
      *  is fixed by applying oldNewHandleMap to the pointer data. If this is a wholeCollectionClone,
@@ -350,6 +361,23 @@ namespace detail {
      */
     void setFastNaming(bool fastNaming);
 
+    /** Start (or nest) a change batch. */
+    void beginChangeBatch();
+
+    /** End a change batch. Ending the outermost batch emits the deferred change signals. */
+    void endChangeBatch();
+
+    /** Called by objects whose change signals are deferred by a change batch. */
+    void deferChangeSignals(const std::shared_ptr<WorkspaceObject_Impl>& object);
+
+    /** Fill lazily computed state and make the workspace read-only. Returns false if a change
+     *  batch is open. Derived classes that cache data in getters should fill those caches before
+     *  calling this version. */
+    virtual bool freeze();
+
+    /** Make a frozen workspace writable again. */
+    void unfreeze();
+
     /** Resolve name conflicts within other, and between this workspace and other by renaming objects
      *  in other. */
     bool resolvePotentialNameConflicts(Workspace& other);
@@ -484,6 +512,9 @@ namespace detail {
 
    protected:
 
+    // returns one object of type objectType, if any, without copying the others
+    boost::optional<WorkspaceObject> getAnyObjectOfType(IddObjectType objectType) const;
+
     // helper for non-virtual part of clone implementation
     void createAndAddClonedObjects(const std::shared_ptr<Workspace_Impl>& thisImpl,
                                    std::shared_ptr<Workspace_Impl> cloneImpl,
@@ -504,6 +535,15 @@ namespace detail {
     IddFileAndFactoryWrapper m_iddFileAndFactoryWrapper; // IDD file to be used for validity checking
     bool m_fastNaming;
 
+    // change batches
+    unsigned m_changeBatchDepth;
+    bool m_emittingChangeBatch;
+    bool m_changedInBatch;
+    std::vector<std::weak_ptr<WorkspaceObject_Impl> > m_changeBatchObjects;
+
+    // read-only mode for concurrent readers
+    bool m_frozen;
+
     typedef std::map<Handle, std::shared_ptr<WorkspaceObject_Impl> > WorkspaceObjectMap;
     WorkspaceObjectMap m_workspaceObjectMap;
 
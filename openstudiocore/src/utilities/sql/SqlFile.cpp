@@ -35,10 +35,10 @@ namespace openstudio{
 SqlFile::SqlFile()
 {}
 
-SqlFile::SqlFile(const openstudio::path& path, const bool createIndexes)
+SqlFile::SqlFile(const openstudio::path& path, const bool createIndexes, const bool readOnly)
 {
   try{
-    m_impl = std::shared_ptr<detail::SqlFile_Impl>(new detail::SqlFile_Impl(path, createIndexes));
+    m_impl = std::shared_ptr<detail::SqlFile_Impl>(new detail::SqlFile_Impl(path, createIndexes, readOnly));
   }catch(const std::exception& e){
     LOG(Error, "Could not create SqlFile for path '" << openstudio::toString(path) << "' error:" << e.what());
   }
@@ -1234,6 +1234,11 @@ void SqlFile::insertTimeSeriesData(const std::string &t_variableType, const std:
     t_variableUnits, t_timeSeries);
 }
 
+void SqlFile::insertTimeSeriesData(const std::vector<ReportVariableData> &t_reportVariables)
+{
+  m_impl->insertTimeSeriesData(t_reportVariables);
+}
+
 std::vector<std::string> SqlFile::availableReportingFrequencies(const std::string& envPeriod)
 {
   std::vector<std::string> result;
@@ -1724,4 +1729,29 @@ bool SqlFile::supportedVersion() const
   return false;
 }
 
+bool SqlFile::readOnly() const
+{
+  if (m_impl){
+    return m_impl->readOnly();
+  }
+
+  return false;
+}
+
+void SqlFile::setUseTabularDataIndex(bool useTabularDataIndex)
+{
+  if (m_impl){
+    m_impl->setUseTabularDataIndex(useTabularDataIndex);
+  }
+}
+
+bool SqlFile::useTabularDataIndex() const
+{
+  if (m_impl){
+    return m_impl->useTabularDataIndex();
+  }
+
+  return false;
+}
+
 } // openstudio
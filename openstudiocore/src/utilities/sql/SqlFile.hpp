@@ -67,6 +67,30 @@ namespace detail {
   class SqlFile_Impl;
 }
 
+/** ReportVariableData describes one report variable time series to be written by SqlFile::insertTimeSeriesData. */
+struct UTILITIES_API ReportVariableData
+{
+  ReportVariableData(const std::string &t_variableType, const std::string &t_indexGroup,
+      const std::string &t_timestepType, const std::string &t_keyValue, const std::string &t_variableName,
+      const openstudio::ReportingFrequency &t_reportingFrequency, const boost::optional<std::string> &t_scheduleName,
+      const std::string &t_variableUnits, const openstudio::TimeSeries &t_timeSeries)
+    : variableType(t_variableType), indexGroup(t_indexGroup), timestepType(t_timestepType), keyValue(t_keyValue),
+      variableName(t_variableName), reportingFrequency(t_reportingFrequency), scheduleName(t_scheduleName),
+      variableUnits(t_variableUnits), timeSeries(t_timeSeries)
+  {
+  }
+
+  std::string variableType;
+  std::string indexGroup;
+  std::string timestepType;
+  std::string keyValue;
+  std::string variableName;
+  openstudio::ReportingFrequency reportingFrequency;
+  boost::optional<std::string> scheduleName;
+  std::string variableUnits;
+  openstudio::TimeSeries timeSeries;
+};
+
 /** SqlFile class is a transaction script around the sql output of EnergyPlus. */
 class UTILITIES_API SqlFile {
  public:
@@ -79,7 +103,9 @@ class UTILITIES_API SqlFile {
 
   /// constructor from path
   /// Creates indexes by default, pass in false for no new indexes and quicker opening
-  explicit SqlFile(const openstudio::path& path, const bool createIndexes=true);
+  /// Pass in true for readOnly to open the file read only, no indexes are created and the
+  /// data dictionary is not read until it is needed, this is the quickest way to open a file for a few queries
+  explicit SqlFile(const openstudio::path& path, const bool createIndexes=true, const bool readOnly=false);
 
   /// initializes a new sql file for output
   /// Creates indexes by default, pass in false for no indexes and quicker creation
@@ -108,12 +134,23 @@ class UTILITIES_API SqlFile {
   /// \returns true if the sqlfile is of a version that's in our supported range
   bool supportedVersion() const;
 
+  /// \returns true if the sqlfile was opened read only
+  bool readOnly() const;
+
   /// close the file
   bool close();
 
   /// re-open the file
   bool reopen();
 
+  /// Use an in memory index of the tabular report data for the summary queries below.
+  /// The index is built from the TabularData and Strings tables on first use and uses additional memory,
+  /// it is worthwhile when many summary values are read from the same file.
+  void setUseTabularDataIndex(bool useTabularDataIndex);
+
+  /// \returns true if summary queries use the in memory index of the tabular report data
+  bool useTabularDataIndex() const;
+
   /// Energy Plus eplusout.sql file name
   std::string energyPlusSqliteFile() const;
 
@@ -840,6 +877,10 @@ class UTILITIES_API SqlFile {
       const openstudio::ReportingFrequency &t_reportingFrequency, const boost::optional<std::string> &t_scheduleName,
       const std::string &t_variableUnits, const openstudio::TimeSeries &t_timeSeries);
 
+  /// insert many report variables at once, all rows are written in a single transaction
+  /// this is much faster than calling insertTimeSeriesData for each variable
+  void insertTimeSeriesData(const std::vector<ReportVariableData> &t_reportVariables);
+
 
   //@}
   /** @name Operators */
@@ -0,0 +1,112 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2017, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+#include "SqlFileCollection.hpp"
+#include "SqlFile.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <thread>
+
+namespace openstudio {
+
+SqlFileCollection::SqlFileCollection(const std::vector<openstudio::path>& paths)
+  : m_paths(paths), m_numThreads(0)
+{
+}
+
+std::vector<openstudio::path> SqlFileCollection::paths() const
+{
+  return m_paths;
+}
+
+unsigned SqlFileCollection::numThreads() const
+{
+  return m_numThreads;
+}
+
+void SqlFileCollection::setNumThreads(unsigned numThreads)
+{
+  m_numThreads = numThreads;
+}
+
+SqlFileCollection::ResultTable SqlFileCollection::execAndReturnFirstDouble(const std::vector<std::string>& statements) const
+{
+  std::vector<Extractor> extractors;
+  for (const std::string& statement : statements) {
+    extractors.push_back([statement](const SqlFile& sqlFile) { return sqlFile.execAndReturnFirstDouble(statement); });
+  }
+  return extract(extractors);
+}
+
+SqlFileCollection::ResultTable SqlFileCollection::extract(const std::vector<Extractor>& extractors) const
+{
+  ResultTable result(extractors.size(), std::vector<boost::optional<double> >(m_paths.size()));
+
+  if (m_paths.empty() || extractors.empty()) {
+    return result;
+  }
+
+  unsigned numThreads = m_numThreads;
+  if (numThreads == 0) {
+    numThreads = std::max(1u, std::thread::hardware_concurrency());
+  }
+  numThreads = std::min<unsigned>(numThreads, static_cast<unsigned>(m_paths.size()));
+
+  // each worker opens, queries and closes one file at a time, every result cell is written by exactly one worker
+  std::atomic<size_t> next(0);
+  auto worker = [&]() {
+    for (size_t i = next++; i < m_paths.size(); i = next++) {
+      SqlFile sqlFile(m_paths[i], false, true);
+      if (!sqlFile.connectionOpen()) {
+        LOG(Warn, "Could not open '" << toString(m_paths[i]) << "'");
+        continue;
+      }
+      for (size_t j = 0; j < extractors.size(); ++j) {
+        try {
+          result[j][i] = extractors[j](sqlFile);
+        } catch (const std::exception& e) {
+          LOG(Error, "Error extracting results from '" << toString(m_paths[i]) << "': " << e.what());
+        }
+      }
+    }
+  };
+
+  std::vector<std::thread> threads;
+  for (unsigned t = 1; t < numThreads; ++t) {
+    threads.emplace_back(worker);
+  }
+  worker();
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  return result;
+}
+
+} // openstudio
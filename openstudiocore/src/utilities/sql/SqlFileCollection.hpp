@@ -0,0 +1,103 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2017, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+#ifndef UTILITIES_SQL_SQLFILECOLLECTION_HPP
+#define UTILITIES_SQL_SQLFILECOLLECTION_HPP
+
+#include "../UtilitiesAPI.hpp"
+
+#include "../core/Logger.hpp"
+#include "../core/Path.hpp"
+
+#include <boost/optional.hpp>
+
+#include <functional>
+#include <string>
+#include <vector>
+
+namespace openstudio {
+
+class SqlFile;
+
+/** SqlFileCollection extracts the same results from many EnergyPlus sql files, e.g. the runs of a parametric study.
+ *  Each file is opened read only, queried, and closed again by one of several worker threads. Results are returned
+ *  as a table with one column per query and one row per file, in the order of paths(). */
+class UTILITIES_API SqlFileCollection {
+ public:
+
+  /// a function extracting a single value from an open sql file
+  typedef std::function<boost::optional<double> (const SqlFile&)> Extractor;
+
+  /// one column per query, each column has one value per file
+  typedef std::vector<std::vector<boost::optional<double> > > ResultTable;
+
+  /** @name Constructors */
+  //@{
+
+  explicit SqlFileCollection(const std::vector<openstudio::path>& paths);
+
+  //@}
+  /** @name Getters */
+  //@{
+
+  std::vector<openstudio::path> paths() const;
+
+  /// number of threads used for extraction, 0 uses the number of hardware threads
+  unsigned numThreads() const;
+
+  //@}
+  /** @name Setters */
+  //@{
+
+  void setNumThreads(unsigned numThreads);
+
+  //@}
+  /** @name Queries */
+  //@{
+
+  /// execute each statement on each file and return the first (if any) value as a double
+  /// values are none for files that cannot be opened
+  ResultTable execAndReturnFirstDouble(const std::vector<std::string>& statements) const;
+
+  /// evaluate each extractor on each file, e.g. [](const SqlFile& sqlFile){ return sqlFile.netSiteEnergy(); }
+  /// values are none for files that cannot be opened
+  ResultTable extract(const std::vector<Extractor>& extractors) const;
+
+  //@}
+
+ private:
+
+  REGISTER_LOGGER("openstudio.sql.SqlFileCollection");
+
+  std::vector<openstudio::path> m_paths;
+  unsigned m_numThreads;
+};
+
+} // openstudio
+
+#endif // UTILITIES_SQL_SQLFILECOLLECTION_HPP
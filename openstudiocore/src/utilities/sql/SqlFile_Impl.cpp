@@ -27,6 +27,7 @@
  **********************************************************************************************************************/
 
 #include "SqlFile_Impl.hpp"
+#include "SqlFile.hpp"
 #include "SqlFileTimeSeriesQuery.hpp"
 #include "OpenStudio.hxx"
 
@@ -39,9 +40,12 @@
 #include "../core/Assert.hpp"
 
 
+#include <boost/algorithm/string/replace.hpp>
 #include <boost/lexical_cast.hpp>
 #include <boost/regex.hpp>
 
+#include <unordered_map>
+
 using boost::multi_index_container;
 using boost::multi_index::indexed_by;
 using boost::multi_index::ordered_unique;
@@ -59,19 +63,20 @@ namespace openstudio{
       return std::string(reinterpret_cast<const char*>(column));
     }
 
-    SqlFile_Impl::SqlFile_Impl(const openstudio::path& path, const bool createIndexes)
-      : m_path(path), m_connectionOpen(false), m_supportedVersion(false)
+    SqlFile_Impl::SqlFile_Impl(const openstudio::path& path, const bool createIndexes, const bool readOnly)
+      : m_path(path), m_connectionOpen(false), m_dataDictionaryRetrieved(false), m_supportedVersion(false), m_readOnly(readOnly),
+        m_useTabularDataIndex(false), m_tabularDataIndexBuilt(false)
     {
       if (openstudio::filesystem::exists(m_path)){
         m_path = openstudio::filesystem::canonical(m_path);
       }
       reopen();
-      if (createIndexes) this->createIndexes();
+      if (createIndexes && !m_readOnly) this->createIndexes();
     }
 
     SqlFile_Impl::SqlFile_Impl(const openstudio::path &t_path, const openstudio::EpwFile &t_epwFile, const openstudio::DateTime &t_simulationTime,
         const openstudio::Calendar &t_calendar, const bool createIndexes)
-      : m_path(t_path)
+      : m_path(t_path), m_dataDictionaryRetrieved(false), m_readOnly(false), m_useTabularDataIndex(false), m_tabularDataIndexBuilt(false)
     {
       if (openstudio::filesystem::exists(m_path)){
         m_path = openstudio::filesystem::canonical(m_path);
@@ -293,6 +298,11 @@ namespace openstudio{
         sqlite3_bind_double(m_statement, position, val);
       }
 
+      void bindNull(int position)
+      {
+        sqlite3_bind_null(m_statement, position);
+      }
+
       void execute()
       {
         if (sqlite3_step(m_statement) != SQLITE_DONE)
@@ -411,6 +421,10 @@ namespace openstudio{
 
     bool SqlFile_Impl::close()
     {
+      m_tabularDataIndex.clear();
+      m_tabularDataIndexBuilt = false;
+      m_dataDictionaryRetrieved = false;
+
       if (m_connectionOpen)
       {
         sqlite3_close(m_db);
@@ -438,7 +452,8 @@ namespace openstudio{
       m_sqliteFilename = toString(m_path.make_preferred().native());
       std::string fileName = m_sqliteFilename;
 
-      int code = sqlite3_open_v2(fileName.c_str(), &m_db, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_EXCLUSIVE, nullptr);
+      int flags = m_readOnly ? SQLITE_OPEN_READONLY : (SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_EXCLUSIVE);
+      int code = sqlite3_open_v2(fileName.c_str(), &m_db, flags, nullptr);
 
       m_connectionOpen = (code == 0);
       if (m_connectionOpen) {// create index on dictionaryIndex for large table reportvariabledata
@@ -453,13 +468,27 @@ namespace openstudio{
         // set locking mode to exclusive
         //code = sqlite3_exec(m_db, "PRAGMA locking_mode=EXCLUSIVE", NULL, NULL, NULL);
 
-        // retrieve DataDictionaryTable
-        retrieveDataDictionary();
+        // retrieve DataDictionaryTable, in read only mode this is deferred until it is needed
+        if (!m_readOnly) {
+          retrieveDataDictionary();
+        }
       } else {
         throw openstudio::Exception("File not successfully opened.");
       }
     }
 
+    void SqlFile_Impl::ensureDataDictionary() const
+    {
+      if (!m_dataDictionaryRetrieved && m_connectionOpen){
+        retrieveDataDictionary();
+      }
+    }
+
+    bool SqlFile_Impl::readOnly() const
+    {
+      return m_readOnly;
+    }
+
     bool SqlFile_Impl::isSupportedVersion() const
     {
       return m_supportedVersion;
@@ -645,79 +674,107 @@ namespace openstudio{
         const openstudio::ReportingFrequency &t_reportingFrequency, const boost::optional<std::string> &t_scheduleName,
         const std::string &t_variableUnits, const openstudio::TimeSeries &t_timeSeries)
     {
-      int datadicindex = getNextIndex("reportdatadictionary", "ReportDataDictionaryIndex");
-
+      insertTimeSeriesData(std::vector<ReportVariableData>{ReportVariableData(t_variableType, t_indexGroup,
+        t_timestepType, t_keyValue, t_variableName,
+        t_reportingFrequency, t_scheduleName,
+        t_variableUnits, t_timeSeries)});
+    }
 
-      std::stringstream insertReportDataDictionary;
-      insertReportDataDictionary
-        << "insert into reportdatadictionary (ReportDataDictionaryIndex, IsMeter, Type, IndexGroup, TimestepType, KeyValue, Name, ReportingFrequency, ScheduleName, Units) values ("
-        << datadicindex << ", "
-        << "'0',"
-        << "'" << t_variableType << "', "
-        << "'" << t_indexGroup << "', "
-        << "'" << t_timestepType << "', "
-        << "'" << t_keyValue << "', "
-        << "'" << t_variableName << "', "
-        << "'" << t_reportingFrequency.valueName() << "', ";
+    void SqlFile_Impl::insertTimeSeriesData(const std::vector<openstudio::ReportVariableData> &t_reportVariables)
+    {
+      if (t_reportVariables.empty()) {
+        return;
+      }
 
-      if (t_scheduleName)
+      // look up table from Month, Day, Hour, Minute to the first matching TimeIndex
+      std::unordered_map<int, int> timeIndices;
       {
-        insertReportDataDictionary
-          << "'" << *t_scheduleName << "', ";
-      } else {
-        insertReportDataDictionary
-          << "null, ";
+        sqlite3_stmt* sqlStmtPtr = nullptr;
+        sqlite3_prepare_v2(m_db, "select TimeIndex, Month, Day, Hour, Minute from time", -1, &sqlStmtPtr, nullptr);
+        if (sqlStmtPtr) {
+          while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW) {
+            int key = ((sqlite3_column_int(sqlStmtPtr, 1) * 100 + sqlite3_column_int(sqlStmtPtr, 2)) * 100 + sqlite3_column_int(sqlStmtPtr, 3)) * 100 + sqlite3_column_int(sqlStmtPtr, 4);
+            timeIndices.insert(std::make_pair(key, sqlite3_column_int(sqlStmtPtr, 0)));
+          }
+          sqlite3_finalize(sqlStmtPtr);
+        }
       }
 
-      insertReportDataDictionary
-        << "'" << t_variableUnits << "');";
+      // allocate contiguous index ranges once
+      int datadicindex = getNextIndex("reportdatadictionary", "ReportDataDictionaryIndex");
+      int reportdataindex = getNextIndex("reportdata", "ReportDataIndex");
+
+      // the dictionary statement holds the transaction, it is declared first so it commits after the data statement is finalized
+      PreparedStatement dictionaryStmt("insert into reportdatadictionary (ReportDataDictionaryIndex, IsMeter, Type, IndexGroup, TimestepType, KeyValue, Name, ReportingFrequency, ScheduleName, Units) values (?, 0, ?, ?, ?, ?, ?, ?, ?, ?);", m_db, true);
+      PreparedStatement stmt("insert into reportdata (ReportDataIndex, TimeIndex, ReportDataDictionaryIndex, Value) values (?, ?, ?, ?);", m_db);
+
+      for (const auto & reportVariable : t_reportVariables)
+      {
+        dictionaryStmt.bind(1, datadicindex);
+        dictionaryStmt.bind(2, reportVariable.variableType);
+        dictionaryStmt.bind(3, reportVariable.indexGroup);
+        dictionaryStmt.bind(4, reportVariable.timestepType);
+        dictionaryStmt.bind(5, reportVariable.keyValue);
+        dictionaryStmt.bind(6, reportVariable.variableName);
+        dictionaryStmt.bind(7, reportVariable.reportingFrequency.valueName());
+        if (reportVariable.scheduleName)
+        {
+          dictionaryStmt.bind(8, *reportVariable.scheduleName);
+        } else {
+          dictionaryStmt.bindNull(8);
+        }
+        dictionaryStmt.bind(9, reportVariable.variableUnits);
+        dictionaryStmt.execute();
 
+        const openstudio::TimeSeries & timeSeries = reportVariable.timeSeries;
+        openstudio::Vector values = timeSeries.values();
+        openstudio::Vector days = timeSeries.daysFromFirstReport();
 
-      execAndThrowOnError(insertReportDataDictionary.str());
+        openstudio::DateTime firstdate = timeSeries.firstReportDateTime();
 
+        for (size_t i = 0; i < values.size(); ++i)
+        {
+          openstudio::DateTime dt = firstdate + openstudio::Time(days[i]);
+          double value = values[i];
 
-      std::vector<double> values = toStandardVector(t_timeSeries.values());
-      std::vector<double> days = toStandardVector(t_timeSeries.daysFromFirstReport());
+          if (dt.time().seconds() == 59) 
+          {
+            // rounding error, let's help
+            dt += openstudio::Time(0,0,0,1);
+          }
 
-      openstudio::DateTime firstdate = t_timeSeries.firstReportDateTime();
+          if (dt.time().seconds() == 1) 
+          {
+            // rounding error, let's help
+            dt -= openstudio::Time(0,0,0,1);
+          }
 
-      // we'll let stmt1 have the transaction
-      PreparedStatement stmt("insert into reportdata (ReportDataIndex, TimeIndex, ReportDataDictionaryIndex, Value) values ( ?, (select TimeIndex from time where Month=? and Day=? and Hour=? and Minute=? limit 1), ?, ?);", m_db, true);
+          int month = dt.date().monthOfYear().value();
+          int day = dt.date().dayOfMonth();
+          int hour = dt.time().hours();
+          int minute = dt.time().minutes();
 
-      for (size_t i = 0; i < values.size(); ++i)
-      {
-        openstudio::DateTime dt = firstdate + openstudio::Time(days[i]);
-        double value = values[i];
+          ++hour; // energyplus says time goes from 1-24 not from 0-23
 
-        if (dt.time().seconds() == 59) 
-        {
-          // rounding error, let's help
-          dt += openstudio::Time(0,0,0,1);
-        }
+          stmt.bind(1, reportdataindex);
 
-        if (dt.time().seconds() == 1) 
-        {
-          // rounding error, let's help
-          dt -= openstudio::Time(0,0,0,1);
-        }
+          auto timeIndex = timeIndices.find(((month * 100 + day) * 100 + hour) * 100 + minute);
+          if (timeIndex != timeIndices.end())
+          {
+            stmt.bind(2, timeIndex->second);
+          } else {
+            stmt.bindNull(2);
+          }
 
-        int month = dt.date().monthOfYear().value();
-        int day = dt.date().dayOfMonth();
-        int hour = dt.time().hours();
-        int minute = dt.time().minutes();
+          stmt.bind(3, datadicindex);
+          stmt.bind(4, value);
 
-        ++hour; // energyplus says time goes from 1-24 not from 0-23
+          stmt.execute();
 
-        int reportdataindex = getNextIndex("reportdata", "ReportDataIndex");
-        stmt.bind(1, reportdataindex);
-        stmt.bind(2, month);
-        stmt.bind(3, day);
-        stmt.bind(4, hour);
-        stmt.bind(5, minute);
-        stmt.bind(6, datadicindex);
-        stmt.bind(7, value);
+          ++reportdataindex;
+        }
 
-        stmt.execute();
+        ++datadicindex;
       }
     }
 
@@ -777,8 +834,10 @@ namespace openstudio{
     }
 
 
-    void SqlFile_Impl::retrieveDataDictionary()
+    void SqlFile_Impl::retrieveDataDictionary() const
     {
+      m_dataDictionaryRetrieved = true;
+
       std::string table, name, keyValue, units, rf;
 
       if (m_db)
@@ -938,14 +997,7 @@ namespace openstudio{
         LOG(Warn, "Reporting Net Site Energy with " << *hours << " hrs");
       }
 
-      std::string s = "SELECT Value FROM tabulardatawithstrings WHERE \
-                              ReportName='AnnualBuildingUtilityPerformanceSummary' AND \
-                              ReportForString='Entire Facility' AND \
-                              TableName='Site and Source Energy' AND \
-                              RowName='Net Site Energy' AND \
-                              ColumnName='Total Energy' AND \
-                              Units='GJ'";
-      boost::optional<double> d = execAndReturnFirstDouble(s);
+      boost::optional<double> d = tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy", "Net Site Energy", "Total Energy", "GJ");
 
       if (!d) {
         LOG(Warn, "Tabular results were not found, trying to calculate it ourselves");
@@ -969,14 +1021,7 @@ namespace openstudio{
         LOG(Warn, "Reporting Net Source Energy with " << *hours << " hrs");
       }
 
-      const std::string& s = "SELECT Value FROM tabulardatawithstrings WHERE \
-                              ReportName='AnnualBuildingUtilityPerformanceSummary' AND \
-                              ReportForString='Entire Facility' AND \
-                              TableName='Site and Source Energy' AND \
-                              RowName='Net Source Energy' AND \
-                              ColumnName='Total Energy' AND \
-                              Units='GJ'";
-      return execAndReturnFirstDouble(s);
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy", "Net Source Energy", "Total Energy", "GJ");
     }
 
 
@@ -989,14 +1034,7 @@ namespace openstudio{
         LOG(Warn, "Reporting Total Site Energy with " << *hours << " hrs");
       }
 
-      const std::string& s = "SELECT Value FROM tabulardatawithstrings WHERE \
-                              ReportName='AnnualBuildingUtilityPerformanceSummary' AND \
-                              ReportForString='Entire Facility' AND \
-                              TableName='Site and Source Energy' AND \
-                              RowName='Total Site Energy' AND \
-                              ColumnName='Total Energy' AND \
-                              Units='GJ'";
-      return execAndReturnFirstDouble(s);
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy", "Total Site Energy", "Total Energy", "GJ");
     }
 
 
@@ -1009,14 +1047,7 @@ namespace openstudio{
         LOG(Warn, "Reporting Total Source Energy with " << *hours << " hrs");
       }
 
-      const std::string& s = "SELECT Value FROM tabulardatawithstrings WHERE \
-                              ReportName='AnnualBuildingUtilityPerformanceSummary' AND \
-                              ReportForString='Entire Facility' AND \
-                              TableName='Site and Source Energy' AND \
-                              RowName='Total Source Energy' AND \
-                              ColumnName='Total Energy' AND \
-                              Units='GJ'";
-      return execAndReturnFirstDouble(s);
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Site and Source Energy", "Total Source Energy", "Total Energy", "GJ");
     }
 
 
@@ -1080,7 +1111,7 @@ namespace openstudio{
     OptionalDouble SqlFile_Impl::annualTotalCostPerBldgArea(const FuelType& fuel) const
     {
       // Get the total building area
-      boost::optional<double> totalBuildingArea = execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'Building Area') and (ColumnName = 'Area') and (RowName = 'Total Building Area') and (Units = 'm2')");
+      boost::optional<double> totalBuildingArea = tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Building Area", "Total Building Area", "Area", "m2");
       
       // Get the annual energy cost
       boost::optional<double> annualEnergyCost = annualTotalCost(fuel);
@@ -1098,7 +1129,7 @@ namespace openstudio{
     OptionalDouble SqlFile_Impl::annualTotalCostPerNetConditionedBldgArea(const FuelType& fuel) const
     {
       // Get the total building area
-      boost::optional<double> totalBuildingArea = execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'Building Area') and (ColumnName = 'Area') and (RowName = 'Net Conditioned Building Area') and (Units = 'm2')");
+      boost::optional<double> totalBuildingArea = tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "Building Area", "Net Conditioned Building Area", "Area", "m2");
 
       // Get the annual energy cost
       boost::optional<double> annualEnergyCost = annualTotalCost(fuel);
@@ -1139,6 +1170,8 @@ namespace openstudio{
 
     std::vector<std::string> SqlFile_Impl::availableTimeSeries()
     {
+      ensureDataDictionary();
+
       std::vector<std::string> vec;
       std::string timeSeriesName;
       DataDictionaryTable::index<name>::type::iterator iname;
@@ -1155,6 +1188,8 @@ namespace openstudio{
 
     std::vector<std::string> SqlFile_Impl::availableVariableNames(const std::string& envPeriod, const std::string& reportingFrequency) const
     {
+      ensureDataDictionary();
+
       std::string queryEnvPeriod = boost::to_upper_copy(envPeriod);
 
       std::vector<std::string> vec;
@@ -1176,6 +1211,8 @@ namespace openstudio{
 
     std::vector<std::string> SqlFile_Impl::availableReportingFrequencies(const std::string& envPeriod)
     {
+      ensureDataDictionary();
+
       std::string queryEnvPeriod = boost::to_upper_copy(envPeriod);
 
       std::vector<std::string> vec;
@@ -1307,10 +1344,8 @@ namespace openstudio{
         std::string units = result.getUnitsForFuelType(fuelType);
         for (EndUseCategoryType category : result.categories()){
 
-          std::string query = "SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='" + \
-                               fuelType.valueDescription() + "') and (RowName ='" + category.valueDescription() + "') and (Units = '" + units + "')";
-
-          boost::optional<double> value = execAndReturnFirstDouble(query);
+          boost::optional<double> value = tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses",
+                                                           category.valueDescription(), fuelType.valueDescription(), units);
           OS_ASSERT(value);
 
           if (*value != 0.0){
@@ -1326,469 +1361,471 @@ namespace openstudio{
 
     OptionalDouble SqlFile_Impl::electricityHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Heating') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Cooling') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Interior Lighting') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Exterior Lighting') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Interior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Exterior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Fans') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Pumps') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "Electricity", "GJ");
     }
 
 
     OptionalDouble SqlFile_Impl::electricityHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName = 'Humidification') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Water Systems') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "Electricity", "GJ");
     }
 
 
     OptionalDouble SqlFile_Impl::electricityRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Refrigeration') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Generators') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::electricityTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Electricity') and (RowName ='Total End Uses') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "Electricity", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Heating') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Cooling') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "Natural Gas", "GJ");
     }
     OptionalDouble SqlFile_Impl::naturalGasExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Fans') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Pumps') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "Natural Gas", "GJ");
     }
 
 
     OptionalDouble SqlFile_Impl::naturalGasHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Humidification') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Water Systems') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Refrigeration') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Generators') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::naturalGasTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Natural Gas') and (RowName ='Total End Uses') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "Natural Gas", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Heating') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Cooling') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Fans') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Pumps') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Humidification') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Water Systems') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Refrigeration') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Generators') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::otherFuelTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Additional Fuel') and (RowName ='Total End Uses') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "Additional Fuel", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Heating') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Cooling') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Interior Lighting') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Exterior Lighting') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Fans') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Pumps') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Humidification') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Water Systems') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Refrigeration') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Generators') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtCoolingTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Cooling') and (RowName ='Total End Uses') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "District Cooling", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Heating') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Cooling') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Interior Lights') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lights", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Exterior Lights') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lights", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Interior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Exterior Equipment') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Fans') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Pumps') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Heat Rejection') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Humidification') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Heat Recovery') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Water Systems') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Refrigeration') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Generators') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::districtHeatingTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='District Heating') and (RowName ='Total End Uses') and (Units = 'GJ')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "District Heating", "GJ");
     }
 
     OptionalDouble SqlFile_Impl::waterHeating() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Heating') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heating", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterCooling() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Cooling') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Cooling", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterInteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Interior Lighting') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Lighting", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterExteriorLighting() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Exterior Lighting') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Lighting", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterInteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Interior Equipment') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Interior Equipment", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterExteriorEquipment() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Exterior Equipment') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Exterior Equipment", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterFans() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Fans') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Fans", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterPumps() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Pumps') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Pumps", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterHeatRejection() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Heat Rejection') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Rejection", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterHumidification() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Humidification') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Humidification", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterHeatRecovery() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Heat Recovery') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Heat Recovery", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterWaterSystems() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Water Systems') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Water Systems", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterRefrigeration() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Refrigeration') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Refrigeration", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterGenerators() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Generators') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Generators", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::waterTotalEndUses() const
     {
-      return execAndReturnFirstDouble("SELECT Value from tabulardatawithstrings where (reportname = 'AnnualBuildingUtilityPerformanceSummary') and (ReportForString = 'Entire Facility') and (TableName = 'End Uses'  ) and (ColumnName ='Water') and (RowName ='Total End Uses') and (Units = 'm3')");
+      return tabularDataValue("AnnualBuildingUtilityPerformanceSummary", "Entire Facility", "End Uses", "Total End Uses", "Water", "m3");
     }
 
     OptionalDouble SqlFile_Impl::hoursHeatingSetpointNotMet() const
     {
-      return execAndReturnFirstDouble("SELECT Value FROM TabularDataWithStrings WHERE (ReportName='SystemSummary') AND (ReportForString='Entire Facility') AND (TableName='Time Setpoint Not Met') AND (RowName = 'Facility') AND (ColumnName='During Heating') AND (Units = 'hr')");
+      return tabularDataValue("SystemSummary", "Entire Facility", "Time Setpoint Not Met", "Facility", "During Heating", "hr");
     }
 
     OptionalDouble SqlFile_Impl::hoursCoolingSetpointNotMet() const
     {
-      return execAndReturnFirstDouble("SELECT Value FROM TabularDataWithStrings WHERE (ReportName='SystemSummary') AND (ReportForString='Entire Facility') AND (TableName='Time Setpoint Not Met') AND (RowName = 'Facility') AND (ColumnName='During Cooling') AND (Units = 'hr')");
+      return tabularDataValue("SystemSummary", "Entire Facility", "Time Setpoint Not Met", "Facility", "During Cooling", "hr");
     }
 
 
     std::vector<std::string> SqlFile_Impl::availableEnvPeriods() const
     {
+      ensureDataDictionary();
+
       std::vector<std::string> vec;
       std::string envPeriodName;
       DataDictionaryTable::index<envPeriod>::type::iterator ienvPeriod;
@@ -1805,6 +1842,8 @@ namespace openstudio{
 
     std::vector<std::string> SqlFile_Impl::availableKeyValues(const std::string& envPeriod, const std::string& reportingFrequency, const std::string& timeSeriesName)
     {
+      ensureDataDictionary();
+
       std::string queryEnvPeriod = boost::to_upper_copy(envPeriod);
 
       std::vector<std::string> vec;
@@ -1848,6 +1887,8 @@ namespace openstudio{
 
     boost::optional<double> SqlFile_Impl::runPeriodValue(const std::string& envPeriod, const std::string& timeSeriesName, const std::string& keyValue)
     {
+      ensureDataDictionary();
+
       std::string queryEnvPeriod = boost::to_upper_copy(envPeriod);
 
       DataDictionaryTable::index<envPeriodReportingFrequencyNameKeyValue>::type::iterator iEpRfNKv = m_dataDictionary.get<envPeriodReportingFrequencyNameKeyValue>().find(boost::make_tuple(queryEnvPeriod, ReportingFrequency(ReportingFrequency::RunPeriod).valueName(), timeSeriesName, keyValue));
@@ -1899,6 +1940,121 @@ namespace openstudio{
       return value;
     }
 
+    std::string SqlFile_Impl::tabularDataKey(const std::string& reportName, const std::string& reportForString,
+        const std::string& tableName, const std::string& rowName, const std::string& columnName, const std::string& units)
+    {
+      // fields are separated by a control character which does not appear in report strings
+      const char separator = '\x1f';
+      std::string result;
+      result.reserve(reportName.size() + reportForString.size() + tableName.size() + rowName.size() + columnName.size() + units.size() + 5);
+      result += reportName;
+      result += separator;
+      result += reportForString;
+      result += separator;
+      result += tableName;
+      result += separator;
+      result += rowName;
+      result += separator;
+      result += columnName;
+      result += separator;
+      result += units;
+      return result;
+    }
+
+    void SqlFile_Impl::buildTabularDataIndex() const
+    {
+      m_tabularDataIndex.clear();
+      m_tabularDataIndexBuilt = true;
+
+      if (!m_db){
+        return;
+      }
+
+      // load the strings once rather than joining the Strings table six times per value
+      std::unordered_map<int, std::string> strings;
+      sqlite3_stmt* sqlStmtPtr = nullptr;
+      sqlite3_prepare_v2(m_db, "SELECT StringIndex, Value FROM Strings", -1, &sqlStmtPtr, nullptr);
+      if (sqlStmtPtr){
+        while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW){
+          const unsigned char* value = sqlite3_column_text(sqlStmtPtr, 1);
+          strings[sqlite3_column_int(sqlStmtPtr, 0)] = value ? columnText(value) : std::string();
+        }
+        sqlite3_finalize(sqlStmtPtr);
+      }
+
+      auto string = [&strings](int index, std::string& value){
+        auto it = strings.find(index);
+        if (it == strings.end()){
+          return false;
+        }
+        value = it->second;
+        return true;
+      };
+
+      // ordered by TabularDataIndex so that the first match is the same value the TabularDataWithStrings queries return
+      sqlStmtPtr = nullptr;
+      sqlite3_prepare_v2(m_db, "SELECT ReportNameIndex, ReportForStringIndex, TableNameIndex, RowNameIndex, ColumnNameIndex, UnitsIndex, Value FROM TabularData ORDER BY TabularDataIndex", -1, &sqlStmtPtr, nullptr);
+      if (sqlStmtPtr){
+        std::string reportName, reportForString, tableName, rowName, columnName, units;
+        while (sqlite3_step(sqlStmtPtr) == SQLITE_ROW){
+          // rows with dangling string references are excluded by the inner joins of TabularDataWithStrings
+          if (string(sqlite3_column_int(sqlStmtPtr, 0), reportName) &&
+              string(sqlite3_column_int(sqlStmtPtr, 1), reportForString) &&
+              string(sqlite3_column_int(sqlStmtPtr, 2), tableName) &&
+              string(sqlite3_column_int(sqlStmtPtr, 3), rowName) &&
+              string(sqlite3_column_int(sqlStmtPtr, 4), columnName) &&
+              string(sqlite3_column_int(sqlStmtPtr, 5), units))
+          {
+            m_tabularDataIndex.insert(std::make_pair(tabularDataKey(reportName, reportForString, tableName, rowName, columnName, units),
+                                                     sqlite3_column_double(sqlStmtPtr, 6)));
+          }
+        }
+        sqlite3_finalize(sqlStmtPtr);
+      }
+    }
+
+    boost::optional<double> SqlFile_Impl::tabularDataValue(const std::string& reportName, const std::string& reportForString,
+        const std::string& tableName, const std::string& rowName, const std::string& columnName, const std::string& units) const
+    {
+      if (m_useTabularDataIndex){
+        if (!m_tabularDataIndexBuilt){
+          buildTabularDataIndex();
+        }
+
+        boost::optional<double> result;
+        auto it = m_tabularDataIndex.find(tabularDataKey(reportName, reportForString, tableName, rowName, columnName, units));
+        if (it != m_tabularDataIndex.end()){
+          result = it->second;
+        }
+        return result;
+      }
+
+      auto quote = [](const std::string& value){
+        return "'" + boost::replace_all_copy(value, "'", "''") + "'";
+      };
+
+      return execAndReturnFirstDouble("SELECT Value FROM TabularDataWithStrings WHERE ReportName=" + quote(reportName) +
+        " AND ReportForString=" + quote(reportForString) +
+        " AND TableName=" + quote(tableName) +
+        " AND RowName=" + quote(rowName) +
+        " AND ColumnName=" + quote(columnName) +
+        " AND Units=" + quote(units));
+    }
+
+    void SqlFile_Impl::setUseTabularDataIndex(bool useTabularDataIndex)
+    {
+      m_useTabularDataIndex = useTabularDataIndex;
+      if (!m_useTabularDataIndex){
+        m_tabularDataIndex.clear();
+        m_tabularDataIndexBuilt = false;
+      }
+    }
+
+    bool SqlFile_Impl::useTabularDataIndex() const
+    {
+      return m_useTabularDataIndex;
+    }
+
     boost::optional<int> SqlFile_Impl::execAndReturnFirstInt(const std::string& statement) const
     {
       boost::optional<int> value;
@@ -2049,6 +2205,10 @@ namespace openstudio{
     int SqlFile_Impl::execute(const std::string& statement)
     {
       int code = SQLITE_ERROR;
+      // the statement may modify the tabular data, rebuild the index on next use
+      m_tabularDataIndex.clear();
+      m_tabularDataIndexBuilt = false;
+
       if (m_db)
       {
         sqlite3_stmt* sqlStmtPtr;
@@ -2527,6 +2687,8 @@ namespace openstudio{
 
     openstudio::OptionalTimeSeries SqlFile_Impl::timeSeries(const std::string& envPeriod, const std::string& reportingFrequency, const std::string& timeSeriesName, const std::string& keyValue)
     {
+      ensureDataDictionary();
+
       //std::string queryEnvPeriod = envPeriod;
       std::string queryEnvPeriod = boost::to_upper_copy(envPeriod);
 
@@ -2921,6 +3083,8 @@ namespace openstudio{
     /// returns datadictionary of available timeseries
     DataDictionaryTable SqlFile_Impl::dataDictionary() const
     {
+      ensureDataDictionary();
+
       return m_dataDictionary;
     }
 
@@ -43,6 +43,7 @@
 #include <boost/optional.hpp>
 
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 // forward declaration
@@ -57,6 +58,7 @@ namespace openstudio{
   class EpwFile;
   class DateTime;
   class Calendar;
+  struct ReportVariableData;
 
   // private namespace
   namespace detail{
@@ -68,7 +70,7 @@ namespace openstudio{
       /// or if file is not valid
       /// createIndexes will create useful indexes when opening an sqlite file but for faster opening
       /// pass in false if those indexes are not needed
-      SqlFile_Impl(const openstudio::path& path, const bool createIndexes=true);
+      SqlFile_Impl(const openstudio::path& path, const bool createIndexes=true, const bool readOnly=false);
 
       /// createIndexes will create useful indexes when creating an sqlite file but for faster creation
       /// pass in false if those indexes are not needed
@@ -745,6 +747,15 @@ namespace openstudio{
       // execute a statement and return the first (if any) value as a double
       boost::optional<double> execAndReturnFirstDouble(const std::string& statement) const;
 
+      // return the first (if any) tabular report value matching all of the fields as a double
+      // uses the tabular data index if enabled, otherwise queries TabularDataWithStrings
+      boost::optional<double> tabularDataValue(const std::string& reportName, const std::string& reportForString,
+          const std::string& tableName, const std::string& rowName, const std::string& columnName, const std::string& units) const;
+
+      void setUseTabularDataIndex(bool useTabularDataIndex);
+
+      bool useTabularDataIndex() const;
+
       // execute a statement and return the first (if any) value as an int
       boost::optional<int> execAndReturnFirstInt(const std::string& statement) const;
 
@@ -773,6 +784,11 @@ namespace openstudio{
           const openstudio::ReportingFrequency &t_reportingFrequency, const boost::optional<std::string> &t_scheduleName,
           const std::string &t_variableUnits, const openstudio::TimeSeries &t_timeSeries);
 
+      // Insert many report variable records in a single transaction
+      // Report data indices are allocated as one contiguous range and time indices are resolved
+      // from a lookup table loaded once, rather than with a query per row
+      void insertTimeSeriesData(const std::vector<openstudio::ReportVariableData> &t_reportVariables);
+
       int insertZone(const std::string &t_name,
           double t_relNorth,
           double t_originX, double t_originY, double t_originZ,
@@ -799,11 +815,16 @@ namespace openstudio{
 
       bool isSupportedVersion() const;
 
+      bool readOnly() const;
+
     private:
 
       void init();
 
-      void retrieveDataDictionary();
+      void retrieveDataDictionary() const;
+
+      // retrieve the data dictionary if it has not been retrieved yet
+      void ensureDataDictionary() const;
 
       void execAndThrowOnError(const std::string &t_stmt);
       void addSimulation(const openstudio::EpwFile &t_epwFile, const openstudio::DateTime &t_simulationTime,
@@ -828,15 +849,27 @@ namespace openstudio{
 
       bool isValidConnection();
 
+      // key of the tabular data index built from report name, report for, table, row, column and units
+      static std::string tabularDataKey(const std::string& reportName, const std::string& reportForString,
+          const std::string& tableName, const std::string& rowName, const std::string& columnName, const std::string& units);
+
+      void buildTabularDataIndex() const;
+
       void mf_makeConsistent(std::vector<SqlFileTimeSeriesQuery>& queries);
 
       openstudio::path m_path;
       bool m_connectionOpen;
-      DataDictionaryTable m_dataDictionary;
+      mutable DataDictionaryTable m_dataDictionary;
+      mutable bool m_dataDictionaryRetrieved;
       sqlite3* m_db;
       std::string m_sqliteFilename;
 
       bool m_supportedVersion;
+      bool m_readOnly;
+
+      bool m_useTabularDataIndex;
+      mutable bool m_tabularDataIndexBuilt;
+      mutable std::unordered_map<std::string, double> m_tabularDataIndex;
 
       REGISTER_LOGGER("openstudio.energyplus.SqlFile");
     };
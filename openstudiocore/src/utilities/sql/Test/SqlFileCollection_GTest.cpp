@@ -0,0 +1,98 @@
+/***********************************************************************************************************************
+ *  OpenStudio(R), Copyright (c) 2008-2017, Alliance for Sustainable Energy, LLC. All rights reserved.
+ *
+ *  Redistribution and use in source and binary forms, with or without modification, are permitted provided that the
+ *  following conditions are met:
+ *
+ *  (1) Redistributions of source code must retain the above copyright notice, this list of conditions and the following
+ *  disclaimer.
+ *
+ *  (2) Redistributions in binary form must reproduce the above copyright notice, this list of conditions and the
+ *  following disclaimer in the documentation and/or other materials provided with the distribution.
+ *
+ *  (3) Neither the name of the copyright holder nor the names of any contributors may be used to endorse or promote
+ *  products derived from this software without specific prior written permission from the respective party.
+ *
+ *  (4) Other than as required in clauses (1) and (2), distributions in any form of modifications or other derivative
+ *  works may not use the "OpenStudio" trademark, "OS", "os", or any other confusingly similar designation without
+ *  specific prior written permission from Alliance for Sustainable Energy, LLC.
+ *
+ *  THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES,
+ *  INCLUDING, BUT NOT LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ *  DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER, THE UNITED STATES GOVERNMENT, OR ANY CONTRIBUTORS BE LIABLE FOR
+ *  ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO,
+ *  PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED
+ *  AND ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ *  ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ **********************************************************************************************************************/
+
+#include <gtest/gtest.h>
+
+#include "SqlFileFixture.hpp"
+
+#include "../SqlFileCollection.hpp"
+
+#include <resources.hxx>
+
+using namespace openstudio;
+
+TEST_F(SqlFileFixture, SqlFile_ReadOnly)
+{
+  openstudio::path path = resourcesPath() / toPath("energyplus/5ZoneAirCooled/eplusout.sql");
+  SqlFile readOnlySqlFile(path, true, true);
+  ASSERT_TRUE(readOnlySqlFile.connectionOpen());
+  EXPECT_TRUE(readOnlySqlFile.readOnly());
+  EXPECT_FALSE(sqlFile.readOnly());
+
+  // data dictionary is read on first use
+  EXPECT_EQ(sqlFile.availableEnvPeriods(), readOnlySqlFile.availableEnvPeriods());
+  EXPECT_EQ(sqlFile.availableTimeSeries(), readOnlySqlFile.availableTimeSeries());
+
+  ASSERT_TRUE(readOnlySqlFile.netSiteEnergy());
+  EXPECT_DOUBLE_EQ(*sqlFile.netSiteEnergy(), *readOnlySqlFile.netSiteEnergy());
+}
+
+TEST_F(SqlFileFixture, SqlFileCollection)
+{
+  std::vector<openstudio::path> paths;
+  paths.push_back(resourcesPath() / toPath("energyplus/5ZoneAirCooled/eplusout.sql"));
+  paths.push_back(resourcesPath() / toPath("energyplus/Office_With_Many_HVAC_Types/eplusout.sql"));
+  paths.push_back(resourcesPath() / toPath("energyplus/NotAFile/eplusout.sql"));
+
+  SqlFileCollection collection(paths);
+  EXPECT_EQ(paths, collection.paths());
+  EXPECT_EQ(0u, collection.numThreads());
+
+  std::vector<std::string> statements;
+  statements.push_back("SELECT COUNT(*) FROM Zones");
+  statements.push_back("SELECT COUNT(*) FROM NonExistantTable");
+
+  std::vector<SqlFileCollection::Extractor> extractors;
+  extractors.push_back([](const SqlFile& s) { return s.netSiteEnergy(); });
+  extractors.push_back([](const SqlFile& s) { return s.electricityTotalEndUses(); });
+
+  for (unsigned numThreads : {1u, 2u, 0u}) {
+    collection.setNumThreads(numThreads);
+
+    SqlFileCollection::ResultTable table = collection.execAndReturnFirstDouble(statements);
+    ASSERT_EQ(2u, table.size());
+    ASSERT_EQ(3u, table[0].size());
+    ASSERT_EQ(3u, table[1].size());
+    EXPECT_EQ(sqlFile.execAndReturnFirstDouble(statements[0]), table[0][0]);
+    EXPECT_EQ(sqlFile2.execAndReturnFirstDouble(statements[0]), table[0][1]);
+    EXPECT_FALSE(table[0][2]);
+    EXPECT_FALSE(table[1][0]);
+    EXPECT_FALSE(table[1][1]);
+    EXPECT_FALSE(table[1][2]);
+
+    table = collection.extract(extractors);
+    ASSERT_EQ(2u, table.size());
+    ASSERT_EQ(3u, table[0].size());
+    EXPECT_EQ(sqlFile.netSiteEnergy(), table[0][0]);
+    EXPECT_EQ(sqlFile2.netSiteEnergy(), table[0][1]);
+    EXPECT_FALSE(table[0][2]);
+    EXPECT_EQ(sqlFile.electricityTotalEndUses(), table[1][0]);
+    EXPECT_EQ(sqlFile2.electricityTotalEndUses(), table[1][1]);
+    EXPECT_FALSE(table[1][2]);
+  }
+}
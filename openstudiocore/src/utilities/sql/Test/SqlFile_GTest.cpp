@@ -64,6 +64,52 @@ TEST_F(SqlFileFixture, SummaryValues)
 }
 
 
+TEST_F(SqlFileFixture, TabularDataIndex)
+{
+  ASSERT_FALSE(sqlFile.useTabularDataIndex());
+
+  std::vector<boost::optional<double> > values;
+  ASSERT_TRUE(sqlFile.netSiteEnergy());
+  values.push_back(sqlFile.netSiteEnergy());
+  values.push_back(sqlFile.totalSourceEnergy());
+  values.push_back(sqlFile.electricityHeating());
+  values.push_back(sqlFile.electricityTotalEndUses());
+  values.push_back(sqlFile.naturalGasTotalEndUses());
+  values.push_back(sqlFile.hoursHeatingSetpointNotMet());
+  boost::optional<EndUses> endUses = sqlFile.endUses();
+  ASSERT_TRUE(endUses);
+
+  sqlFile.setUseTabularDataIndex(true);
+  EXPECT_TRUE(sqlFile.useTabularDataIndex());
+
+  std::vector<boost::optional<double> > indexedValues;
+  indexedValues.push_back(sqlFile.netSiteEnergy());
+  indexedValues.push_back(sqlFile.totalSourceEnergy());
+  indexedValues.push_back(sqlFile.electricityHeating());
+  indexedValues.push_back(sqlFile.electricityTotalEndUses());
+  indexedValues.push_back(sqlFile.naturalGasTotalEndUses());
+  indexedValues.push_back(sqlFile.hoursHeatingSetpointNotMet());
+  boost::optional<EndUses> indexedEndUses = sqlFile.endUses();
+  ASSERT_TRUE(indexedEndUses);
+
+  sqlFile.setUseTabularDataIndex(false);
+  EXPECT_FALSE(sqlFile.useTabularDataIndex());
+
+  ASSERT_EQ(values.size(), indexedValues.size());
+  for (unsigned i = 0; i < values.size(); ++i) {
+    ASSERT_EQ(static_cast<bool>(values[i]), static_cast<bool>(indexedValues[i])) << i;
+    if (values[i]) {
+      EXPECT_DOUBLE_EQ(*values[i], *indexedValues[i]) << i;
+    }
+  }
+
+  for (const EndUseFuelType& fuelType : endUses->fuelTypes()) {
+    for (const EndUseCategoryType& category : endUses->categories()) {
+      EXPECT_DOUBLE_EQ(endUses->getEndUse(fuelType, category), indexedEndUses->getEndUse(fuelType, category));
+    }
+  }
+}
+
 TEST_F(SqlFileFixture, EnvPeriods)
 {
   std::vector<std::string> availableEnvPeriods = sqlFile.availableEnvPeriods();
@@ -296,6 +342,60 @@ TEST_F(SqlFileFixture, CreateSqlFile)
 
 }
 
+TEST_F(SqlFileFixture, CreateSqlFile_BulkTimeSeries)
+{
+  openstudio::path outfile = openstudio::tempDir() / openstudio::toPath("OpenStudioSqlFileBulkTest.sql");
+  if (openstudio::filesystem::exists(outfile))
+  {
+    openstudio::filesystem::remove(outfile);
+  }
+
+  openstudio::Calendar c(2012);
+  c.standardHolidays();
+
+  std::vector<ReportVariableData> reportVariables;
+  for (unsigned i = 0; i < 10; ++i) {
+    std::vector<double> values;
+    for (unsigned j = 0; j < 8760; ++j) {
+      values.push_back(i * 10000 + j);
+    }
+    TimeSeries timeSeries(c.startDate(), openstudio::Time(0,1), openstudio::createVector(values), "W");
+    reportVariables.push_back(ReportVariableData("Avg", "Zone", "Zone", "ZONE " + std::to_string(i), "Zone Lights Electric Power",
+      openstudio::ReportingFrequency::Hourly, boost::optional<std::string>(), "W", timeSeries));
+  }
+
+  {
+    openstudio::SqlFile sql(outfile,
+        openstudio::EpwFile(resourcesPath() / toPath("utilities/Filetypes/USA_CO_Golden-NREL.724666_TMY3.epw")),
+        openstudio::DateTime::now(),
+        c);
+
+    EXPECT_TRUE(sql.connectionOpen());
+
+    sql.insertTimeSeriesData(reportVariables);
+
+    EXPECT_EQ(10, sql.execAndReturnFirstInt("select count(*) from reportdatadictionary").get());
+    EXPECT_EQ(87600, sql.execAndReturnFirstInt("select count(*) from reportdata").get());
+    EXPECT_EQ(0, sql.execAndReturnFirstInt("select count(*) from reportdata where TimeIndex is null").get());
+  }
+
+  {
+    openstudio::SqlFile sql(outfile);
+    EXPECT_TRUE(sql.connectionOpen());
+    std::vector<std::string> envPeriods = sql.availableEnvPeriods();
+    ASSERT_EQ(envPeriods.size(), 1u);
+    std::vector<std::string> keyValues = sql.availableKeyValues(envPeriods[0], "Hourly", "Zone Lights Electric Power");
+    EXPECT_EQ(10u, keyValues.size());
+
+    for (const auto & reportVariable : reportVariables) {
+      boost::optional<TimeSeries> ts = sql.timeSeries(envPeriods[0], "Hourly", "Zone Lights Electric Power", reportVariable.keyValue);
+      ASSERT_TRUE(ts);
+      EXPECT_EQ(openstudio::toStandardVector(ts->values()), openstudio::toStandardVector(reportVariable.timeSeries.values()));
+      EXPECT_EQ(openstudio::toStandardVector(ts->daysFromFirstReport()), openstudio::toStandardVector(reportVariable.timeSeries.daysFromFirstReport()));
+    }
+  }
+}
+
 TEST_F(SqlFileFixture, AnnualTotalCosts) {
   
   // Total annual costs for all fuel types
@@ -42,6 +42,8 @@
 #include "ThermUnit.hpp"
 #include "WhUnit.hpp"
 
+#include "../data/TimeSeries.hpp"
+
 #include "../core/Assert.hpp"
 
 namespace openstudio {
@@ -288,6 +290,41 @@ QuantityConverterSingleton::QuantityConverterSingleton()
 }
 
 
+boost::optional<unitStringConversionFactor> QuantityConverterSingleton::conversionFactor(
+    const std::string& originalUnits,
+    const std::string& finalUnits) const
+{
+  std::lock_guard<std::mutex> lock(m_unitStringConversionsMutex);
+
+  std::pair<std::string, std::string> key(originalUnits, finalUnits);
+  UnitStringConversionMap::const_iterator it = m_unitStringConversions.find(key);
+  if (it != m_unitStringConversions.end()) {
+    return it->second;
+  }
+
+  boost::optional<unitStringConversionFactor> result;
+  if (originalUnits == finalUnits) {
+    unitStringConversionFactor identity = { 1.0, 0.0 };
+    result = identity;
+  }
+  else {
+    boost::optional<Unit> originalUnit = UnitFactory::instance().createUnit(originalUnits);
+    boost::optional<Unit> finalUnit = UnitFactory::instance().createUnit(finalUnits);
+    if (originalUnit && finalUnit) {
+      // conversions are affine, so converting 0 and 1 determines the offset and the factor
+      OptionalQuantity offset = convert(Quantity(0.0, *originalUnit), *finalUnit);
+      OptionalQuantity factorPlusOffset = convert(Quantity(1.0, *originalUnit), *finalUnit);
+      if (offset && factorPlusOffset) {
+        unitStringConversionFactor conversion = { factorPlusOffset->value() - offset->value(), offset->value() };
+        result = conversion;
+      }
+    }
+  }
+
+  m_unitStringConversions[key] = result;
+  return result;
+}
+
 boost::optional<Quantity> QuantityConverterSingleton::m_convertToSI(const Quantity &original) const
 {
   // create a working copy of the original
@@ -512,26 +549,72 @@ boost::optional<double> convert(double original, const std::string& originalUnit
     return original;
   }
 
-  //create the units from the strings
-  boost::optional<Unit> originalUnit = UnitFactory::instance().createUnit(originalUnits);
-  boost::optional<Unit> finalUnit = UnitFactory::instance().createUnit(finalUnits);
+  boost::optional<unitStringConversionFactor> conversion = QuantityConverter::instance().conversionFactor(originalUnits, finalUnits);
+  if (conversion) {
+    return conversion->factor * original + conversion->offset;
+  }
 
-  //make sure both unit strings were valid
-  if (originalUnit && finalUnit) {
+  return boost::none;
+}
 
-    //make the original quantity
-    Quantity originalQuant = Quantity(original, *originalUnit);
+bool convert(std::vector<double>& values, const std::string& originalUnits, const std::string& finalUnits)
+{
+  if (originalUnits == finalUnits){
+    return true;
+  }
 
-    //convert to final units
-    boost::optional<Quantity> finalQuant = QuantityConverter::instance().convert(originalQuant, *finalUnit);
-  
-    //if the conversion 
-    if (finalQuant) {
-      return finalQuant->value();
-    }
+  boost::optional<unitStringConversionFactor> conversion = QuantityConverter::instance().conversionFactor(originalUnits, finalUnits);
+  if (!conversion) {
+    return false;
   }
 
-  return boost::none;
+  // plain loop over contiguous storage so the compiler can vectorize it
+  const double factor = conversion->factor;
+  const double offset = conversion->offset;
+  double* data = values.data();
+  const std::size_t n = values.size();
+  for (std::size_t i = 0; i < n; ++i) {
+    data[i] = factor * data[i] + offset;
+  }
+
+  return true;
+}
+
+bool convert(Vector& values, const std::string& originalUnits, const std::string& finalUnits)
+{
+  if (originalUnits == finalUnits){
+    return true;
+  }
+
+  boost::optional<unitStringConversionFactor> conversion = QuantityConverter::instance().conversionFactor(originalUnits, finalUnits);
+  if (!conversion) {
+    return false;
+  }
+
+  // element 0 of an empty ublas Vector cannot be addressed
+  if (values.empty()) {
+    return true;
+  }
+
+  const double factor = conversion->factor;
+  const double offset = conversion->offset;
+  double* data = &values.data()[0];
+  const std::size_t n = values.size();
+  for (std::size_t i = 0; i < n; ++i) {
+    data[i] = factor * data[i] + offset;
+  }
+
+  return true;
+}
+
+boost::optional<TimeSeries> convert(const TimeSeries& timeSeries, const std::string& finalUnits)
+{
+  Vector values = timeSeries.values();
+  if (!convert(values, timeSeries.units(), finalUnits)) {
+    return boost::none;
+  }
+
+  return TimeSeries(timeSeries.m_impl->withValues(values, finalUnits));
 }
 
 boost::optional<Quantity> convert(const Quantity &q, UnitSystem sys) {
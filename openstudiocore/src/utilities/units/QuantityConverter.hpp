@@ -34,8 +34,12 @@
 #include "../core/Logger.hpp"
 
 #include "Unit.hpp"
+#include "../data/Vector.hpp"
+
 #include <string>
 #include <map>
+#include <mutex>
+#include <vector>
 
 class QDomElement;
 
@@ -43,6 +47,7 @@ namespace openstudio {
 
 class Quantity;
 class OSQuantityVector;
+class TimeSeries;
 
 // JMT@20100902 - it's necessary to move the temperature conversion
 //                rule enum into a class that is *not* %ignored by swig, if we want
@@ -83,6 +88,14 @@ struct baseUnitConversionFactor {
   double offset;
 };
 
+/** A conversion between two unit strings compiled down to a scale factor and an offset, so that
+ *  the converted value is factor * original + offset. The offset is only non-zero for temperatures.
+ */
+struct unitStringConversionFactor {
+  double factor;
+  double offset;
+};
+
 /** Singleton for converting quantities to different \link UnitSystem unit systems \endlink or
  *  to targeted \link Unit units \endlink */
 class UTILITIES_API QuantityConverterSingleton {
@@ -95,6 +108,13 @@ class UTILITIES_API QuantityConverterSingleton {
 
   boost::optional<Quantity> convert(const Quantity &original, const Unit& targetUnits) const;
 
+  /** Returns the factor and offset that convert values in originalUnits to finalUnits, or
+   *  boost::none if either unit string is invalid or the units are not compatible. The units are
+   *  parsed and converted once per pair of unit strings, later calls are served from a thread safe
+   *  cache. */
+  boost::optional<unitStringConversionFactor> conversionFactor(const std::string& originalUnits,
+                                                               const std::string& finalUnits) const;
+
  private:
   REGISTER_LOGGER("openstudio.units.QuantityConverter");
   QuantityConverterSingleton();
@@ -105,6 +125,12 @@ class UTILITIES_API QuantityConverterSingleton {
   BaseUnitConversionMap m_toSImap;
   UnitSystemConversionMultiMap m_fromSIBySystemMap;
 
+  typedef std::map<std::pair<std::string, std::string>, boost::optional<unitStringConversionFactor> > UnitStringConversionMap;
+
+  // conversions compiled by conversionFactor, including failed ones
+  mutable UnitStringConversionMap m_unitStringConversions;
+  mutable std::mutex m_unitStringConversionsMutex;
+
   boost::optional<Quantity> m_convertToSI(const Quantity& original) const;
 
   Quantity m_convertFromSI(const Quantity& original, const UnitSystem& targetSys) const;
@@ -120,6 +146,20 @@ typedef openstudio::Singleton<QuantityConverterSingleton> QuantityConverter;
 /** Non-member function to simplify interface for users. \relates QuantityConverterSingleton */
 UTILITIES_API boost::optional<double> convert(double original, const std::string& originalUnits, const std::string& finalUnits);
 
+/** Non-member function that converts all values in place using a single compiled conversion.
+ *  Returns false and leaves values unchanged if the units cannot be converted.
+ *  \relates QuantityConverterSingleton */
+UTILITIES_API bool convert(std::vector<double>& values, const std::string& originalUnits, const std::string& finalUnits);
+
+/** Non-member function that converts all values in place using a single compiled conversion.
+ *  Returns false and leaves values unchanged if the units cannot be converted.
+ *  \relates QuantityConverterSingleton */
+UTILITIES_API bool convert(Vector& values, const std::string& originalUnits, const std::string& finalUnits);
+
+/** Non-member function that returns a copy of timeSeries, reporting at the same times, with values
+ *  converted from the series units to finalUnits. \relates QuantityConverterSingleton \relates TimeSeries */
+UTILITIES_API boost::optional<TimeSeries> convert(const TimeSeries& timeSeries, const std::string& finalUnits);
+
 /** Non-member function to simplify interface for users. \relates QuantityConverterSingleton */
 UTILITIES_API boost::optional<Quantity> convert(const Quantity& original, UnitSystem sys);
 
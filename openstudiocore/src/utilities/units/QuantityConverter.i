@@ -8,6 +8,11 @@
 // hide shared_ptrs, expose helper functions
 %ignore QuantityConverterSingleton;
 %ignore QuantityConverter;
+
+// in place conversions do not map to the bindings, TimeSeries is wrapped in a later module
+%ignore openstudio::convert(std::vector<double>&, const std::string&, const std::string&);
+%ignore openstudio::convert(Vector&, const std::string&, const std::string&);
+%ignore openstudio::convert(const TimeSeries&, const std::string&);
 %include <utilities/units/QuantityConverter.hpp>
 
 #endif // UTILITIES_UNITS_QUANTITYCONVERTER_I
@@ -43,6 +43,8 @@
 #include "../SIUnit.hpp"
 #include "../Unit.hpp"
 
+#include "../../data/TimeSeries.hpp"
+
 using namespace openstudio;
 
 TEST_F(UnitsFixture, QuantityConverter_IPandSIUsingSystem)
@@ -257,6 +259,65 @@ TEST_F(UnitsFixture,QuantityConverter_OSQuantityVector) {
   EXPECT_TRUE(resultQ->isRelative());
 }
 
+TEST_F(UnitsFixture,QuantityConverter_UnitStrings) {
+  // cached conversions match converting through quantities
+  Quantity siq(20.0,createCelsiusTemperature());
+  OptionalQuantity ipq = QuantityConverter::instance().convert(siq,UnitSystem(UnitSystem::Fahrenheit));
+  ASSERT_TRUE(ipq);
+  boost::optional<double> value = convert(20.0,"C","F");
+  ASSERT_TRUE(value);
+  EXPECT_NEAR(ipq->value(),*value,1.0E-12);
+  value = convert(20.0,"C","F");
+  ASSERT_TRUE(value);
+  EXPECT_NEAR(68.0,*value,1.0E-12);
+
+  boost::optional<unitStringConversionFactor> conversion = QuantityConverter::instance().conversionFactor("m","ft");
+  ASSERT_TRUE(conversion);
+  EXPECT_DOUBLE_EQ(1.0/0.3048,conversion->factor);
+  EXPECT_DOUBLE_EQ(0.0,conversion->offset);
+
+  EXPECT_FALSE(convert(1.0,"m","kg"));
+  EXPECT_FALSE(QuantityConverter::instance().conversionFactor("m","kg"));
+
+  // bulk conversions
+  std::vector<double> values = { 0.0, 20.0, 100.0 };
+  EXPECT_TRUE(convert(values,"C","F"));
+  EXPECT_NEAR(32.0,values[0],1.0E-12);
+  EXPECT_NEAR(68.0,values[1],1.0E-12);
+  EXPECT_NEAR(212.0,values[2],1.0E-12);
+  EXPECT_FALSE(convert(values,"C","m"));
+  EXPECT_NEAR(32.0,values[0],1.0E-12);
+
+  Vector vector(3,1000.0);
+  EXPECT_TRUE(convert(vector,"W","kW"));
+  for (unsigned i = 0; i < vector.size(); ++i) {
+    EXPECT_DOUBLE_EQ(1.0,vector[i]);
+  }
+
+  DateTime firstReportDateTime(Date(MonthOfYear(MonthOfYear::Jan),1),Time(0,1));
+  TimeSeries timeSeries(firstReportDateTime,Time(0,1),Vector(24,1000.0),"W");
+  boost::optional<TimeSeries> converted = convert(timeSeries,"kW");
+  ASSERT_TRUE(converted);
+  EXPECT_EQ("kW",converted->units());
+  EXPECT_EQ(timeSeries.dateTimes(),converted->dateTimes());
+  ASSERT_EQ(24u,converted->values().size());
+  EXPECT_DOUBLE_EQ(1.0,converted->values()[23]);
+  EXPECT_DOUBLE_EQ(1000.0,timeSeries.values()[23]);
+  EXPECT_FALSE(convert(timeSeries,"m"));
+
+  // empty inputs
+  Vector emptyVector;
+  EXPECT_TRUE(convert(emptyVector,"W","kW"));
+  EXPECT_TRUE(emptyVector.empty());
+  EXPECT_FALSE(convert(emptyVector,"W","m"));
+
+  TimeSeries emptyTimeSeries(firstReportDateTime,Time(0,1),Vector(),"W");
+  converted = convert(emptyTimeSeries,"kW");
+  ASSERT_TRUE(converted);
+  EXPECT_EQ("kW",converted->units());
+  EXPECT_TRUE(converted->values().empty());
+}
+
 TEST_F(UnitsFixture,QuantityConverter_Profiling_QuantityVectorBaseCase) {
   QuantityVector result(testQuantityVector);
   for (auto & elem : result) {